@@ -23,7 +23,7 @@ const configFtp = {
     port: process.env.FTP_PORT || 21,
     localRoot: path.join(__dirname, 'dist'),
     remoteRoot: isTest ? process.env.FTP_REMOTE_TEST_ROOT : process.env.FTP_REMOTE_ROOT,
-    include: ['*', '**/*'],
+    include: ['*', '**/*', '.htaccess'],
     exclude: ['*.map'],
 };
 
@@ -0,0 +1,199 @@
+/**
+ * @module BenchHarness
+ * @author Radim Brnka
+ * @description Deterministic replay support for the headless benchmark: a virtual frame clock replacing
+ * requestAnimationFrame/performance.now (via Jest fake timers), a seeded Math.random, CPU measurement on the real
+ * monotonic clock, and JSON report/baseline comparison.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {profiler} from '../global/profiler';
+
+const fs = require('fs');
+const path = require('path');
+
+/** Virtual frame length (60 Hz) */
+export const FRAME_MS = 1000 / 60;
+
+/** Real monotonic time in ms (performance.now() is virtual during the benchmark) */
+export const realNow = () => Number(process.hrtime.bigint()) / 1e6;
+
+// region > VIRTUAL CLOCK ----------------------------------------------------------------------------------------------
+
+let rafQueue = [];
+let rafId = 0;
+
+/**
+ * Fakes timers, Date and performance.now, and replaces requestAnimationFrame with a frame-aligned queue.
+ * @param {number} [seed] Seed for Math.random
+ */
+export function installVirtualClock(seed = 1) {
+    jest.useFakeTimers({now: 0, doNotFake: ['requestAnimationFrame', 'cancelAnimationFrame', 'nextTick', 'queueMicrotask']});
+
+    rafQueue = [];
+    global.requestAnimationFrame = (cb) => {
+        rafQueue.push({id: ++rafId, cb});
+        return rafId;
+    };
+    global.cancelAnimationFrame = (id) => {
+        rafQueue = rafQueue.filter(entry => entry.id !== id);
+    };
+
+    // Mulberry32: random palettes / demo picks replay identically
+    let state = seed >>> 0;
+    Math.random = () => {
+        state = (state + 0x6D2B79F5) >>> 0;
+        let t = state;
+        t = Math.imul(t ^ (t >>> 15), t | 1);
+        t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+
+    profiler.setClock(realNow);
+    profiler.enable(null);
+}
+
+/** Advances virtual time by one frame, then runs the animation frame callbacks queued before it. */
+export async function stepFrame() {
+    await jest.advanceTimersByTimeAsync(FRAME_MS);
+
+    const due = rafQueue;
+    rafQueue = [];
+    const ts = performance.now();
+    for (const {cb} of due) cb(ts);
+
+    // Let promise chains awaiting this frame settle before the next one
+    for (let i = 0; i < 8; i++) await Promise.resolve();
+}
+
+/**
+ * Drives the virtual clock until the promise settles or the frame budget runs out.
+ * @param {Promise<*>|function(): Promise<*>} work
+ * @param {number} maxFrames
+ * @returns {Promise<number>} Frames stepped
+ */
+export async function runFrames(work, maxFrames) {
+    let settled = false;
+    let error = null;
+    const promise = typeof work === 'function' ? work() : work;
+    Promise.resolve(promise).then(() => settled = true, (e) => {
+        settled = true;
+        error = e;
+    });
+
+    let frames = 0;
+    while (!settled && frames < maxFrames) {
+        await stepFrame();
+        frames++;
+    }
+    if (error) throw error;
+    return frames;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > MEASUREMENT ------------------------------------------------------------------------------------------------
+
+/**
+ * Runs one scripted scenario and collects CPU-side costs.
+ * @param {FractalRenderer} renderer
+ * @param {function(): Promise<*>} script
+ * @param {number} maxFrames Virtual frame budget (ends endless animations such as dives)
+ * @returns {Promise<Object>} Scenario result
+ */
+export async function measureScenario(renderer, script, maxFrames) {
+    let draws = 0;
+    const draw = renderer.draw;
+    renderer.draw = function (...args) {
+        draws++;
+        return draw.apply(this, args);
+    };
+
+    profiler.reset();
+    global.gc?.();
+    const heap0 = process.memoryUsage().heapUsed;
+    const t0 = realNow();
+
+    const frames = await runFrames(script, maxFrames);
+
+    const cpuMs = realNow() - t0;
+    const heapDelta = process.memoryUsage().heapUsed - heap0;
+    renderer.stopAllNonColorAnimations?.();
+    renderer.draw = draw;
+
+    const stages = {};
+    for (const row of profiler.summary()) {
+        // Sums are reproducible enough for regression checks; percentiles describe the spikes
+        const stage = profiler.stages.get(row.name);
+        let total = 0;
+        for (let i = 0; i < stage.count; i++) total += stage.samples[i];
+        stages[row.name] = {
+            count: row.count,
+            totalMs: round(total),
+            p50: round(row.p50),
+            p95: round(row.p95),
+            max: round(row.max),
+        };
+    }
+
+    return {
+        frames,
+        draws,
+        cpuMs: round(cpuMs),
+        cpuMsPerDraw: round(draws ? cpuMs / draws : 0),
+        // Only meaningful with --expose-gc (no collection is forced mid-run, so this is a lower bound)
+        heapBytesPerFrame: global.gc && frames ? Math.max(0, Math.round(heapDelta / frames)) : null,
+        stages,
+    };
+}
+
+const round = (v) => Number.isFinite(v) ? Math.round(v * 1000) / 1000 : null;
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > REPORTS ----------------------------------------------------------------------------------------------------
+
+/**
+ * Compares a report against a baseline. A scenario regresses when its CPU time per draw grows by more than the
+ * tolerance (and by more than the absolute noise floor).
+ * @param {Object} report
+ * @param {Object} baseline
+ * @param {number} [tolerance] Relative increase allowed (0.15 = 15 %)
+ * @param {number} [floorMs] Differences below this per draw are ignored
+ * @returns {Array<{scenario: string, baseline: number, current: number, ratio: number}>}
+ */
+export function findRegressions(report, baseline, tolerance = 0.15, floorMs = 0.01) {
+    const regressions = [];
+    for (const [scenario, current] of Object.entries(report.scenarios)) {
+        const base = baseline?.scenarios?.[scenario];
+        if (!base || !base.cpuMsPerDraw) continue;
+
+        const ratio = current.cpuMsPerDraw / base.cpuMsPerDraw;
+        if (ratio > 1 + tolerance && current.cpuMsPerDraw - base.cpuMsPerDraw > floorMs) {
+            regressions.push({scenario, baseline: base.cpuMsPerDraw, current: current.cpuMsPerDraw, ratio: round(ratio)});
+        }
+    }
+    return regressions;
+}
+
+/**
+ * @param {string} file
+ * @returns {Object|null}
+ */
+export function readJSON(file) {
+    try {
+        return JSON.parse(fs.readFileSync(file, 'utf8'));
+    } catch (e) {
+        return null;
+    }
+}
+
+/**
+ * @param {string} file
+ * @param {Object} data
+ */
+export function writeJSON(file, data) {
+    fs.mkdirSync(path.dirname(file), {recursive: true});
+    fs.writeFileSync(file, JSON.stringify(data, null, 2) + '\n');
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
@@ -0,0 +1,63 @@
+/**
+ * @module GLStub
+ * @author Radim Brnka
+ * @description Headless WebGL stand-in for the benchmark harness. Every method is a no-op that returns a plausible
+ * value (objects for create*, true for status queries), constants resolve to stable numbers and extensions are
+ * stubs of the same kind. GPU work is not simulated; the benchmark measures CPU-side costs only.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+const CONSTANT = /^[A-Z0-9_]+$/;
+
+/** Deterministic numeric value for a GL constant name */
+function constantValue(name) {
+    let h = 0x811C9DC5;
+    for (let i = 0; i < name.length; i++) h = Math.imul(h ^ name.charCodeAt(i), 0x01000193) >>> 0;
+    return h & 0xFFFF;
+}
+
+function stubMethod(name) {
+    if (name.startsWith('create')) return () => ({});
+    if (name === 'getExtension') return () => createStub();
+    if (name === 'getSupportedExtensions') return () => [];
+    if (name === 'getShaderParameter' || name === 'getProgramParameter') return () => true;
+    if (name === 'getShaderPrecisionFormat') return () => ({precision: 23, rangeMin: 127, rangeMax: 127});
+    if (name === 'getParameter') return () => 0;
+    if (name === 'getUniformLocation') return () => ({});
+    if (name === 'getAttribLocation') return () => 0;
+    if (name === 'getShaderInfoLog' || name === 'getProgramInfoLog') return () => '';
+    if (name === 'isContextLost') return () => false;
+    if (name.startsWith('getQueryObject')) return () => 0;
+    return () => undefined;
+}
+
+/**
+ * Creates a stub context (or extension object).
+ * @returns {WebGLRenderingContext}
+ */
+export function createStub() {
+    const cache = new Map();
+    return new Proxy({}, {
+        get(target, prop) {
+            if (typeof prop !== 'string') return undefined;
+            if (prop === 'then') return undefined; // never look like a thenable
+            if (!cache.has(prop)) cache.set(prop, CONSTANT.test(prop) ? constantValue(prop) : stubMethod(prop));
+            return cache.get(prop);
+        }
+    });
+}
+
+/**
+ * Routes canvas.getContext('webgl') to the stub for the lifetime of the process.
+ */
+export function installGLStub() {
+    const original = HTMLCanvasElement.prototype.getContext;
+    HTMLCanvasElement.prototype.getContext = function (type, ...rest) {
+        if (type === 'webgl' || type === 'webgl2' || type === 'experimental-webgl') {
+            if (!this.__glStub) this.__glStub = createStub();
+            return this.__glStub;
+        }
+        return original ? original.call(this, type, ...rest) : null;
+    };
+}
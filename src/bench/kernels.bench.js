@@ -0,0 +1,211 @@
+/**
+ * @jest-environment jsdom
+ */
+// src/bench/kernels.bench.js
+// Microbenchmarks of the CPU numeric kernels at representative inputs. Writes median ns/op, MAD and ops/s per
+// kernel and input to bench/kernels.json and prints a table.
+//
+//   npm run bench:kernels
+//
+// Environment: BENCH_FILTER (substring of kernel names), BENCH_SAMPLES, BENCH_SAMPLE_MS.
+
+import {installGLStub} from './glStub';
+import {writeJSON} from './benchHarness';
+import {formatTable, measure} from './microbench';
+import {ddAdd, ddSubDD, ddSubDDInto, splitFloat, splitFloatInto} from '../global/utils';
+import {analyzeMandelbrotPoint} from '../global/utils.fractal';
+import {zeta as zetaEta} from '../ui/zetaPathOverlay';
+import {theta, Z, zeta as zetaRS} from '../ui/zetaPathOverlayRS';
+
+jest.mock('../ui/ui', () => global.mockUIModule);
+jest.mock('../ui/juliaSlidersController', () => ({
+    updateJuliaSliders: jest.fn(),
+    disableJuliaSliders: jest.fn(),
+    enableJuliaSliders: jest.fn(),
+}));
+
+installGLStub();
+
+const path = require('path');
+
+const ROOT = path.resolve(__dirname, '../..');
+const RESULT_FILE = path.join(ROOT, 'bench/kernels.json');
+const FILTER = process.env.BENCH_FILTER || '';
+
+// The renderer modules must be loaded after the mocks above are registered
+const {default: MandelbrotRenderer} = require('../renderers/mandelbrotRenderer');
+const {JuliaRenderer} = require('../renderers/juliaRenderer');
+
+const mandelbrotViews = require('../data/mandelbrot.json').views;
+const juliaViews = require('../data/julia.json').views;
+
+const view = (views, id) => views.find(v => v.id === id);
+
+/**
+ * Zoom depths. Each uses a stored preset centre near the boundary (so escape loops run long) and the iteration
+ * budget the Mandelbrot renderer derives from that zoom. "1e-30" borrows the Tip preset's centre (stored at 1.7e-35).
+ */
+const DEPTHS = [
+    {label: 'shallow', zoom: 3, pan: view(mandelbrotViews, 'Default').pan},
+    {label: '1e-15', zoom: 1e-15, pan: view(mandelbrotViews, 'Misiurewicz Point 1').pan},
+    {label: '1e-30', zoom: 1e-30, pan: view(mandelbrotViews, 'Tip').pan},
+];
+
+/** Critical-line heights for the zeta kernels */
+const T_VALUES = [100, 1000, 10000];
+
+/** Mirrors MandelbrotRenderer.draw() */
+const itersForZoom = (zoom, maxIter) => Math.max(50, Math.min(maxIter, Math.floor(200 + 50 * Math.log2(3 / zoom))));
+
+const results = {
+    version: 1,
+    createdAt: null,
+    node: process.version,
+    kernels: {},
+};
+
+/**
+ * Registers one kernel/input case.
+ * @param {string} kernel
+ * @param {string} input
+ * @param {function(): function(): *} setup Returns the bound kernel call
+ */
+function kernelCase(kernel, input, setup) {
+    const run = FILTER && !kernel.includes(FILTER) ? test.skip : test;
+    run(`${kernel} [${input}]`, () => {
+        const call = setup();
+        (results.kernels[kernel] ??= {})[input] = measure(call);
+    }, 5 * 60 * 1000);
+}
+
+function createRenderer(Renderer) {
+    const canvas = document.createElement('canvas');
+    canvas.width = 1280;
+    canvas.height = 720;
+    const renderer = new Renderer(canvas);
+    renderer.resizeCanvas = () => {};
+    return renderer;
+}
+
+describe('CPU kernel microbenchmarks', () => {
+    let mandelbrot;
+    let julia;
+
+    beforeAll(() => {
+        mandelbrot = createRenderer(MandelbrotRenderer);
+        julia = createRenderer(JuliaRenderer);
+    });
+
+    afterAll(() => {
+        mandelbrot?.destroy?.();
+        julia?.destroy?.();
+        results.createdAt = new Date().toISOString();
+        writeJSON(RESULT_FILE, results);
+        process.stdout.write(`\n${formatTable(results.kernels)}\n\nWritten: ${RESULT_FILE}\n`);
+    });
+
+    for (const depth of DEPTHS) {
+        const [cx, cy] = depth.pan;
+
+        kernelCase('mandelbrot.escapeItersDouble', depth.label, () => {
+            const iters = itersForZoom(depth.zoom, mandelbrot.MAX_ITER);
+            return () => mandelbrot.escapeItersDouble(cx, cy, iters);
+        });
+
+        for (const shader of ['perturbation', 'series']) {
+            kernelCase(`mandelbrot.computeReferenceOrbit/${shader}`, depth.label, () => {
+                mandelbrot.switchShader(shader);
+                mandelbrot.zoom = depth.zoom;
+                mandelbrot.refPan[0] = cx;
+                mandelbrot.refPan[1] = cy;
+                return () => mandelbrot.computeReferenceOrbit();
+            });
+        }
+
+        kernelCase('analyzeMandelbrotPoint', depth.label, () => {
+            const iters = itersForZoom(depth.zoom, 5000);
+            return () => analyzeMandelbrotPoint(cx, cy, iters);
+        });
+
+        // DD kernels: a pan step at this depth, and the per-frame delta between view centre and reference
+        kernelCase('ddAdd', depth.label, () => {
+            const dd = {hi: cx, lo: 0};
+            const step = depth.zoom * 1e-3;
+            let sign = 1;
+            return () => ddAdd(dd, (sign = -sign) * step);
+        });
+
+        kernelCase('ddSubDD', depth.label, () => {
+            const a = {hi: cx, lo: depth.zoom * 1e-17};
+            const b = {hi: cx + depth.zoom * 0.25, lo: 0};
+            return () => ddSubDD(a, b);
+        });
+
+        kernelCase('ddSubDDInto', depth.label, () => {
+            const a = {hi: cx, lo: depth.zoom * 1e-17};
+            const b = {hi: cx + depth.zoom * 0.25, lo: 0};
+            const out = new Float64Array(2);
+            return () => ddSubDDInto(a, b, out);
+        });
+
+        // splitFloat over the orbit values the perturbation upload splits at this depth
+        kernelCase('splitFloat', depth.label, () => {
+            const values = new Float64Array(1024);
+            let zx = 0, zy = 0;
+            for (let i = 0; i < values.length; i++) {
+                const t = zx * zx - zy * zy + cx;
+                zy = 2 * zx * zy + cy;
+                zx = t;
+                values[i] = zx;
+            }
+            let i = 0;
+            return () => splitFloat(values[i++ & 1023]);
+        });
+
+        // The allocation-free split the orbit builders use, writing into a texel row
+        kernelCase('splitFloatInto', depth.label, () => {
+            const values = new Float64Array(1024);
+            let zx = 0, zy = 0;
+            for (let i = 0; i < values.length; i++) {
+                const t = zx * zx - zy * zy + cx;
+                zy = 2 * zx * zy + cy;
+                zx = t;
+                values[i] = zx;
+            }
+            const row = new Float32Array(2048);
+            let i = 0;
+            return () => {
+                const k = i++ & 1023;
+                return splitFloatInto(values[k], row, k * 2);
+            };
+        });
+    }
+
+    // Julia probes are capped at 2000 iterations by JuliaRenderer.draw(); the view centre stays at the origin
+    for (const id of ['Kissing Dragons', 'Seahorses']) {
+        const {c} = view(juliaViews, id);
+
+        kernelCase('julia.escapeItersJulia', id, () => {
+            julia.c[0] = c[0];
+            julia.c[1] = c[1];
+            return () => julia.escapeItersJulia(0.0137, -0.0042, 2000);
+        });
+
+        kernelCase('julia.computeReferenceOrbit', id, () => {
+            julia.c[0] = c[0];
+            julia.c[1] = c[1];
+            julia.refZ0[0] = 0.0137;
+            julia.refZ0[1] = -0.0042;
+            return () => julia.computeReferenceOrbit();
+        });
+    }
+
+    for (const t of T_VALUES) {
+        const label = `t=${t}`;
+        // 500 terms matches the overlay default (renderer.seriesTerms)
+        kernelCase('zetaPathOverlay.zeta', label, () => () => zetaEta([0.5, t], 500));
+        kernelCase('zetaPathOverlayRS.zeta', label, () => () => zetaRS([0.5, t]));
+        kernelCase('zetaPathOverlayRS.Z', label, () => () => Z(t));
+        kernelCase('zetaPathOverlayRS.theta', label, () => () => theta(t));
+    }
+});
@@ -0,0 +1,124 @@
+/**
+ * @module Microbench
+ * @author Radim Brnka
+ * @description Minimal statistics-first microbenchmark runner for the CPU kernels. Each case is calibrated so one
+ * sample lasts a fixed time, warmed up, then sampled repeatedly on the real monotonic clock. Reports median ns/op,
+ * median absolute deviation and ops/s, which are robust against the occasional GC pause or scheduler hiccup.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {realNow} from './benchHarness';
+
+/** Default run parameters (override per case or via BENCH_SAMPLES / BENCH_SAMPLE_MS) */
+export const DEFAULTS = {
+    warmupMs: 250,
+    samples: Number(process.env.BENCH_SAMPLES) || 40,
+    sampleMs: Number(process.env.BENCH_SAMPLE_MS) || 25,
+};
+
+/**
+ * Keeps results observable so the JIT cannot drop the benchmarked call as dead code.
+ * @type {{value: *}}
+ */
+const sink = {value: 0};
+
+/**
+ * @param {number[]} sorted Ascending
+ * @returns {number}
+ */
+export function median(sorted) {
+    const n = sorted.length;
+    if (n === 0) return NaN;
+    const mid = n >> 1;
+    return n % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+}
+
+/**
+ * Median absolute deviation from the median.
+ * @param {number[]} values
+ * @param {number} med
+ * @returns {number}
+ */
+export function mad(values, med) {
+    return median(values.map(v => Math.abs(v - med)).sort((a, b) => a - b));
+}
+
+/**
+ * Runs fn `ops` times and returns the elapsed ms.
+ * @param {function(): *} fn
+ * @param {number} ops
+ * @returns {number}
+ */
+function timeBatch(fn, ops) {
+    let last;
+    const t0 = realNow();
+    for (let i = 0; i < ops; i++) last = fn();
+    const ms = realNow() - t0;
+    sink.value = last;
+    return ms;
+}
+
+/**
+ * Doubles the batch size until one batch takes at least sampleMs.
+ * @param {function(): *} fn
+ * @param {number} sampleMs
+ * @returns {number} Operations per sample
+ */
+function calibrate(fn, sampleMs) {
+    let ops = 1;
+    for (; ;) {
+        const ms = timeBatch(fn, ops);
+        if (ms >= sampleMs || ops >= 1 << 30) {
+            return Math.max(1, Math.ceil(ops * sampleMs / Math.max(ms, 1e-6)));
+        }
+        ops *= ms > 0 ? Math.min(16, Math.max(2, Math.ceil(sampleMs / ms))) : 16;
+    }
+}
+
+/**
+ * Benchmarks one kernel invocation.
+ * @param {function(): *} fn Kernel call with its inputs bound
+ * @param {{warmupMs?: number, samples?: number, sampleMs?: number}} [options]
+ * @returns {{nsPerOp: number, madNs: number, madRel: number, opsPerSec: number, opsPerSample: number, samples: number}}
+ */
+export function measure(fn, options = {}) {
+    const {warmupMs, samples, sampleMs} = {...DEFAULTS, ...options};
+
+    const ops = calibrate(fn, sampleMs);
+    const warmupEnd = realNow() + warmupMs;
+    while (realNow() < warmupEnd) timeBatch(fn, ops);
+
+    const ns = new Array(samples);
+    for (let i = 0; i < samples; i++) ns[i] = (timeBatch(fn, ops) * 1e6) / ops;
+    ns.sort((a, b) => a - b);
+
+    const med = median(ns);
+    const dev = mad(ns, med);
+    return {
+        nsPerOp: round(med),
+        madNs: round(dev),
+        madRel: round(dev / med),
+        opsPerSec: Math.round(1e9 / med),
+        opsPerSample: ops,
+        samples,
+    };
+}
+
+const round = (v) => Number.isFinite(v) ? Math.round(v * 1000) / 1000 : null;
+
+/**
+ * Formats results as an aligned text table.
+ * @param {Object<string, Object<string, {nsPerOp: number, madRel: number, opsPerSec: number}>>} kernels
+ * @returns {string}
+ */
+export function formatTable(kernels) {
+    const rows = [['kernel', 'input', 'ns/op', '±MAD', 'ops/s']];
+    for (const [kernel, inputs] of Object.entries(kernels)) {
+        for (const [input, r] of Object.entries(inputs)) {
+            rows.push([kernel, input, r.nsPerOp.toFixed(1), `${(r.madRel * 100).toFixed(1)}%`, r.opsPerSec.toLocaleString('en-US')]);
+        }
+    }
+    const widths = rows[0].map((_, c) => Math.max(...rows.map(r => r[c].length)));
+    return rows.map(r => r.map((cell, c) => c < 2 ? cell.padEnd(widths[c]) : cell.padStart(widths[c])).join('  ')).join('\n');
+}
@@ -0,0 +1,163 @@
+/**
+ * @jest-environment jsdom
+ */
+// src/bench/tourReplay.bench.js
+// Deterministic headless tour replay. Drives every renderer through scripted tours on a virtual clock and writes
+// CPU-side costs to bench/report.json; compares against bench/baseline.json when present.
+//
+//   npm run bench                              run and compare (fails on regressions)
+//   BENCH_UPDATE_BASELINE=1 npm run bench      run and store the result as the new baseline
+//
+// Environment: BENCH_TOLERANCE (relative, default 0.15), BENCH_FILTER (substring of scenario names).
+
+import {installGLStub} from './glStub';
+import {findRegressions, FRAME_MS, installVirtualClock, measureScenario, readJSON, writeJSON} from './benchHarness';
+
+jest.mock('../ui/ui', () => global.mockUIModule);
+jest.mock('../ui/juliaSlidersController', () => ({
+    updateJuliaSliders: jest.fn(),
+    disableJuliaSliders: jest.fn(),
+    enableJuliaSliders: jest.fn(),
+}));
+
+installGLStub();
+
+const path = require('path');
+
+const ROOT = path.resolve(__dirname, '../..');
+const REPORT_FILE = path.join(ROOT, 'bench/report.json');
+const BASELINE_FILE = path.join(ROOT, 'bench/baseline.json');
+const TOLERANCE = Number(process.env.BENCH_TOLERANCE) || 0.15;
+const FILTER = process.env.BENCH_FILTER || '';
+const UPDATE_BASELINE = process.env.BENCH_UPDATE_BASELINE === '1';
+
+/** Virtual seconds -> frame budget */
+const seconds = (s) => Math.ceil((s * 1000) / FRAME_MS);
+
+const report = {
+    version: 1,
+    createdAt: null,
+    node: process.version,
+    frameMs: FRAME_MS,
+    scenarios: {},
+};
+
+/**
+ * Registers one scenario. The renderer is created fresh per scenario so caches don't leak between them.
+ * @param {string} name
+ * @param {function(): FractalRenderer} createRenderer
+ * @param {function(FractalRenderer): Promise<*>} script
+ * @param {number} maxFrames
+ */
+function scenario(name, createRenderer, script, maxFrames) {
+    const run = FILTER && !name.includes(FILTER) ? test.skip : test;
+    run(name, async () => {
+        const canvas = document.createElement('canvas');
+        canvas.width = 1280;
+        canvas.height = 720;
+        document.body.appendChild(canvas);
+
+        const renderer = createRenderer(canvas);
+        // Sizing is constant in the benchmark; skip DOM measurement
+        renderer.resizeCanvas = () => {};
+        renderer.adaptiveQualityEnabled = false;
+
+        report.scenarios[name] = await measureScenario(renderer, () => script(renderer), maxFrames);
+
+        renderer.stopDemo?.();
+        renderer.stopZeroTour?.();
+        renderer.destroy?.();
+        canvas.remove();
+    }, 10 * 60 * 1000);
+}
+
+// The renderer modules must be loaded after the mocks above are registered
+const {default: MandelbrotRenderer} = require('../renderers/mandelbrotRenderer');
+const {JuliaRenderer} = require('../renderers/juliaRenderer');
+const {default: RiemannRenderer} = require('../renderers/riemannRenderer');
+const {RosslerRenderer} = require('../renderers/RosslerRenderer');
+const axesOverlay = require('../ui/axesOverlay');
+const zetaPathOverlay = require('../ui/zetaPathOverlay');
+
+const mandelbrotData = require('../data/mandelbrot.json');
+const juliaData = require('../data/julia.json');
+const rosslerData = require('../data/rossler.json');
+
+describe('Tour replay benchmark', () => {
+    beforeAll(() => installVirtualClock(20260101));
+
+    afterAll(() => {
+        jest.useRealTimers();
+        report.createdAt = new Date().toISOString();
+        writeJSON(REPORT_FILE, report);
+
+        if (UPDATE_BASELINE) {
+            writeJSON(BASELINE_FILE, report);
+            process.stdout.write(`Benchmark baseline updated: ${BASELINE_FILE}\n`);
+        }
+    });
+
+    // Every view in mandelbrot.json, perturbation and series shaders (series adds the coefficient pass)
+    for (const shader of ['perturbation', 'series']) {
+        scenario(`mandelbrot/views/${shader}`, (canvas) => {
+            const r = new MandelbrotRenderer(canvas);
+            r.switchShader(shader);
+            return r;
+        }, async (r) => {
+            for (const view of mandelbrotData.views) {
+                await r.animateTravelToPreset(view, 2000, 500, 1500);
+            }
+        }, seconds(mandelbrotData.views.length * 4.5));
+    }
+
+    // Every Julia view, then every dive for a fixed virtual time (dives never end on their own)
+    scenario('julia/views', (canvas) => new JuliaRenderer(canvas), async (r) => {
+        for (const view of juliaData.views) {
+            await r.animateTravelToPreset(view, 1500);
+        }
+    }, seconds(juliaData.views.length * 2));
+
+    for (const dive of juliaData.dives) {
+        scenario(`julia/dive/${dive.id}`, (canvas) => new JuliaRenderer(canvas), async (r) => {
+            await r.animateToZoomAndC(r.DEFAULT_ZOOM, dive.startC, 1500);
+            await Promise.race([
+                Promise.all([
+                    r.animateDive({...dive}),
+                    r.animatePanZoomRotationTo(dive.pan, dive.zoom, dive.rotation, 1500),
+                ]),
+                new Promise(resolve => setTimeout(resolve, 8000)),
+            ]);
+        }, seconds(10));
+    }
+
+    // Riemann zero tour with both overlays attached (as riemannControls wires them)
+    scenario('riemann/zeroTour', (canvas) => {
+        const r = new RiemannRenderer(canvas);
+        axesOverlay.init(r);
+        zetaPathOverlay.init(r);
+        axesOverlay.show();
+        zetaPathOverlay.show();
+        r.onDrawCallback = () => {
+            axesOverlay.update();
+            zetaPathOverlay.update();
+        };
+        return r;
+    }, (r) => r.animateZeroTour(null, 1000), seconds(400));
+
+    scenario('rossler/views', (canvas) => new RosslerRenderer(canvas), async (r) => {
+        for (const view of rosslerData.views) {
+            await r.animateTravelToPreset(view, 2000, 1000, 3500);
+        }
+    }, seconds(rosslerData.views.length * 7));
+
+    test('no regressions against baseline', () => {
+        const baseline = readJSON(BASELINE_FILE);
+        if (!baseline || UPDATE_BASELINE) return;
+
+        const regressions = findRegressions(report, baseline, TOLERANCE);
+        for (const r of regressions) {
+            process.stdout.write(`REGRESSION ${r.scenario}: ${r.baseline} -> ${r.current} ms/draw (x${r.ratio})\n`);
+        }
+        expect(regressions).toEqual([]);
+    });
+});
@@ -0,0 +1,15 @@
+// src/config/jest.bench.config.js
+// Headless benchmarks: npm run bench runs the tour replay, npm run bench:kernels the kernel microbenchmarks. Shares
+// transforms and mocks with the unit test config.
+const base = require('./jest.config');
+
+module.exports = {
+    ...base,
+
+    roots: ['<rootDir>/src/bench'],
+    testMatch: ['**/*.bench.js'],
+
+    // Scenarios are timed; run them serially and show the runner output
+    maxWorkers: 1,
+    silent: false,
+};
@@ -23,6 +23,7 @@ const mockWebGLContext = {
     linkProgram: jest.fn(),
     getProgramParameter: jest.fn(() => true),
     createBuffer: jest.fn(() => ({})),
+    deleteBuffer: jest.fn(),
     bindBuffer: jest.fn(),
     bufferData: jest.fn(),
     enableVertexAttribArray: jest.fn(),
@@ -179,6 +180,7 @@ global.createMockFractalApp = (canvas = null) => {
             fractalApp.pan[1] = panDD.y.hi + panDD.y.lo;
         }),
 
+        getPanCoordinates: jest.fn(() => [...fractalApp.pan]),
         screenToFractal: jest.fn((x, y) => [x / 100, y / 100]),
         screenToViewVector: jest.fn((x, y) => {
             // Simulate view vector calculation
@@ -261,6 +263,8 @@ global.createMockUI = () => {
 
         // Screenshots and dialogs
         captureScreenshot: jest.fn(),
+        showPosterDialog: jest.fn(),
+        showVideoDialog: jest.fn(),
         showSaveViewDialog: jest.fn(),
         showEditCoordsDialog: jest.fn(),
         copyInfoToClipboard: jest.fn(),
@@ -0,0 +1,68 @@
+// src/config/precompressPlugin.js
+/**
+ * Webpack plugin emitting Brotli (.br) and gzip (.gz) siblings of the text assets at maximum compression, so the
+ * server (.htaccess) can send them as they are instead of compressing on the fly, typically at a low level or not at
+ * all. A variant is only kept when it is actually smaller than the original.
+ */
+const zlib = require('zlib');
+
+const PLUGIN_NAME = 'PrecompressPlugin';
+/** Assets worth compressing */
+const DEFAULT_TEST = /\.(js|css|json|html)$/;
+/** Smaller assets are not worth a second request path */
+const DEFAULT_MIN_SIZE = 1024;
+
+class PrecompressPlugin {
+
+    /**
+     * @param {{test?: RegExp, minSize?: number}} [options]
+     */
+    constructor(options = {}) {
+        this.test = options.test || DEFAULT_TEST;
+        this.minSize = options.minSize ?? DEFAULT_MIN_SIZE;
+    }
+
+    apply(compiler) {
+        const {Compilation, sources} = compiler.webpack;
+
+        compiler.hooks.thisCompilation.tap(PLUGIN_NAME, (compilation) => {
+            // Runs on the final bytes: after minification, HTML generation and the service worker manifest
+            compilation.hooks.processAssets.tapPromise({
+                name: PLUGIN_NAME,
+                stage: Compilation.PROCESS_ASSETS_STAGE_OPTIMIZE_TRANSFER
+            }, async () => {
+                const assets = compilation.getAssets().filter(asset => this.test.test(asset.name));
+
+                await Promise.all(assets.map(async ({name, source}) => {
+                    const input = source.buffer();
+                    if (input.length < this.minSize) return;
+
+                    const [br, gz] = await Promise.all([
+                        compress(zlib.brotliCompress, input, {
+                            params: {
+                                [zlib.constants.BROTLI_PARAM_MODE]: zlib.constants.BROTLI_MODE_TEXT,
+                                [zlib.constants.BROTLI_PARAM_QUALITY]: zlib.constants.BROTLI_MAX_QUALITY,
+                                [zlib.constants.BROTLI_PARAM_SIZE_HINT]: input.length
+                            }
+                        }),
+                        compress(zlib.gzip, input, {level: zlib.constants.Z_BEST_COMPRESSION})
+                    ]);
+
+                    for (const [extension, output] of [['br', br], ['gz', gz]]) {
+                        if (output.length < input.length) {
+                            compilation.emitAsset(`${name}.${extension}`, new sources.RawSource(output), {compressed: true});
+                        }
+                    }
+                }));
+            });
+        });
+    }
+}
+
+function compress(method, input, options) {
+    return new Promise((resolve, reject) => {
+        method(input, options, (error, output) => error ? reject(error) : resolve(output));
+    });
+}
+
+module.exports = PrecompressPlugin;
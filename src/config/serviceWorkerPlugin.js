@@ -0,0 +1,58 @@
+// src/config/serviceWorkerPlugin.js
+/**
+ * Webpack plugin emitting the service worker (src/sw.js) with the precache manifest of the build.
+ * Precached are the assets of the initial load (entry bundle, CSS, images, web manifest); on-demand mode chunks,
+ * source maps, the page and the tour audio are left to the worker's runtime caching. The cache version is a hash of
+ * the manifest, so a build that changes any precached asset replaces the cache on the next visit.
+ */
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+
+const PLUGIN_NAME = 'ServiceWorkerPlugin';
+/** Assets never precached: the page (revalidated), server and crawler files, source maps, precompressed variants */
+const EXCLUDED = /(^|\/)(index\.html|\.htaccess|robots\.txt|sitemap\.xml)$|\.(map|br|gz|LICENSE\.txt)$|^audio\//;
+
+class ServiceWorkerPlugin {
+
+    /**
+     * @param {{template: string, filename?: string}} options
+     */
+    constructor(options) {
+        this.template = options.template;
+        this.filename = options.filename || 'sw.js';
+    }
+
+    apply(compiler) {
+        const {Compilation, sources} = compiler.webpack;
+
+        compiler.hooks.thisCompilation.tap(PLUGIN_NAME, (compilation) => {
+            compilation.fileDependencies.add(this.template);
+
+            // After minification and HTML generation, before compression of the emitted assets
+            compilation.hooks.processAssets.tap({name: PLUGIN_NAME, stage: Compilation.PROCESS_ASSETS_STAGE_SUMMARIZE}, () => {
+                const onDemand = new Set();
+                for (const chunk of compilation.chunks) {
+                    if (!chunk.canBeInitial()) chunk.files.forEach(file => onDemand.add(file));
+                }
+
+                const manifest = compilation.getAssets()
+                    .map(asset => asset.name)
+                    .filter(name => name !== this.filename && !onDemand.has(name) && !EXCLUDED.test(name))
+                    .sort();
+
+                const version = crypto.createHash('sha256');
+                for (const name of manifest) {
+                    version.update(name).update(compilation.getAsset(name).source.buffer());
+                }
+
+                const source = fs.readFileSync(path.resolve(this.template), 'utf8')
+                    .replace('__PRECACHE_MANIFEST__', JSON.stringify(manifest))
+                    .replace('__CACHE_VERSION__', JSON.stringify(version.digest('hex').slice(0, 16)));
+                compilation.emitAsset(this.filename, new sources.RawSource(source));
+            });
+        });
+    }
+}
+
+module.exports = ServiceWorkerPlugin;
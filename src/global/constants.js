@@ -116,6 +116,13 @@ export const FF_ROSSLER_COLOR_SLIDERS = false;
  */
 export const FF_HOTKEY_HINTS = true;
 
+/**
+ * Serves Riemann views from a quadtree tile cache: tiles of the domain colouring are kept in a GPU atlas and reused
+ * while panning and zooming, so only newly exposed areas run the zeta kernel.
+ * @type {boolean}
+ */
+export const FF_TILE_CACHE = true;
+
 /**
  * When enabled, the app name will be randomly generated based on APP.suffixes
  * @type {boolean}
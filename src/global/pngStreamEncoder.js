@@ -0,0 +1,194 @@
+/**
+ * @module PNGStreamEncoder
+ * @author Radim Brnka
+ * @description Streaming PNG encoder (8-bit RGB). Rows are filtered and pushed through a zlib CompressionStream as
+ * they arrive; compressed output is wrapped into IDAT chunks and handed to a sink immediately, so neither the raw nor
+ * the encoded image has to be held in memory. Used by the poster export.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+const SIGNATURE = new Uint8Array([0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A]);
+/** Compressed bytes gathered before an IDAT chunk is emitted */
+const IDAT_SIZE = 256 * 1024;
+/** PNG row filter "Sub": each byte minus the same channel of the previous pixel */
+const FILTER_SUB = 1;
+
+/**
+ * @typedef {Object} ByteSink
+ * @property {function(Uint8Array): (Promise<void>|void)} write
+ * @property {function(): (Promise<void>|void)} close
+ * @property {function(): (Promise<void>|void)} [abort]
+ */
+
+// region > CRC --------------------------------------------------------------------------------------------------------
+
+const CRC_TABLE = (() => {
+    const table = new Uint32Array(256);
+    for (let n = 0; n < 256; n++) {
+        let c = n;
+        for (let k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320 ^ (c >>> 1)) : (c >>> 1);
+        table[n] = c >>> 0;
+    }
+    return table;
+})();
+
+/**
+ * Continues a CRC-32 over bytes. Start with 0xFFFFFFFF and xor the result with 0xFFFFFFFF.
+ * @param {number} crc
+ * @param {Uint8Array} bytes
+ * @returns {number}
+ */
+function crcUpdate(crc, bytes) {
+    for (let i = 0; i < bytes.length; i++) crc = CRC_TABLE[(crc ^ bytes[i]) & 0xFF] ^ (crc >>> 8);
+    return crc >>> 0;
+}
+
+/**
+ * @param {Uint8Array} bytes
+ * @returns {number} CRC-32 of the bytes
+ */
+export const crc32 = (bytes) => (crcUpdate(0xFFFFFFFF, bytes) ^ 0xFFFFFFFF) >>> 0;
+
+/**
+ * Builds one PNG chunk (length, type, data, CRC over type + data).
+ * @param {string} type Four ASCII characters
+ * @param {Uint8Array} data
+ * @returns {Uint8Array}
+ */
+export function pngChunk(type, data) {
+    const out = new Uint8Array(12 + data.length);
+    const view = new DataView(out.buffer);
+    view.setUint32(0, data.length);
+    for (let i = 0; i < 4; i++) out[4 + i] = type.charCodeAt(i);
+    out.set(data, 8);
+    view.setUint32(8 + data.length, crc32(out.subarray(4, 8 + data.length)));
+    return out;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+
+export class PNGStreamEncoder {
+
+    /**
+     * @param {number} width
+     * @param {number} height
+     * @param {ByteSink} sink
+     * @param {Object} [options]
+     * @param {Object<string, string>} [options.text] Latin-1 tEXt entries (keyword -> value)
+     * @param {function(): CompressionStream} [options.createCompressor] zlib ("deflate") compression stream factory
+     */
+    constructor(width, height, sink, options = {}) {
+        this.width = width;
+        this.height = height;
+        this.sink = sink;
+        this.text = options.text || {};
+        this.createCompressor = options.createCompressor || (() => new CompressionStream('deflate'));
+
+        this.rowsWritten = 0;
+        this.writer = null;
+        this.pump = null;
+        this.pending = [];
+        this.pendingBytes = 0;
+    }
+
+    /** Writes the header chunks and opens the compressed image stream. */
+    async start() {
+        const ihdr = new Uint8Array(13);
+        const view = new DataView(ihdr.buffer);
+        view.setUint32(0, this.width);
+        view.setUint32(4, this.height);
+        ihdr[8] = 8;  // bit depth
+        ihdr[9] = 2;  // color type: truecolor RGB
+        ihdr[10] = 0; // deflate
+        ihdr[11] = 0; // adaptive filtering
+        ihdr[12] = 0; // no interlace
+
+        await this.sink.write(SIGNATURE);
+        await this.sink.write(pngChunk('IHDR', ihdr));
+
+        for (const [keyword, value] of Object.entries(this.text)) {
+            const bytes = new Uint8Array(keyword.length + 1 + value.length);
+            for (let i = 0; i < keyword.length; i++) bytes[i] = keyword.charCodeAt(i) & 0xFF;
+            for (let i = 0; i < value.length; i++) bytes[keyword.length + 1 + i] = value.charCodeAt(i) & 0xFF;
+            await this.sink.write(pngChunk('tEXt', bytes));
+        }
+
+        const compressor = this.createCompressor();
+        this.writer = compressor.writable.getWriter();
+        this.pump = this.drain(compressor.readable.getReader());
+    }
+
+    /**
+     * Reads compressed output and forwards it as IDAT chunks.
+     * @param {ReadableStreamDefaultReader<Uint8Array>} reader
+     */
+    async drain(reader) {
+        for (; ;) {
+            const {value, done} = await reader.read();
+            if (done) break;
+            this.pending.push(value);
+            this.pendingBytes += value.length;
+            if (this.pendingBytes >= IDAT_SIZE) await this.flushIDAT();
+        }
+        await this.flushIDAT();
+    }
+
+    async flushIDAT() {
+        if (this.pendingBytes === 0) return;
+        const data = new Uint8Array(this.pendingBytes);
+        let offset = 0;
+        for (const part of this.pending) {
+            data.set(part, offset);
+            offset += part.length;
+        }
+        this.pending = [];
+        this.pendingBytes = 0;
+        await this.sink.write(pngChunk('IDAT', data));
+    }
+
+    /**
+     * Appends rows, top to bottom.
+     * @param {Uint8Array} rgb Tightly packed RGB rows (width * 3 bytes each)
+     * @param {number} rows Number of rows to take from the buffer
+     */
+    async writeRows(rgb, rows) {
+        if (this.rowsWritten + rows > this.height) throw new Error('PNGStreamEncoder: too many rows');
+
+        const stride = this.width * 3;
+        const filtered = new Uint8Array(rows * (stride + 1));
+        for (let r = 0; r < rows; r++) {
+            const src = r * stride;
+            const dst = r * (stride + 1);
+            filtered[dst] = FILTER_SUB;
+            for (let i = 0; i < 3; i++) filtered[dst + 1 + i] = rgb[src + i];
+            for (let i = 3; i < stride; i++) filtered[dst + 1 + i] = rgb[src + i] - rgb[src + i - 3];
+        }
+
+        await this.writer.ready;
+        await this.writer.write(filtered);
+        this.rowsWritten += rows;
+    }
+
+    /** Closes the image stream and writes the trailer. */
+    async finish() {
+        if (this.rowsWritten !== this.height) {
+            throw new Error(`PNGStreamEncoder: ${this.rowsWritten} of ${this.height} rows written`);
+        }
+        await this.writer.close();
+        await this.pump;
+        await this.sink.write(pngChunk('IEND', new Uint8Array(0)));
+        await this.sink.close();
+    }
+
+    /** Abandons the image; the sink discards what it received. */
+    async abort() {
+        try {
+            await this.writer?.abort();
+        } catch (e) {
+            // Stream already errored
+        }
+        await this.pump?.catch(() => {});
+        await this.sink.abort?.();
+    }
+}
@@ -0,0 +1,314 @@
+/**
+ * @module Profiler
+ * @author Radim Brnka
+ * @description Per-stage frame profiler. CPU stages are bracketed with begin()/end(), GPU draw time is measured
+ * through a ring of EXT_disjoint_timer_query objects so every draw gets its own query even while older results are
+ * still in flight. Samples feed per-stage percentile windows and a bounded trace buffer exportable in the
+ * chrome://tracing (Trace Event Format) JSON layout. Disabled (no-op) until the debug panel enables it.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/** Samples kept per stage for percentile computation */
+const STAGE_WINDOW = 240;
+/** Complete trace events kept for export (oldest dropped first) */
+const TRACE_CAPACITY = 8192;
+/** GPU timer queries that can be in flight at once */
+const GPU_QUERY_RING = 8;
+/** Trace thread ids (chrome://tracing renders each as its own row) */
+const TID_CPU = 1;
+const TID_GPU = 2;
+
+/** Fixed-size sample window for one stage */
+class StageStats {
+    constructor(name) {
+        this.name = name;
+        this.samples = new Float64Array(STAGE_WINDOW);
+        this.count = 0;
+        this.head = 0;
+        this.last = NaN;
+        this.total = 0;
+    }
+
+    push(ms) {
+        this.samples[this.head] = ms;
+        this.head = (this.head + 1) % STAGE_WINDOW;
+        if (this.count < STAGE_WINDOW) this.count++;
+        this.last = ms;
+        this.total++;
+    }
+
+    /**
+     * @param {number[]} ps Percentiles in 0..100
+     * @returns {number[]} Values (ms) in the same order, NaN when empty
+     */
+    percentiles(ps) {
+        if (this.count === 0) return ps.map(() => NaN);
+        const sorted = Float64Array.from(this.samples.subarray(0, this.count)).sort();
+        return ps.map(p => {
+            const idx = Math.min(this.count - 1, Math.max(0, Math.ceil((p / 100) * this.count) - 1));
+            return sorted[idx];
+        });
+    }
+
+    /**
+     * Buckets the window into a log2 histogram (bucket i holds samples in [2^(i-1), 2^i) ms, bucket 0 is < 1 ms).
+     * @param {number} [buckets]
+     * @returns {number[]}
+     */
+    histogram(buckets = 8) {
+        const out = new Array(buckets).fill(0);
+        for (let i = 0; i < this.count; i++) {
+            const ms = this.samples[i];
+            const b = ms < 1 ? 0 : Math.min(buckets - 1, Math.floor(Math.log2(ms)) + 1);
+            out[b]++;
+        }
+        return out;
+    }
+}
+
+class Profiler {
+    constructor() {
+        this.enabled = false;
+        /** Time source in ms; replaceable for headless runs where performance.now() is virtualized */
+        this.now = () => performance.now();
+        /** @type {Map<string, StageStats>} */
+        this.stages = new Map();
+        /** @type {Array<{name: string, t0: number}>} */
+        this.stack = [];
+
+        this.trace = new Array(TRACE_CAPACITY);
+        this.traceHead = 0;
+        this.traceCount = 0;
+        this.epoch = performance.now();
+
+        this.gl = null;
+        this.extTimer = null;
+        /** Ring of timer queries, each slot: {query, submitTs, busy} */
+        this.gpuRing = [];
+        this.gpuRingHead = 0;
+        this.gpuActive = null;
+        this.gpuDisjoint = false;
+        this.gpuDropped = 0;
+        /** Callback invoked with each resolved GPU duration (ms) */
+        this.onGpuSample = null;
+    }
+
+    /**
+     * Turns the profiler on and attaches it to a WebGL context (for GPU timer queries).
+     * @param {WebGLRenderingContext|null} gl
+     */
+    enable(gl) {
+        this.enabled = true;
+        this.setGL(gl);
+    }
+
+    disable() {
+        this.enabled = false;
+        this.stack.length = 0;
+        this.setGL(null);
+    }
+
+    /**
+     * Re-targets GPU timing at a new context. Pending queries of the old one are dropped.
+     * @param {WebGLRenderingContext|null} gl
+     */
+    setGL(gl) {
+        if (gl === this.gl) return;
+        this._releaseQueries();
+        this.gl = gl || null;
+        this.extTimer = gl?.getExtension?.("EXT_disjoint_timer_query") ||
+            gl?.getExtension?.("EXT_disjoint_timer_query_webgl2") || null;
+    }
+
+    /** @returns {boolean} True when GPU timing is available */
+    get gpuSupported() {
+        return !!this.extTimer;
+    }
+
+    // region > CPU STAGES ---------------------------------------------------------------------------------------------
+
+    /**
+     * Opens a CPU stage. Stages nest; every begin() must be paired with end().
+     * @param {string} name
+     */
+    begin(name) {
+        if (!this.enabled) return;
+        this.stack.push({name, t0: this.now()});
+    }
+
+    /** Closes the innermost open stage and records its duration. */
+    end() {
+        if (!this.enabled) return;
+        const open = this.stack.pop();
+        if (!open) return;
+        const t1 = this.now();
+        this.record(open.name, open.t0, t1 - open.t0, TID_CPU);
+    }
+
+    /**
+     * Records a finished interval.
+     * @param {string} name Stage name
+     * @param {number} t0 Start (performance.now() ms)
+     * @param {number} ms Duration
+     * @param {number} [tid]
+     */
+    record(name, t0, ms, tid = TID_CPU) {
+        let stage = this.stages.get(name);
+        if (!stage) {
+            stage = new StageStats(name);
+            this.stages.set(name, stage);
+        }
+        stage.push(ms);
+
+        this.trace[this.traceHead] = {name, ts: t0, dur: ms, tid, depth: this.stack.length};
+        this.traceHead = (this.traceHead + 1) % TRACE_CAPACITY;
+        if (this.traceCount < TRACE_CAPACITY) this.traceCount++;
+    }
+
+    // endregion--------------------------------------------------------------------------------------------------------
+    // region > GPU TIMER RING -----------------------------------------------------------------------------------------
+
+    /** Starts timing the GPU work of the following draw call. */
+    beginGpu() {
+        if (!this.enabled || !this.extTimer || this.gpuActive) return;
+
+        if (this.gpuRing.length < GPU_QUERY_RING) {
+            this.gpuRing.push({query: this.extTimer.createQueryEXT(), submitTs: 0, busy: false});
+        }
+
+        const slot = this.gpuRing[this.gpuRingHead];
+        if (slot.busy) {
+            // Ring full of unresolved results; skip rather than stall on readback
+            this.gpuDropped++;
+            return;
+        }
+
+        this.gpuRingHead = (this.gpuRingHead + 1) % GPU_QUERY_RING;
+        slot.submitTs = this.now();
+        this.extTimer.beginQueryEXT(this.extTimer.TIME_ELAPSED_EXT, slot.query);
+        this.gpuActive = slot;
+    }
+
+    endGpu() {
+        if (!this.gpuActive || !this.extTimer) return;
+        this.extTimer.endQueryEXT(this.extTimer.TIME_ELAPSED_EXT);
+        this.gpuActive.busy = true;
+        this.gpuActive = null;
+    }
+
+    /**
+     * Resolves all finished queries in submission order without blocking.
+     * @returns {number} Number of resolved samples
+     */
+    pollGpu() {
+        if (!this.extTimer || !this.gl || this.gpuRing.length === 0) return 0;
+
+        // disjoint means the results are unreliable (clock reset / driver event)
+        this.gpuDisjoint = !!this.gl.getParameter(this.extTimer.GPU_DISJOINT_EXT);
+
+        const n = this.gpuRing.length;
+        // Oldest submitted slot is the one the head will reuse next
+        let resolved = 0;
+        for (let i = 0; i < n; i++) {
+            const slot = this.gpuRing[(this.gpuRingHead + i) % n];
+            if (!slot.busy) continue;
+
+            const available = this.extTimer.getQueryObjectEXT(slot.query, this.extTimer.QUERY_RESULT_AVAILABLE_EXT);
+            if (!available) break; // later queries cannot be ready before earlier ones
+
+            const ns = this.extTimer.getQueryObjectEXT(slot.query, this.extTimer.QUERY_RESULT_EXT);
+            slot.busy = false;
+            resolved++;
+
+            if (this.gpuDisjoint) continue;
+            const ms = ns / 1e6;
+            this.record('gpu', slot.submitTs, ms, TID_GPU);
+            this.onGpuSample?.(ms);
+        }
+        return resolved;
+    }
+
+    _releaseQueries() {
+        if (this.extTimer) {
+            if (this.gpuActive) this.extTimer.endQueryEXT(this.extTimer.TIME_ELAPSED_EXT);
+            for (const slot of this.gpuRing) this.extTimer.deleteQueryEXT(slot.query);
+        }
+        this.gpuRing = [];
+        this.gpuRingHead = 0;
+        this.gpuActive = null;
+    }
+
+    // endregion--------------------------------------------------------------------------------------------------------
+    // region > REPORTING ----------------------------------------------------------------------------------------------
+
+    /**
+     * Percentile summary of every stage, sorted by p95 (slowest first).
+     * @returns {Array<{name: string, count: number, last: number, p50: number, p95: number, p99: number, max: number, histogram: number[]}>}
+     */
+    summary() {
+        const rows = [];
+        for (const stage of this.stages.values()) {
+            const [p50, p95, p99, max] = stage.percentiles([50, 95, 99, 100]);
+            rows.push({name: stage.name, count: stage.total, last: stage.last, p50, p95, p99, max, histogram: stage.histogram()});
+        }
+        return rows.sort((a, b) => b.p95 - a.p95);
+    }
+
+    /**
+     * Builds a Trace Event Format document loadable in chrome://tracing or Perfetto.
+     * @returns {{traceEvents: Object[], displayTimeUnit: string, otherData: Object}}
+     */
+    toChromeTrace() {
+        const events = [
+            {name: 'process_name', ph: 'M', pid: 1, tid: TID_CPU, args: {name: 'Fractal Traveler'}},
+            {name: 'thread_name', ph: 'M', pid: 1, tid: TID_CPU, args: {name: 'CPU (main)'}},
+            {name: 'thread_name', ph: 'M', pid: 1, tid: TID_GPU, args: {name: 'GPU (timer query)'}},
+        ];
+
+        const start = (this.traceHead - this.traceCount + TRACE_CAPACITY) % TRACE_CAPACITY;
+        for (let i = 0; i < this.traceCount; i++) {
+            const e = this.trace[(start + i) % TRACE_CAPACITY];
+            events.push({
+                name: e.name,
+                cat: e.tid === TID_GPU ? 'gpu' : 'cpu',
+                ph: 'X',
+                pid: 1,
+                tid: e.tid,
+                // Trace Event Format uses microseconds
+                ts: Math.round((e.ts - this.epoch) * 1000),
+                dur: Math.max(1, Math.round(e.dur * 1000)),
+            });
+        }
+
+        return {
+            traceEvents: events,
+            displayTimeUnit: 'ms',
+            otherData: {gpuSupported: this.gpuSupported, gpuDropped: this.gpuDropped},
+        };
+    }
+
+    /** Clears all recorded samples and trace events. */
+    reset() {
+        this.stages.clear();
+        this.stack.length = 0;
+        this.traceHead = 0;
+        this.traceCount = 0;
+        this.gpuDropped = 0;
+        this.epoch = this.now();
+    }
+
+    /**
+     * Replaces the time source (ms). Used by the headless benchmark, which fakes performance.now().
+     * @param {function(): number} now
+     */
+    setClock(now) {
+        this.now = now;
+        this.reset();
+    }
+
+    // endregion--------------------------------------------------------------------------------------------------------
+}
+
+/** Shared profiler instance */
+export const profiler = new Profiler();
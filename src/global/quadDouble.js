@@ -0,0 +1,515 @@
+/**
+ * @module QuadDouble
+ * @author Radim Brnka
+ * @description Quad-double view coordinates (~64 significant digits) for the pan state. A value is a Float64Array(4)
+ * of non-overlapping limbs in decreasing magnitude, so q[0] alone is the nearest double. Arithmetic is exact
+ * expansion arithmetic (Shewchuk) on module-level scratch buffers and allocates nothing; values with a single limb
+ * (every shallow view) take a plain two-sum fast path. Decimal conversion (URLs, presets) goes through BigInt and is
+ * exact, but it is not meant for per-frame use.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/** Veltkamp-Dekker splitting constant for error-free products: 2^27 + 1 */
+const SPLITTER = 134217729;
+
+// Expansion scratch: components in increasing magnitude, zeros eliminated
+const EXP = new Float64Array(24);
+const EXP_SCALED = new Float64Array(8);
+
+// Results of the error-free transformations (module-level to avoid returning objects)
+let sum = 0;
+let err = 0;
+
+/**
+ * Error-free a + b into (sum, err).
+ * @param {number} a
+ * @param {number} b
+ */
+function twoSum(a, b) {
+    sum = a + b;
+    const bb = sum - a;
+    err = (a - (sum - bb)) + (b - bb);
+}
+
+/**
+ * Error-free a * b into (sum, err) (Dekker product).
+ * @param {number} a
+ * @param {number} b
+ */
+function twoProduct(a, b) {
+    sum = a * b;
+    let c = SPLITTER * a;
+    const aHi = c - (c - a);
+    const aLo = a - aHi;
+    c = SPLITTER * b;
+    const bHi = c - (c - b);
+    const bLo = b - bHi;
+    err = aLo * bLo - (((sum - aHi * bHi) - aLo * bHi) - aHi * bLo);
+}
+
+// region > EXPANSIONS -------------------------------------------------------------------------------------------------
+
+/**
+ * Copies the non-zero limbs of a quad-double into an expansion buffer (increasing magnitude).
+ * @param {Float64Array} q
+ * @param {Float64Array} buffer
+ * @returns {number} Expansion length
+ */
+function load(q, buffer) {
+    let length = 0;
+    for (let i = 3; i >= 0; i--) {
+        if (q[i] !== 0) buffer[length++] = q[i];
+    }
+    return length;
+}
+
+/**
+ * Adds a double to an expansion in place (Shewchuk's GROW-EXPANSION with zero elimination).
+ * @param {Float64Array} buffer
+ * @param {number} length
+ * @param {number} b
+ * @returns {number} New length
+ */
+function grow(buffer, length, b) {
+    let q = b;
+    let out = 0;
+    for (let i = 0; i < length; i++) {
+        twoSum(q, buffer[i]);
+        q = sum;
+        if (err !== 0) buffer[out++] = err;
+    }
+    if (q !== 0 || out === 0) buffer[out++] = q;
+    return out;
+}
+
+/**
+ * Compresses an expansion in place (Shewchuk's COMPRESS), so its largest component approximates its value.
+ * @param {Float64Array} buffer
+ * @param {number} length
+ * @returns {number} New length
+ */
+function compress(buffer, length) {
+    if (length < 2) return length;
+
+    let bottom = length - 1;
+    let q = buffer[bottom];
+    for (let i = length - 2; i >= 0; i--) {
+        const now = buffer[i];
+        const qNew = q + now;
+        const small = now - (qNew - q);
+        if (small !== 0) {
+            buffer[bottom--] = qNew;
+            q = small;
+        } else {
+            q = qNew;
+        }
+    }
+
+    let top = 0;
+    for (let i = bottom + 1; i < length; i++) {
+        const now = buffer[i];
+        const qNew = now + q;
+        const small = q - (qNew - now);
+        if (small !== 0) buffer[top++] = small;
+        q = qNew;
+    }
+    buffer[top] = q;
+    return top + 1;
+}
+
+/**
+ * Stores a compressed expansion as a quad-double; components below the fourth limb are folded into it.
+ * @param {Float64Array} buffer
+ * @param {number} length
+ * @param {Float64Array} q
+ * @returns {Float64Array} q
+ */
+function store(buffer, length, q) {
+    q[0] = length > 0 ? buffer[length - 1] : 0;
+    q[1] = length > 1 ? buffer[length - 2] : 0;
+    q[2] = length > 2 ? buffer[length - 3] : 0;
+    let tail = 0;
+    for (let i = 0; i < length - 3; i++) tail += buffer[i];
+    q[3] = tail;
+    return q;
+}
+
+/**
+ * Scales a quad-double by a double into EXP_SCALED (Shewchuk's SCALE-EXPANSION with zero elimination).
+ * @param {Float64Array} q
+ * @param {number} b
+ * @returns {number} Expansion length
+ */
+function scale(q, b) {
+    let length = 0;
+    let acc = 0;
+    let first = true;
+    for (let i = 3; i >= 0; i--) {
+        if (q[i] === 0) continue;
+        twoProduct(q[i], b);
+        if (first) {
+            first = false;
+            acc = sum;
+            if (err !== 0) EXP_SCALED[length++] = err;
+            continue;
+        }
+        const product = sum;
+        twoSum(acc, err);
+        if (err !== 0) EXP_SCALED[length++] = err;
+        const s = sum;
+        acc = product + s;
+        const small = s - (acc - product);
+        if (small !== 0) EXP_SCALED[length++] = small;
+    }
+    if (acc !== 0 || length === 0) EXP_SCALED[length++] = acc;
+    return length;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > ARITHMETIC -------------------------------------------------------------------------------------------------
+
+/**
+ * Creates a quad-double from a double (or a double-double pair).
+ * @param {number} [hi=0]
+ * @param {number} [lo=0]
+ * @returns {Float64Array}
+ */
+export function qdMake(hi = 0, lo = 0) {
+    return qdSet(new Float64Array(4), hi, lo);
+}
+
+/**
+ * Sets a quad-double from a double (or a double-double pair).
+ * @param {Float64Array} q
+ * @param {number} hi
+ * @param {number} [lo=0]
+ * @returns {Float64Array} q
+ */
+export function qdSet(q, hi, lo = 0) {
+    twoSum(hi, lo);
+    q[0] = sum;
+    q[1] = err;
+    q[2] = 0;
+    q[3] = 0;
+    return q;
+}
+
+/**
+ * Copies a quad-double.
+ * @param {Float64Array} target
+ * @param {Float64Array} source
+ * @returns {Float64Array} target
+ */
+export function qdCopy(target, source) {
+    target[0] = source[0];
+    target[1] = source[1];
+    target[2] = source[2];
+    target[3] = source[3];
+    return target;
+}
+
+/**
+ * Nearest double of a quad-double.
+ * @param {Float64Array} q
+ * @returns {number}
+ */
+export const qdValue = (q) => q[0] + (q[1] + (q[2] + q[3]));
+
+/**
+ * Writes the leading double-double of a quad-double into a {hi, lo} object.
+ * @param {Float64Array} q
+ * @param {{hi: number, lo: number}} dd
+ * @returns {{hi: number, lo: number}} dd
+ */
+export function qdToDD(q, dd) {
+    dd.hi = q[0];
+    dd.lo = q[1] + (q[2] + q[3]);
+    return dd;
+}
+
+/**
+ * q += n, in place.
+ * @param {Float64Array} q
+ * @param {number} n
+ * @returns {Float64Array} q
+ */
+export function qdAdd(q, n) {
+    // Single-limb fast path: the sum of two doubles is exactly the two-limb result
+    if (q[1] === 0) {
+        twoSum(q[0], n);
+        q[0] = sum;
+        q[1] = err;
+        return q;
+    }
+
+    let length = load(q, EXP);
+    length = grow(EXP, length, n);
+    return store(EXP, compress(EXP, length), q);
+}
+
+/**
+ * q += b * k, in place (b * k is exact before rounding to the four limbs).
+ * @param {Float64Array} q
+ * @param {Float64Array} b
+ * @param {number} [k=1]
+ * @returns {Float64Array} q
+ */
+export function qdAddScaled(q, b, k = 1) {
+    if (b[1] === 0) {
+        twoProduct(b[0], k);
+        const lo = err;
+        qdAdd(q, sum);
+        return lo !== 0 ? qdAdd(q, lo) : q;
+    }
+
+    const scaled = scale(b, k);
+    let length = load(q, EXP);
+    for (let i = 0; i < scaled; i++) length = grow(EXP, length, EXP_SCALED[i]);
+    return store(EXP, compress(EXP, length), q);
+}
+
+/**
+ * out = a - b.
+ * @param {Float64Array} a
+ * @param {Float64Array} b
+ * @param {Float64Array} out May be a or b.
+ * @returns {Float64Array} out
+ */
+export function qdSubInto(a, b, out) {
+    let length = load(a, EXP);
+    for (let i = 3; i >= 0; i--) {
+        if (b[i] !== 0) length = grow(EXP, length, -b[i]);
+    }
+    return store(EXP, compress(EXP, length), out);
+}
+
+/**
+ * Leading double-double of q - dd into two adjacent slots. This is the per-frame delta between the view centre and a
+ * perturbation reference; it stays exact however deep the view is.
+ * @param {Float64Array} q
+ * @param {{hi: number, lo: number}} dd
+ * @param {Float64Array} out Target array (hi at offset, lo at offset + 1).
+ * @param {number} [offset=0]
+ * @returns {Float64Array} out
+ */
+export function qdSubDDInto(q, dd, out, offset = 0) {
+    // Up to two limbs (shallow and double-double depths): plain DD subtraction
+    if (q[2] === 0) {
+        const s = q[0] - dd.hi;
+        const bb = s - q[0];
+        const lo = q[1] - dd.lo + ((q[0] - (s - bb)) + (-dd.hi - bb));
+        const hi = s + lo;
+        out[offset] = hi;
+        out[offset + 1] = lo - (hi - s);
+        return out;
+    }
+
+    let length = load(q, EXP);
+    if (dd.lo !== 0) length = grow(EXP, length, -dd.lo);
+    length = compress(EXP, grow(EXP, length, -dd.hi));
+
+    out[offset] = EXP[length - 1];
+    let tail = 0;
+    for (let i = 0; i < length - 1; i++) tail += EXP[i];
+    out[offset + 1] = tail;
+    return out;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > DECIMAL CONVERSION -----------------------------------------------------------------------------------------
+
+const BITS = new Float64Array(1);
+const BITS_U64 = new BigUint64Array(BITS.buffer);
+
+/**
+ * Exact decomposition d = m * 2^e.
+ * @param {number} d Finite double
+ * @returns {[bigint, number]} [m, e]
+ */
+function decompose(d) {
+    BITS[0] = d;
+    const bits = BITS_U64[0];
+    const exponent = Number((bits >> 52n) & 0x7ffn);
+    let m = bits & 0xfffffffffffffn;
+    let e = -1074;
+    if (exponent !== 0) {
+        m |= 0x10000000000000n;
+        e = exponent - 1075;
+    }
+    return [bits >> 63n ? -m : m, e];
+}
+
+const bitLength = (n) => n.toString(2).length;
+
+/**
+ * Nearest-ish double of num / den (den > 0); the caller carries the exact remainder.
+ * @param {bigint} num
+ * @param {bigint} den
+ * @returns {number}
+ */
+function rationalToDouble(num, den) {
+    if (num === 0n) return 0;
+    const negative = num < 0n;
+    const n = negative ? -num : num;
+
+    const shift = 64 - (bitLength(n) - bitLength(den));
+    const quotient = shift >= 0 ? (n << BigInt(shift)) / den : n / (den << BigInt(-shift));
+    const value = Number(quotient) * 2 ** -shift;
+    return negative ? -value : value;
+}
+
+/** Decimal number with optional exponent, e.g. "-0.7436438870371587047521915" or "1.25e-40" */
+const DECIMAL = /^\s*([+-]?)(\d*)(?:\.(\d*))?(?:e([+-]?\d+))?\s*$/i;
+
+/**
+ * Parses a decimal string into a quad-double (exact up to the final rounding of each limb).
+ * @param {string} text
+ * @param {Float64Array} [out]
+ * @returns {Float64Array|null} out, or null when the text is not a decimal number
+ */
+export function qdParse(text, out = new Float64Array(4)) {
+    const match = DECIMAL.exec(String(text));
+    if (!match || !(match[2] || match[3])) return null;
+
+    const fraction = match[3] || '';
+    const exponent = Number(match[4] || 0) - fraction.length;
+    let num = BigInt((match[2] || '0') + fraction);
+    if (match[1] === '-') num = -num;
+    let den = 1n;
+    if (exponent >= 0) num *= 10n ** BigInt(exponent);
+    else den = 10n ** BigInt(-exponent);
+
+    // Peel off limbs, keeping the exact remainder as a rational
+    const limbs = [0, 0, 0, 0];
+    for (let i = 0; i < 4 && num !== 0n; i++) {
+        const limb = rationalToDouble(num, den);
+        if (limb === 0 || !Number.isFinite(limb)) break;
+        limbs[i] = limb;
+
+        const [m, e] = decompose(limb);
+        if (e >= 0) {
+            num -= (m << BigInt(e)) * den;
+        } else {
+            num = (num << BigInt(-e)) - m * den;
+            den <<= BigInt(-e);
+        }
+    }
+
+    // Limbs from truncated quotients may overlap slightly; renormalise
+    let length = 0;
+    for (let i = 3; i >= 0; i--) {
+        if (limbs[i] !== 0) length = grow(EXP, length, limbs[i]);
+    }
+    return store(EXP, compress(EXP, length), out);
+}
+
+/**
+ * Formats a quad-double as a decimal string with the given number of significant digits (exact, trailing zeros
+ * trimmed).
+ * @param {Float64Array} q
+ * @param {number} [digits=64]
+ * @returns {string}
+ */
+export function qdToString(q, digits = 64) {
+    if (q[0] === 0) return '0';
+    if (!Number.isFinite(q[0])) return String(q[0]);
+
+    // Exact value N * 2^E
+    let minExponent = Infinity;
+    const parts = [];
+    for (let i = 0; i < 4; i++) {
+        if (q[i] === 0) continue;
+        const [m, e] = decompose(q[i]);
+        parts.push([m, e]);
+        minExponent = Math.min(minExponent, e);
+    }
+    let n = 0n;
+    for (const [m, e] of parts) n += m << BigInt(e - minExponent);
+
+    const negative = n < 0n;
+    if (negative) n = -n;
+
+    const fractionDigits = Math.max(0, digits - 1 - Math.floor(Math.log10(Math.abs(q[0]))));
+    let scaled;
+    if (minExponent >= 0) {
+        scaled = (n << BigInt(minExponent)) * 10n ** BigInt(fractionDigits);
+    } else {
+        const den = 1n << BigInt(-minExponent);
+        const numerator = n * 10n ** BigInt(fractionDigits);
+        scaled = numerator / den;
+        if ((numerator % den) * 2n >= den) scaled += 1n; // round half up
+    }
+
+    let text = scaled.toString().padStart(fractionDigits + 1, '0');
+    if (fractionDigits > 0) {
+        text = `${text.slice(0, -fractionDigits)}.${text.slice(-fractionDigits)}`.replace(/\.?0+$/, '');
+    }
+    return negative ? `-${text}` : text;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > COORDINATES ------------------------------------------------------------------------------------------------
+
+/**
+ * Sets a quad-double from a coordinate (number, decimal string or quad-double).
+ * @param {Float64Array} q
+ * @param {COORDINATE|Float64Array} value
+ * @returns {Float64Array} q
+ */
+export function qdFrom(q, value) {
+    if (typeof value === 'number') return qdSet(q, value);
+    if (value instanceof Float64Array) return qdCopy(q, value);
+    return qdParse(value, q) ?? qdSet(q, NaN);
+}
+
+/**
+ * Nearest double of a coordinate.
+ * @param {COORDINATE|Float64Array} value
+ * @returns {number}
+ */
+export function coordinateToNumber(value) {
+    if (typeof value === 'number') return value;
+    if (value instanceof Float64Array) return qdValue(value);
+    return Number(value);
+}
+
+/**
+ * Whether a value is a valid coordinate (finite number or decimal string).
+ * @param {*} value
+ * @returns {boolean}
+ */
+export function isCoordinate(value) {
+    if (typeof value === 'number') return Number.isFinite(value);
+    return typeof value === 'string' && DECIMAL.test(value) && /\d/.test(value);
+}
+
+/**
+ * Parses a coordinate from text: a number when a double holds all its significant digits, the trimmed decimal string
+ * otherwise (so deep URL and preset coordinates survive), NaN when invalid.
+ * @param {string|number} text
+ * @returns {COORDINATE}
+ */
+export function parseCoordinate(text) {
+    if (typeof text === 'number') return text;
+    if (!isCoordinate(text)) return NaN;
+    const significant = text.replace(/e.*$/i, '').replace(/\D/g, '').replace(/^0+/, '').length;
+    return significant > 17 ? text.trim() : Number(text);
+}
+
+/**
+ * Serialises a coordinate for a view of the given zoom: a plain number while a double resolves the view (every
+ * shallow view, keeping URLs and presets unchanged), a decimal string with enough digits otherwise.
+ * @param {Float64Array} q
+ * @param {number} zoom View height in fractal units
+ * @returns {COORDINATE}
+ */
+export function formatCoordinate(q, zoom) {
+    const magnitude = Math.max(Math.abs(q[0]), zoom);
+    // Digits needed to place the centre to 1e-6 of the view, bounded by the quad-double precision
+    const digits = Math.min(64, Math.ceil(Math.log10(magnitude / zoom)) + 7);
+    if (digits <= 17 || q[1] === 0) return qdValue(q);
+    return qdToString(q, digits);
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
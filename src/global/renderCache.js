@@ -0,0 +1,233 @@
+/**
+ * @module RenderCache
+ * @author Radim Brnka
+ * @description Persistent cache of finished render work in IndexedDB (reference orbits, Riemann tiles, preset
+ * frames), kept across sessions so kiosks replaying the same presets do not redo it after every reload. Entries are
+ * keyed by a hash of the full view state they were computed for plus the app version, since kernels change between
+ * releases. The total payload size is bounded by evicting the least recently used entries; payloads and their
+ * bookkeeping live in separate stores, so eviction never loads a payload. Every call degrades to a miss / no-op when
+ * IndexedDB is unavailable.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {APP, log, LOG_LEVEL} from './constants';
+
+const DB_NAME = 'fractal-traveler-cache';
+const DB_VERSION = 1;
+/** key -> payload */
+const DATA_STORE = 'data';
+/** key -> {key, kind, size, used} */
+const META_STORE = 'meta';
+/** Total payload bytes kept */
+export const RENDER_CACHE_BUDGET = 256 * 1024 * 1024;
+/** Eviction trims down to this fraction of the budget, so it does not run on every write */
+const EVICT_TARGET = 0.9;
+
+/** @type {Promise<IDBDatabase|null>|null} */
+let dbPromise = null;
+/** Payload bytes stored (summed from the bookkeeping store on open) */
+let totalBytes = 0;
+/** @type {Map<string, Set<string>>} Stored keys per kind */
+let keyIndex = new Map();
+
+// region > KEYS -------------------------------------------------------------------------------------------------------
+
+/**
+ * JSON with object keys sorted at every level and typed arrays as plain arrays, so equal states stringify equally.
+ * Numbers keep their shortest round-trip form, i.e. every bit of a double (and of both double-double halves).
+ * @param {*} value
+ * @returns {string}
+ */
+export function stableStringify(value) {
+    if (ArrayBuffer.isView(value)) value = Array.from(value);
+    if (Array.isArray(value)) return `[${value.map(stableStringify).join(',')}]`;
+    if (value && typeof value === 'object') {
+        return `{${Object.keys(value).sort().filter(k => value[k] !== undefined)
+            .map(k => `${JSON.stringify(k)}:${stableStringify(value[k])}`).join(',')}}`;
+    }
+    return JSON.stringify(value ?? null);
+}
+
+/**
+ * 53-bit string hash (cyrb53).
+ * @param {string} str
+ * @param {number} [seed]
+ * @returns {number}
+ */
+function hash53(str, seed = 0) {
+    let h1 = 0xdeadbeef ^ seed;
+    let h2 = 0x41c6ce57 ^ seed;
+    for (let i = 0; i < str.length; i++) {
+        const ch = str.charCodeAt(i);
+        h1 = Math.imul(h1 ^ ch, 2654435761);
+        h2 = Math.imul(h2 ^ ch, 1597334677);
+    }
+    h1 = Math.imul(h1 ^ (h1 >>> 16), 2246822507) ^ Math.imul(h2 ^ (h2 >>> 13), 3266489909);
+    h2 = Math.imul(h2 ^ (h2 >>> 16), 2246822507) ^ Math.imul(h1 ^ (h1 >>> 13), 3266489909);
+    return 4294967296 * (2097151 & h2) + (h1 >>> 0);
+}
+
+/**
+ * Cache key of a view state: kind prefix plus a 106-bit hash (two seeds) of the state and app version.
+ * @param {string} kind e.g. 'orbit', 'tile', 'frame'
+ * @param {Object} state Everything the cached result depends on (mode, DD pan, zoom, rotation, params, shader, ...)
+ * @returns {string}
+ */
+export function viewStateKey(kind, state) {
+    const text = stableStringify({v: APP.version, kind, state});
+    return `${kind}:${hash53(text, 0).toString(36)}.${hash53(text, 1).toString(36)}`;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > STORAGE ----------------------------------------------------------------------------------------------------
+
+/** @returns {boolean} false when the browser has no IndexedDB (every lookup misses) */
+export const isRenderCacheAvailable = () => typeof indexedDB !== 'undefined';
+
+function openDB() {
+    if (dbPromise) return dbPromise;
+    if (!isRenderCacheAvailable()) return (dbPromise = Promise.resolve(null));
+
+    dbPromise = new Promise((resolve) => {
+        const request = indexedDB.open(DB_NAME, DB_VERSION);
+        request.onupgradeneeded = () => {
+            request.result.createObjectStore(DATA_STORE);
+            request.result.createObjectStore(META_STORE, {keyPath: 'key'}).createIndex('used', 'used');
+        };
+        request.onsuccess = () => {
+            const database = request.result;
+
+            // Size and key index from the bookkeeping store only
+            const cursorRequest = database.transaction(META_STORE, 'readonly').objectStore(META_STORE).openCursor();
+            cursorRequest.onsuccess = () => {
+                const cursor = cursorRequest.result;
+                if (!cursor) {
+                    log(`Opened (${keyIndex.size} kinds, ${(totalBytes / 1048576).toFixed(1)} MB).`, 'RenderCache');
+                    resolve(database);
+                    return;
+                }
+                totalBytes += cursor.value.size;
+                indexKey(cursor.value.kind, cursor.value.key);
+                cursor.continue();
+            };
+            cursorRequest.onerror = () => resolve(database);
+        };
+        request.onerror = () => {
+            log(`IndexedDB unavailable: ${request.error}`, 'RenderCache', LOG_LEVEL.WARN);
+            resolve(null);
+        };
+    });
+    return dbPromise;
+}
+
+function indexKey(kind, key) {
+    if (!keyIndex.has(kind)) keyIndex.set(kind, new Set());
+    keyIndex.get(kind).add(key);
+}
+
+/**
+ * Keys stored for a kind. The set is live: later puts and evictions update it.
+ * @param {string} kind
+ * @returns {Promise<Set<string>>}
+ */
+export async function getStoredKeys(kind) {
+    await openDB();
+    if (!keyIndex.has(kind)) keyIndex.set(kind, new Set());
+    return keyIndex.get(kind);
+}
+
+/**
+ * Reads an entry and marks it recently used.
+ * @param {string} key
+ * @returns {Promise<*|null>} The stored payload, or null on a miss
+ */
+export async function cacheGet(key) {
+    const database = await openDB();
+    if (!database) return null;
+
+    return new Promise((resolve) => {
+        let payload = null;
+        const tx = database.transaction([DATA_STORE, META_STORE], 'readwrite');
+        tx.objectStore(DATA_STORE).get(key).onsuccess = (e) => {
+            payload = e.target.result ?? null;
+        };
+        const meta = tx.objectStore(META_STORE);
+        meta.get(key).onsuccess = (e) => {
+            const entry = e.target.result;
+            if (!entry) return;
+            entry.used = Date.now();
+            meta.put(entry);
+        };
+        tx.oncomplete = () => resolve(payload);
+        tx.onerror = tx.onabort = () => resolve(null);
+    });
+}
+
+/**
+ * Stores an entry (replacing one under the same key), then evicts least recently used entries over the budget.
+ * @param {string} key From {@link viewStateKey}
+ * @param {string} kind
+ * @param {*} payload Anything structured-cloneable (Blob, typed arrays, plain objects)
+ * @param {number} size Payload bytes, for the budget
+ * @returns {Promise<void>}
+ */
+export async function cachePut(key, kind, payload, size) {
+    const database = await openDB();
+    if (!database) return;
+
+    await new Promise((resolve) => {
+        const tx = database.transaction([DATA_STORE, META_STORE], 'readwrite');
+        const meta = tx.objectStore(META_STORE);
+        meta.get(key).onsuccess = (e) => {
+            totalBytes -= e.target.result?.size ?? 0;
+            totalBytes += size;
+            meta.put({key, kind, size, used: Date.now()});
+            tx.objectStore(DATA_STORE).put(payload, key);
+        };
+        tx.oncomplete = () => {
+            indexKey(kind, key);
+            resolve();
+        };
+        tx.onerror = tx.onabort = () => {
+            log(`Store failed: ${tx.error}`, 'RenderCache', LOG_LEVEL.WARN);
+            resolve();
+        };
+    });
+
+    if (totalBytes > RENDER_CACHE_BUDGET) await evict(database);
+}
+
+/**
+ * Deletes least recently used entries until the total is under the eviction target.
+ * @param {IDBDatabase} database
+ * @returns {Promise<void>}
+ */
+function evict(database) {
+    return new Promise((resolve) => {
+        const tx = database.transaction([DATA_STORE, META_STORE], 'readwrite');
+        const data = tx.objectStore(DATA_STORE);
+        const request = tx.objectStore(META_STORE).index('used').openCursor();
+        let evicted = 0;
+
+        request.onsuccess = () => {
+            const cursor = request.result;
+            if (!cursor || totalBytes <= RENDER_CACHE_BUDGET * EVICT_TARGET) return;
+
+            const {key, kind, size} = cursor.value;
+            data.delete(key);
+            cursor.delete();
+            keyIndex.get(kind)?.delete(key);
+            totalBytes -= size;
+            evicted++;
+            cursor.continue();
+        };
+        tx.oncomplete = () => {
+            log(`Evicted ${evicted} entries (${(totalBytes / 1048576).toFixed(1)} MB kept).`, 'RenderCache');
+            resolve();
+        };
+        tx.onerror = tx.onabort = () => resolve();
+    });
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
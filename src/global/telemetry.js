@@ -0,0 +1,348 @@
+/**
+ * @module Telemetry
+ * @author Radim Brnka
+ * @description Opt-in local performance telemetry. While enabled (persisted in localStorage, toggled with Shift+L),
+ * every drawn frame contributes frame time, GPU time (when the debug panel's timer queries are running),
+ * iterations and render scale, tagged by fractal mode, preset id and zoom depth. Samples are batched in memory and
+ * flushed to IndexedDB in chunks, so the draw path never touches storage. Stored history yields per-preset
+ * p50/p95/p99 percentiles, CSV/JSON exports and a starting adaptive-quality offset per preset.
+ * Nothing leaves the device.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log, LOG_LEVEL} from './constants';
+
+const ENABLED_KEY = 'telemetryEnabled';
+const DB_NAME = 'fractal-traveler-telemetry';
+const DB_VERSION = 1;
+const STORE = 'chunks';
+/** Interval between IndexedDB flushes (ms) */
+const FLUSH_INTERVAL = 2000;
+/** Stored chunks kept; oldest are pruned beyond this */
+const MAX_CHUNKS = 2000;
+/** Draw gaps longer than this are idle time, not frame time (ms) */
+const MAX_FRAME_GAP = 250;
+
+let enabled = false;
+/** @type {IDBDatabase|null} */
+let db = null;
+/** @type {Promise<IDBDatabase|null>|null} */
+let dbPromise = null;
+
+/** Current tags */
+let context = {mode: 'unknown', presetId: null};
+
+/** Chunks being filled, keyed by mode/preset/zoom depth */
+let pending = new Map();
+let flushTimer = null;
+let lastDrawTs = 0;
+
+/** @type {Map<string, {count: number, frame: number[], gpu: number[]}>} Cached per-preset percentiles */
+let summaryCache = new Map();
+/** @type {Map<string, number>} Settled adaptive-quality offset per preset key */
+let qualityHints = new Map();
+
+/**
+ * @param {string} mode
+ * @param {string|null} presetId
+ * @returns {string}
+ */
+export const presetKey = (mode, presetId) => `${mode}/${presetId ?? '-'}`;
+
+/**
+ * Nearest-rank percentile of an ascending array.
+ * @param {ArrayLike<number>} sorted
+ * @param {number} p 0..100
+ * @returns {number}
+ */
+export function percentile(sorted, p) {
+    if (!sorted.length) return NaN;
+    const idx = Math.min(sorted.length - 1, Math.max(0, Math.ceil((p / 100) * sorted.length) - 1));
+    return sorted[idx];
+}
+
+// region > STORAGE ----------------------------------------------------------------------------------------------------
+
+function openDB() {
+    if (dbPromise) return dbPromise;
+    if (typeof indexedDB === 'undefined') return (dbPromise = Promise.resolve(null));
+
+    dbPromise = new Promise((resolve) => {
+        const request = indexedDB.open(DB_NAME, DB_VERSION);
+        request.onupgradeneeded = () => {
+            const store = request.result.createObjectStore(STORE, {keyPath: 'id', autoIncrement: true});
+            store.createIndex('key', 'key');
+        };
+        request.onsuccess = () => {
+            db = request.result;
+            resolve(db);
+        };
+        request.onerror = () => {
+            log(`IndexedDB unavailable: ${request.error}`, 'Telemetry', LOG_LEVEL.WARN);
+            resolve(null);
+        };
+    });
+    return dbPromise;
+}
+
+/** @returns {Promise<Array<Object>>} All stored chunks, oldest first */
+async function readAllChunks() {
+    const database = await openDB();
+    if (!database) return [];
+
+    return new Promise((resolve) => {
+        const request = database.transaction(STORE, 'readonly').objectStore(STORE).getAll();
+        request.onsuccess = () => resolve(request.result || []);
+        request.onerror = () => resolve([]);
+    });
+}
+
+async function writeChunks(chunks) {
+    const database = await openDB();
+    if (!database || chunks.length === 0) return;
+
+    await new Promise((resolve) => {
+        const tx = database.transaction(STORE, 'readwrite');
+        const store = tx.objectStore(STORE);
+        for (const chunk of chunks) store.add(chunk);
+
+        // Prune the oldest chunks beyond the cap (keys are ascending)
+        const countRequest = store.count();
+        countRequest.onsuccess = () => {
+            let excess = countRequest.result - MAX_CHUNKS;
+            if (excess <= 0) return;
+            store.openCursor().onsuccess = (e) => {
+                const cursor = e.target.result;
+                if (!cursor || excess-- <= 0) return;
+                cursor.delete();
+                cursor.continue();
+            };
+        };
+
+        tx.oncomplete = resolve;
+        tx.onerror = tx.onabort = () => {
+            log(`Telemetry flush failed: ${tx.error}`, 'Telemetry', LOG_LEVEL.WARN);
+            resolve();
+        };
+    });
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > RECORDING --------------------------------------------------------------------------------------------------
+
+/** @returns {boolean} */
+export const isTelemetryEnabled = () => enabled;
+
+/**
+ * Enables or disables recording. The choice is persisted so kiosks keep recording across reloads.
+ * @param {boolean} value
+ */
+export function setTelemetryEnabled(value) {
+    enabled = !!value;
+    try {
+        localStorage.setItem(ENABLED_KEY, enabled ? '1' : '0');
+    } catch (e) {
+        console.warn('Failed to persist telemetry setting:', e);
+    }
+
+    if (enabled) {
+        void loadHistory();
+    } else {
+        void flush();
+    }
+    log(`Telemetry: ${enabled ? 'ON' : 'OFF'}`, 'Telemetry');
+}
+
+/** Restores the persisted opt-in and loads stored history. Call once at startup. */
+export function initTelemetry() {
+    try {
+        enabled = localStorage.getItem(ENABLED_KEY) === '1';
+    } catch (e) {
+        enabled = false;
+    }
+    if (enabled) void loadHistory();
+}
+
+/**
+ * Sets the tags for subsequent samples.
+ * @param {string} mode Fractal mode name
+ * @param {string|null} presetId Preset the view arrived at, null for free exploration and travel in flight
+ */
+export function setTelemetryContext(mode, presetId = null) {
+    context = {mode: mode || 'unknown', presetId: presetId ?? null};
+}
+
+/**
+ * Records one drawn frame. Called from FractalRenderer.draw(); cheap when disabled.
+ * @param {FractalRenderer} renderer
+ * @param {number} gpuMs Smoothed GPU time or NaN when not measured
+ */
+export function recordFrame(renderer, gpuMs) {
+    if (!enabled) return;
+
+    const now = performance.now();
+    const frameMs = now - lastDrawTs;
+    lastDrawTs = now;
+    if (frameMs > MAX_FRAME_GAP) return;
+
+    const zoomDepth = Math.floor(-Math.log10(Math.max(renderer.zoom, 1e-300)));
+    const key = presetKey(context.mode, context.presetId);
+    const chunkKey = `${key}@${zoomDepth}`;
+
+    let chunk = pending.get(chunkKey);
+    if (!chunk) {
+        chunk = {
+            key, mode: context.mode, presetId: context.presetId, zoomDepth,
+            ts: Date.now(), frameMs: [], gpuMs: [], iterations: [], renderScale: [],
+            adaptive: false, extraIterations: 0
+        };
+        pending.set(chunkKey, chunk);
+    }
+
+    const cssWidth = renderer.canvas.clientWidth || renderer.canvas.width;
+    const dpr = window.devicePixelRatio || 1;
+
+    chunk.frameMs.push(frameMs);
+    chunk.gpuMs.push(Number.isFinite(gpuMs) ? gpuMs : null);
+    chunk.iterations.push(renderer.iterations);
+    chunk.renderScale.push(renderer.canvas.width / (cssWidth * dpr));
+    chunk.adaptive = !!renderer.adaptiveQualityEnabled;
+    chunk.extraIterations = renderer.extraIterations || 0;
+
+    if (!flushTimer) flushTimer = setTimeout(flush, FLUSH_INTERVAL);
+}
+
+/** Writes pending chunks to IndexedDB and refreshes the cached summaries. */
+export async function flush() {
+    if (flushTimer) {
+        clearTimeout(flushTimer);
+        flushTimer = null;
+    }
+    if (pending.size === 0) return;
+
+    const chunks = [...pending.values()];
+    pending = new Map();
+
+    for (const chunk of chunks) noteQualityHint(chunk);
+    await writeChunks(chunks);
+    await loadHistory();
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > ANALYSIS ---------------------------------------------------------------------------------------------------
+
+function noteQualityHint(chunk) {
+    // Only settled adaptive offsets carry information; chunks recorded with adaptQ off are ignored
+    if (chunk.adaptive && chunk.presetId !== null) qualityHints.set(chunk.key, chunk.extraIterations);
+}
+
+/**
+ * Groups chunks by preset key and computes frame/GPU percentiles.
+ * @param {Array<Object>} chunks
+ * @returns {Map<string, {count: number, frame: number[], gpu: number[]}>} [p50, p95, p99] per metric
+ */
+export function summarizeChunks(chunks) {
+    const groups = new Map();
+    for (const chunk of chunks) {
+        let g = groups.get(chunk.key);
+        if (!g) groups.set(chunk.key, g = {frame: [], gpu: []});
+        for (const v of chunk.frameMs) g.frame.push(v);
+        for (const v of chunk.gpuMs) if (v !== null) g.gpu.push(v);
+    }
+
+    const out = new Map();
+    for (const [key, g] of groups) {
+        g.frame.sort((a, b) => a - b);
+        g.gpu.sort((a, b) => a - b);
+        out.set(key, {
+            count: g.frame.length,
+            frame: [50, 95, 99].map(p => percentile(g.frame, p)),
+            gpu: [50, 95, 99].map(p => percentile(g.gpu, p)),
+        });
+    }
+    return out;
+}
+
+async function loadHistory() {
+    const chunks = await readAllChunks();
+    summaryCache = summarizeChunks(chunks);
+    qualityHints = new Map();
+    for (const chunk of chunks) noteQualityHint(chunk);
+}
+
+/**
+ * Cached percentiles of a preset (refreshed on every flush).
+ * @param {string} mode
+ * @param {string|null} presetId
+ * @returns {{count: number, frame: number[], gpu: number[]}|null}
+ */
+export function getPresetStats(mode, presetId) {
+    return summaryCache.get(presetKey(mode, presetId)) || null;
+}
+
+/** @returns {{mode: string, presetId: string|null}} Current tags */
+export const getTelemetryContext = () => context;
+
+/**
+ * Adaptive-quality offset the preset settled at last time, if known.
+ * @param {string} mode
+ * @param {string|null} presetId
+ * @returns {number|null}
+ */
+export function getQualityHint(mode, presetId) {
+    if (!enabled) return null;
+    const hint = qualityHints.get(presetKey(mode, presetId));
+    return Number.isFinite(hint) ? hint : null;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > EXPORT -----------------------------------------------------------------------------------------------------
+
+/**
+ * Serializes stored chunks into one CSV row per frame.
+ * @param {Array<Object>} chunks
+ * @returns {string}
+ */
+export function chunksToCSV(chunks) {
+    const rows = ['timestamp,mode,preset,zoomDepth,frameMs,gpuMs,iterations,renderScale,extraIterations'];
+    const quote = (s) => `"${String(s).replaceAll('"', '""')}"`;
+    for (const c of chunks) {
+        for (let i = 0; i < c.frameMs.length; i++) {
+            rows.push([
+                new Date(c.ts).toISOString(), quote(c.mode), quote(c.presetId ?? ''), c.zoomDepth,
+                c.frameMs[i].toFixed(3), c.gpuMs[i] === null ? '' : c.gpuMs[i].toFixed(3),
+                c.iterations[i], c.renderScale[i].toFixed(3), c.extraIterations
+            ].join(','));
+        }
+    }
+    return rows.join('\n');
+}
+
+function download(content, type, filename) {
+    const url = URL.createObjectURL(new Blob([content], {type}));
+    const link = document.createElement('a');
+    link.setAttribute('download', filename);
+    link.setAttribute('href', url);
+    link.click();
+    setTimeout(() => URL.revokeObjectURL(url), 0);
+}
+
+/**
+ * Downloads the stored telemetry as CSV (per frame) and JSON (per-preset percentiles + raw chunks).
+ * @returns {Promise<void>}
+ */
+export async function exportTelemetry() {
+    await flush();
+    const chunks = await readAllChunks();
+    const stamp = Date.now();
+
+    const presets = {};
+    for (const [key, stats] of summarizeChunks(chunks)) presets[key] = stats;
+
+    download(chunksToCSV(chunks), 'text/csv', `fractal-telemetry-${stamp}.csv`);
+    download(JSON.stringify({presets, chunks}), 'application/json', `fractal-telemetry-${stamp}.json`);
+    log(`Telemetry exported (${chunks.length} chunks).`, 'Telemetry');
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
@@ -18,8 +18,8 @@
 /**
  * @typedef {Object} URL_PRESET
  *      @property {FRACTAL_TYPE} mode Defaults to FRACTAL_TYPE.MANDELBROT
- *      @property {number|null} [px] panX
- *      @property {number|null} [py] panY
+ *      @property {COORDINATE|null} [px] panX
+ *      @property {COORDINATE|null} [py] panY
  *      @property {number|null} [cx] Julia only
  *      @property {number|null} [cy] Julia only
  *      @property {number|null} [zoom]
@@ -34,7 +34,7 @@
 /**
  * @typedef {Object} PRESET
  *      @property {string} [id] Id name/title. Does not have to be unique but it's recommended.
- *      @property {COMPLEX} pan
+ *      @property {COMPLEX|Array.<COORDINATE>} pan
  *      @property {number} zoom
  *      @property {number} [index] Set dynamically for simpler cycling during demo animations
  *      @property {number} [rotation]
@@ -69,6 +69,14 @@
   * @description The complex number c=x+yi as [x, y], used as C in Julia or Pan in general. x: the real part, y: the imaginary part.
  */
 // ---------------------------------------------------------------------------------------------------------------------
+// COORDINATE
+// ---------------------------------------------------------------------------------------------------------------------
+/**
+ * @typedef {number|string} COORDINATE
+ * @description A view coordinate as presets and URLs carry it: a number, or a decimal string when a double cannot
+ * resolve the view (deep zoom). Parsed into quad-doubles by global/quadDouble.js.
+ */
+// ---------------------------------------------------------------------------------------------------------------------
 // PALETTE
 // ---------------------------------------------------------------------------------------------------------------------
 /**
@@ -7,14 +7,15 @@
  */
 
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEBUG_MODE, FRACTAL_TYPE, PI} from "./constants";
+import {parseCoordinate} from "./quadDouble";
 
 let urlParamsSet = false;
 
 /**
  * Updates browser URL with params of the selected point and zoom in the fractal
  * @param {FRACTAL_TYPE} mode
- * @param {number} px panX
- * @param {number} py panY
+ * @param {COORDINATE} px panX (decimal string for deep views, see FractalRenderer.getPanCoordinates)
+ * @param {COORDINATE} py panY
  * @param {number|null} cx Julia only
  * @param {number|null} cy Julia only
  * @param {number} zoom
@@ -30,10 +31,13 @@ export function updateURLParams(mode, px, py, zoom, rotation, cx = null, cy = nu
         return Number(value).toPrecision(17);
     };
 
+    // Deep coordinates arrive as exact decimal strings already
+    const formatCoordinate = (value) => typeof value === 'string' ? value : formatNumber(value);
+
     const params = {
         mode: mode != null ? mode.toFixed(0) : FRACTAL_TYPE.MANDELBROT,
-        px: formatNumber(px),
-        py: formatNumber(py),
+        px: formatCoordinate(px),
+        py: formatCoordinate(py),
         zoom: formatNumber(zoom),
         r: rotation != null ? Number(rotation).toPrecision(17) : 0,
         cx: formatNumber(cx),
@@ -120,8 +124,8 @@ export function loadFractalParamsFromURL() {
         // Return the parsed parameters
         return {
             mode: parseMode(modeStr),
-            px: decodedParams.px != null ? parseFloat(decodedParams.px) : null,
-            py: decodedParams.py != null ? parseFloat(decodedParams.py) : null,
+            px: decodedParams.px != null ? parseCoordinate(decodedParams.px) : null,
+            py: decodedParams.py != null ? parseCoordinate(decodedParams.py) : null,
             zoom: decodedParams.zoom != null ? parseFloat(decodedParams.zoom) : null,
             r: decodedParams.r != null ? parseFloat(decodedParams.r) : 0, // Rotation is not necessary to be defined
             cx: decodedParams.cx != null ? parseFloat(decodedParams.cx) : null,
@@ -253,6 +257,136 @@ function splitFloatED(value) {
     return {high, low};
 }
 
+/**
+ * Allocation-free GPU emulated double split: writes the float32 high part and the float32 residual into two adjacent
+ * slots of a caller-provided array, so the per-iteration orbit and per-frame uniform paths create no garbage.
+ * Unlike the Veltkamp-Dekker split (26-bit high part), the high part here is exactly what float32 storage holds.
+ *
+ * @param {number} value A standard JavaScript 64-bit number.
+ * @param {Float32Array|Float64Array} out Target array (hi at offset, lo at offset + 1).
+ * @param {number} [offset=0] Index of the high slot.
+ * @returns {Float32Array|Float64Array} The target array.
+ */
+export function splitFloatInto(value, out, offset = 0) {
+    const high = Math.fround(value);
+    out[offset] = high;
+    out[offset + 1] = value - high; // Rounded to float32 by Float32Array storage
+    return out;
+}
+
+/**
+ * Power-of-two exponent below which zooms reach the shaders as a mantissa and an exponent (see splitZoomInto). Shallower
+ * zooms keep exponent 0, so the shaders take their unscaled path there.
+ * @type {number}
+ */
+export const ZOOM_EXPONENT_THRESHOLD = -40;
+
+/**
+ * value * 2^exp, exact unless the result leaves the double range. Unlike value * Math.pow(2, exp), the intermediate
+ * power cannot overflow (2^1074 is Infinity while 2^-1074 is not).
+ *
+ * @param {number} value
+ * @param {number} exp Integer exponent.
+ * @returns {number}
+ */
+export function scaleByPowerOfTwo(value, exp) {
+    while (exp > 1000) {
+        value *= 2 ** 1000;
+        exp -= 1000;
+    }
+    while (exp < -1000) {
+        value *= 2 ** -1000;
+        exp += 1000;
+    }
+    return value * 2 ** exp;
+}
+
+/**
+ * Splits a zoom into a float32 hi/lo mantissa pair and a power-of-two exponent, zoom = (hi + lo) * 2^exp, written to
+ * out[offset], out[offset + 1] and out[offset + 2]. The mantissa lies in [1, 2) below 2^ZOOM_EXPONENT_THRESHOLD, so the
+ * pair never underflows float32 however deep the view is; shallower zooms keep exponent 0.
+ *
+ * @param {number} zoom Positive zoom.
+ * @param {Float32Array|Float64Array} out Target array.
+ * @param {number} [offset=0] Index of the mantissa high slot.
+ * @returns {number} The exponent.
+ */
+export function splitZoomInto(zoom, out, offset = 0) {
+    let exp = 0;
+    if (zoom > 0 && zoom < 2 ** ZOOM_EXPONENT_THRESHOLD) {
+        exp = Math.floor(Math.log2(zoom));
+        // log2 may round across a power of two
+        if (scaleByPowerOfTwo(zoom, -exp) >= 2) exp++;
+        else if (scaleByPowerOfTwo(zoom, -exp) < 1) exp--;
+    }
+    splitFloatInto(scaleByPowerOfTwo(zoom, -exp), out, offset);
+    out[offset + 2] = exp;
+    return exp;
+}
+
+/**
+ * Writes (hi + lo) * 2^exp as a float32 hi/lo pair: the float32 high part and the float32 residual of the whole
+ * double-double, so the pair carries ~48 bits rather than float32(hi) + float32(lo). Reads both parts before writing,
+ * so it may overwrite its own input slots.
+ *
+ * @param {number} hi Double-double high part.
+ * @param {number} lo Double-double low part.
+ * @param {number} exp Integer power-of-two scale (e.g. the negated zoom exponent).
+ * @param {Float32Array|Float64Array} out Target array (hi at offset, lo at offset + 1).
+ * @param {number} [offset=0] Index of the high slot.
+ * @returns {Float32Array|Float64Array} The target array.
+ */
+export function splitScaledDDInto(hi, lo, exp, out, offset = 0) {
+    const scaledHi = scaleByPowerOfTwo(hi, exp);
+    const scaledLo = scaleByPowerOfTwo(lo, exp);
+    const high = Math.fround(scaledHi);
+    out[offset] = high;
+    out[offset + 1] = (scaledHi - high) + scaledLo;
+    return out;
+}
+
+/**
+ * Interpolates a zoom geometrically, through exponent space, so every step covers the same number of octaves and no
+ * intermediate ratio over- or underflows whatever the depth.
+ *
+ * @param {number} startZoom
+ * @param {number} targetZoom
+ * @param {number} t Progress in [0, 1].
+ * @returns {number}
+ */
+export function interpolateZoom(startZoom, targetZoom, t) {
+    if (t >= 1) return targetZoom;
+    const startExp = Math.log2(startZoom);
+    return 2 ** (startExp + (Math.log2(targetZoom) - startExp) * t);
+}
+
+/**
+ * Whether two zooms are equal up to rounding. Relative, so it holds at any depth (fixed-point comparisons such as
+ * toFixed(20) consider every zoom below 1e-20 equal).
+ *
+ * @param {number} a
+ * @param {number} b
+ * @returns {boolean}
+ */
+export const isSameZoom = (a, b) => Math.abs(a - b) <= Math.abs(b) * 1e-12;
+
+/**
+ * Repeats the RGBA texel at `start` over the rest of the row up to `end` (exclusive), in place. Used to pad orbit and
+ * coefficient textures past the escape iteration without re-splitting the last value.
+ *
+ * @param {Float32Array} data Texel data, 4 floats per texel.
+ * @param {number} start Index of the first float of the source texel.
+ * @param {number} end Index one past the last float to fill.
+ * @returns {Float32Array} The data array.
+ */
+export function fillTexels(data, start, end) {
+    // Doubling copy: log2(n) copyWithin calls instead of n texel writes
+    for (let filled = 4; start + filled < end; filled *= 2) {
+        data.copyWithin(start + filled, start, Math.min(start + filled, end - filled));
+    }
+    return data;
+}
+
 /**
  * Creates a double-double precision number object with high and low parts.
  * Used for extended precision arithmetic beyond standard 64-bit floating point.
@@ -303,11 +437,13 @@ export function quickTwoSum(a, b) {
  * @returns {{hi: number, lo: number}} The mutated double-double object with the sum.
  */
 export function ddAdd(dd, n) {
-    const t = twoSum(dd.hi, n);
-    const lo = dd.lo + t.err;
-    const r = quickTwoSum(t.s, lo);
-    dd.hi = r.s;
-    dd.lo = r.err;
+    // twoSum + quickTwoSum inlined, so a pan step allocates nothing
+    const s = dd.hi + n;
+    const bb = s - dd.hi;
+    const lo = dd.lo + ((dd.hi - (s - bb)) + (n - bb));
+    const hi = s + lo;
+    dd.lo = lo - (hi - s);
+    dd.hi = hi;
     return dd;
 }
 
@@ -346,10 +482,7 @@ export function ddValue(dd) {
  * @returns {{hi: number, lo: number}} The sum as a new double-double number.
  */
 export function ddAddDD(a, b) {
-    const t = twoSum(a.hi, b.hi);
-    const lo = a.lo + b.lo + t.err;
-    const r = quickTwoSum(t.s, lo);
-    return {hi: r.s, lo: r.err};
+    return ddSumInto(a.hi, a.lo, b.hi, b.lo, {hi: 0, lo: 0});
 }
 
 /**
@@ -360,7 +493,62 @@ export function ddAddDD(a, b) {
  * @returns {{hi: number, lo: number}} The difference (a - b) as a new double-double number.
  */
 export function ddSubDD(a, b) {
-    return ddAddDD(a, {hi: -b.hi, lo: -b.lo});
+    return ddSumInto(a.hi, a.lo, -b.hi, -b.lo, {hi: 0, lo: 0});
+}
+
+/**
+ * Adds two double-double numbers into two adjacent slots of a caller-provided array (allocation-free ddAddDD).
+ *
+ * @param {{hi: number, lo: number}} a - First double-double number.
+ * @param {{hi: number, lo: number}} b - Second double-double number.
+ * @param {Float64Array} out - Target array (hi at offset, lo at offset + 1).
+ * @param {number} [offset=0] - Index of the high slot.
+ * @returns {Float64Array} The target array.
+ */
+export function ddAddDDInto(a, b, out, offset = 0) {
+    ddSumInto(a.hi, a.lo, b.hi, b.lo, out, offset);
+    return out;
+}
+
+/**
+ * Subtracts two double-double numbers (a - b) into two adjacent slots of a caller-provided array (allocation-free
+ * ddSubDD). Used for the per-frame delta between the view centre and the perturbation reference.
+ *
+ * @param {{hi: number, lo: number}} a - The minuend.
+ * @param {{hi: number, lo: number}} b - The subtrahend.
+ * @param {Float64Array} out - Target array (hi at offset, lo at offset + 1).
+ * @param {number} [offset=0] - Index of the high slot.
+ * @returns {Float64Array} The target array.
+ */
+export function ddSubDDInto(a, b, out, offset = 0) {
+    ddSumInto(a.hi, a.lo, -b.hi, -b.lo, out, offset);
+    return out;
+}
+
+/**
+ * Shared DD + DD kernel (twoSum + quickTwoSum inlined). Writes either to {hi, lo} (offset undefined) or to out[offset]
+ * and out[offset + 1].
+ * @param {number} aHi
+ * @param {number} aLo
+ * @param {number} bHi
+ * @param {number} bLo
+ * @param {Object|Float64Array} out
+ * @param {number} [offset]
+ * @returns {Object|Float64Array} out
+ */
+function ddSumInto(aHi, aLo, bHi, bLo, out, offset) {
+    const s = aHi + bHi;
+    const bb = s - aHi;
+    const lo = aLo + bLo + ((aHi - (s - bb)) + (bHi - bb));
+    const hi = s + lo;
+    if (offset === undefined) {
+        out.hi = hi;
+        out.lo = lo - (hi - s);
+    } else {
+        out[offset] = hi;
+        out[offset + 1] = lo - (hi - s);
+    }
+    return out;
 }
 
 // endregion---------------------------------------------------------------------------------------
@@ -0,0 +1,189 @@
+/**
+ * @module VirtualClock
+ * @author Radim Brnka
+ * @description Deterministic animation time for offline rendering. While installed, requestAnimationFrame,
+ * setTimeout/setInterval, performance.now and Date.now follow a virtual clock that only moves when advance() is
+ * called, so every animation (tours, dives, palette transitions, holds) is sampled at exact frame times no matter
+ * how long each frame takes to render. Originals are kept in `real` for the render loop itself.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/** Real timing functions, captured at load (before any install) */
+export const real = {
+    requestAnimationFrame: window.requestAnimationFrame?.bind(window),
+    cancelAnimationFrame: window.cancelAnimationFrame?.bind(window),
+    setTimeout: window.setTimeout.bind(window),
+    clearTimeout: window.clearTimeout.bind(window),
+    setInterval: window.setInterval.bind(window),
+    clearInterval: window.clearInterval.bind(window),
+    performanceNow: performance.now.bind(performance),
+    dateNow: Date.now,
+};
+
+/**
+ * Resolves after one real macrotask, letting pending promise chains settle.
+ * @returns {Promise<void>}
+ */
+export const yieldToEventLoop = () => new Promise(resolve => real.setTimeout(resolve, 0));
+
+/**
+ * First virtual timer/frame id. Real ids count up from 1, so virtual ones start far above them: a virtual id kept by
+ * a caller can never clear an unrelated real timer.
+ */
+const VIRTUAL_ID_BASE = 2 ** 30;
+
+let installed = false;
+let now = 0;
+let dateOffset = 0;
+let nextId = VIRTUAL_ID_BASE;
+/** @type {Array<{id: number, cb: Function}>} */
+let frameQueue = [];
+/** @type {Map<number, {at: number, cb: Function, args: Array, interval: number}>} */
+let timers = new Map();
+/**
+ * Real ids of virtual timers and frames moved onto the real clock by uninstallVirtualClock(), by virtual id
+ * @type {Map<number, number>}
+ */
+const migratedTimers = new Map();
+/** @type {Map<number, number>} */
+const migratedFrames = new Map();
+
+/**
+ * Clears a timer by the id its caller holds: a virtual id moved onto the real clock is translated, other virtual
+ * ids are ignored, real ids go to the real function.
+ * @param {function(number): void} realClear
+ * @param {Map<number, number>} migrated
+ * @returns {function(number): void}
+ */
+const clearThrough = (realClear, migrated) => (id) => {
+    if (migrated.has(id)) {
+        realClear(migrated.get(id));
+        migrated.delete(id);
+    } else if (!(id >= VIRTUAL_ID_BASE)) {
+        realClear(id);
+    }
+};
+const clearMigratedTimeout = clearThrough(real.clearTimeout, migratedTimers);
+const clearMigratedInterval = clearThrough(real.clearInterval, migratedTimers);
+const cancelMigratedFrame = clearThrough((id) => real.cancelAnimationFrame?.(id), migratedFrames);
+
+/** @returns {boolean} */
+export const isVirtualClockInstalled = () => installed;
+
+/** @returns {number} Current virtual time in ms */
+export const virtualNow = () => now;
+
+/**
+ * Replaces the global timing functions with the virtual clock, starting at the current real time.
+ * Timers already pending on the real clock keep running on it.
+ */
+export function installVirtualClock() {
+    if (installed) return;
+    installed = true;
+    now = real.performanceNow();
+    dateOffset = real.dateNow() - now;
+    frameQueue = [];
+    timers = new Map();
+
+    window.requestAnimationFrame = (cb) => {
+        const id = nextId++;
+        frameQueue.push({id, cb});
+        return id;
+    };
+    window.cancelAnimationFrame = (id) => {
+        const length = frameQueue.length;
+        frameQueue = frameQueue.filter(entry => entry.id !== id);
+        if (frameQueue.length === length) cancelMigratedFrame(id);
+    };
+    window.setTimeout = (cb, delay = 0, ...args) => {
+        const id = nextId++;
+        timers.set(id, {at: now + Math.max(0, Number(delay) || 0), cb, args, interval: 0});
+        return id;
+    };
+    window.setInterval = (cb, delay = 0, ...args) => {
+        const id = nextId++;
+        const interval = Math.max(1, Number(delay) || 0);
+        timers.set(id, {at: now + interval, cb, args, interval});
+        return id;
+    };
+    window.clearTimeout = (id) => {
+        if (!timers.delete(id)) clearMigratedTimeout(id);
+    };
+    window.clearInterval = (id) => {
+        if (!timers.delete(id)) clearMigratedInterval(id);
+    };
+    performance.now = () => now;
+    Date.now = () => Math.round(now + dateOffset);
+}
+
+/**
+ * Restores the real timing functions. Virtual timers still pending are moved onto the real clock; the clear and
+ * cancel functions keep translating their virtual ids, so callers can still stop them.
+ */
+export function uninstallVirtualClock() {
+    if (!installed) return;
+    installed = false;
+
+    window.requestAnimationFrame = real.requestAnimationFrame;
+    window.cancelAnimationFrame = cancelMigratedFrame;
+    window.setTimeout = real.setTimeout;
+    window.clearTimeout = clearMigratedTimeout;
+    window.setInterval = real.setInterval;
+    window.clearInterval = clearMigratedInterval;
+    delete performance.now;
+    Date.now = real.dateNow;
+
+    for (const {id, cb} of frameQueue) {
+        migratedFrames.set(id, real.requestAnimationFrame((time) => {
+            migratedFrames.delete(id);
+            cb(time);
+        }));
+    }
+    for (const [id, {at, cb, args, interval}] of timers) {
+        if (interval) {
+            migratedTimers.set(id, real.setInterval(cb, interval, ...args));
+        } else {
+            migratedTimers.set(id, real.setTimeout(() => {
+                migratedTimers.delete(id);
+                cb(...args);
+            }, Math.max(0, at - now)));
+        }
+    }
+    frameQueue = [];
+    timers = new Map();
+}
+
+/**
+ * Moves virtual time forward by one frame: fires the timers that fall due (in order, settling promise chains in
+ * between), then runs the animation frame callbacks queued before this frame with the new timestamp.
+ * @param {number} ms
+ * @returns {Promise<void>}
+ */
+export async function advanceVirtualClock(ms) {
+    const target = now + ms;
+
+    for (; ;) {
+        let due = null;
+        let dueId = 0;
+        for (const [id, timer] of timers) {
+            if (timer.at <= target && (!due || timer.at < due.at)) {
+                due = timer;
+                dueId = id;
+            }
+        }
+        if (!due) break;
+
+        now = Math.max(now, due.at);
+        if (due.interval) due.at += due.interval;
+        else timers.delete(dueId);
+        due.cb(...due.args);
+        await yieldToEventLoop();
+    }
+
+    now = target;
+    const frame = frameQueue;
+    frameQueue = [];
+    for (const {cb} of frame) cb(now);
+    await yieldToEventLoop();
+}
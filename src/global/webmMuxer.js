@@ -0,0 +1,220 @@
+/**
+ * @module WebMMuxer
+ * @author Radim Brnka
+ * @description Minimal streaming WebM (Matroska) muxer for a single video track of WebCodecs chunks. The segment is
+ * written with unknown size, so the header goes out first and each cluster is flushed as soon as the next keyframe
+ * starts a new one; memory use is bounded by one cluster. Timestamps are in milliseconds (TimecodeScale 1e6 ns).
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/** Matroska element IDs (with their length-marker bits) */
+const ID = {
+    EBML: 0x1A45DFA3,
+    EBMLVersion: 0x4286,
+    EBMLReadVersion: 0x42F7,
+    EBMLMaxIDLength: 0x42F2,
+    EBMLMaxSizeLength: 0x42F3,
+    DocType: 0x4282,
+    DocTypeVersion: 0x4287,
+    DocTypeReadVersion: 0x4285,
+    Segment: 0x18538067,
+    Info: 0x1549A966,
+    TimecodeScale: 0x2AD7B1,
+    MuxingApp: 0x4D80,
+    WritingApp: 0x5741,
+    Tracks: 0x1654AE6B,
+    TrackEntry: 0xAE,
+    TrackNumber: 0xD7,
+    TrackUID: 0x73C5,
+    TrackType: 0x83,
+    CodecID: 0x86,
+    DefaultDuration: 0x23E383,
+    Video: 0xE0,
+    PixelWidth: 0xB0,
+    PixelHeight: 0xBA,
+    Cluster: 0x1F43B675,
+    Timecode: 0xE7,
+    SimpleBlock: 0xA3,
+};
+
+/** "Unknown" 8-byte element size (live / streamed segment) */
+const UNKNOWN_SIZE = [0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF];
+
+// region > EBML ENCODING ----------------------------------------------------------------------------------------------
+
+/**
+ * Element ID bytes (IDs already carry their length marker).
+ * @param {number} id
+ * @returns {number[]}
+ */
+function idBytes(id) {
+    const out = [];
+    for (let v = id; v > 0; v = Math.floor(v / 256)) out.unshift(v & 0xFF);
+    return out;
+}
+
+/**
+ * Variable-length size (EBML vint), shortest form.
+ * @param {number} size
+ * @returns {number[]}
+ */
+export function vint(size) {
+    let length = 1;
+    while (size >= 2 ** (7 * length) - 1) length++;
+    const out = new Array(length);
+    let v = size;
+    for (let i = length - 1; i >= 0; i--) {
+        out[i] = v & 0xFF;
+        v = Math.floor(v / 256);
+    }
+    out[0] |= 0x80 >> (length - 1);
+    return out;
+}
+
+function uintBytes(value) {
+    const out = [];
+    let v = value;
+    do {
+        out.unshift(v & 0xFF);
+        v = Math.floor(v / 256);
+    } while (v > 0);
+    return out;
+}
+
+/**
+ * @param {number} id
+ * @param {ArrayLike<number>} payload
+ * @returns {number[]}
+ */
+function element(id, payload) {
+    return [...idBytes(id), ...vint(payload.length), ...payload];
+}
+
+const uintElement = (id, value) => element(id, uintBytes(value));
+const stringElement = (id, value) => element(id, Array.from(value, c => c.charCodeAt(0) & 0xFF));
+
+// endregion -----------------------------------------------------------------------------------------------------------
+
+export class WebMMuxer {
+
+    /**
+     * @param {ByteSink} sink
+     * @param {Object} options
+     * @param {number} options.width
+     * @param {number} options.height
+     * @param {string} options.codecId Matroska codec id, e.g. 'V_VP9' or 'V_VP8'
+     * @param {number} [options.frameRate] Nominal frame rate (written as DefaultDuration)
+     * @param {string} [options.app] Writing application name
+     */
+    constructor(sink, options) {
+        this.sink = sink;
+        this.options = options;
+        this.headerWritten = false;
+        /** @type {Array<Uint8Array>} Encoded SimpleBlock elements of the open cluster */
+        this.blocks = [];
+        this.blockBytes = 0;
+        this.clusterTime = -1;
+    }
+
+    async writeHeader() {
+        const {width, height, codecId, frameRate, app = 'Fractal Traveler'} = this.options;
+
+        const ebml = element(ID.EBML, [
+            ...uintElement(ID.EBMLVersion, 1),
+            ...uintElement(ID.EBMLReadVersion, 1),
+            ...uintElement(ID.EBMLMaxIDLength, 4),
+            ...uintElement(ID.EBMLMaxSizeLength, 8),
+            ...stringElement(ID.DocType, 'webm'),
+            ...uintElement(ID.DocTypeVersion, 4),
+            ...uintElement(ID.DocTypeReadVersion, 2),
+        ]);
+
+        const info = element(ID.Info, [
+            ...uintElement(ID.TimecodeScale, 1000000),
+            ...stringElement(ID.MuxingApp, app),
+            ...stringElement(ID.WritingApp, app),
+        ]);
+
+        const track = element(ID.TrackEntry, [
+            ...uintElement(ID.TrackNumber, 1),
+            ...uintElement(ID.TrackUID, 1),
+            ...uintElement(ID.TrackType, 1),
+            ...stringElement(ID.CodecID, codecId),
+            ...(frameRate ? uintElement(ID.DefaultDuration, Math.round(1e9 / frameRate)) : []),
+            ...element(ID.Video, [
+                ...uintElement(ID.PixelWidth, width),
+                ...uintElement(ID.PixelHeight, height),
+            ]),
+        ]);
+
+        await this.sink.write(new Uint8Array([
+            ...ebml,
+            ...idBytes(ID.Segment), ...UNKNOWN_SIZE,
+            ...info,
+            ...element(ID.Tracks, track),
+        ]));
+        this.headerWritten = true;
+    }
+
+    /**
+     * Adds one encoded frame. Keyframes start a new cluster (block timecodes are 16-bit cluster-relative).
+     * @param {EncodedVideoChunk|{type: string, timestamp: number, byteLength: number, copyTo: function(Uint8Array)}} chunk
+     */
+    async addChunk(chunk) {
+        if (!this.headerWritten) await this.writeHeader();
+
+        const timeMs = Math.round(chunk.timestamp / 1000);
+        const keyframe = chunk.type === 'key';
+        if (this.clusterTime < 0 || keyframe || timeMs - this.clusterTime > 32000) {
+            await this.flushCluster();
+            this.clusterTime = timeMs;
+        }
+
+        const data = new Uint8Array(chunk.byteLength);
+        chunk.copyTo(data);
+
+        const relative = timeMs - this.clusterTime;
+        const head = [0x81, (relative >> 8) & 0xFF, relative & 0xFF, keyframe ? 0x80 : 0x00];
+        const sizeBytes = vint(head.length + data.length);
+        const block = new Uint8Array(1 + sizeBytes.length + head.length + data.length);
+        block[0] = ID.SimpleBlock;
+        block.set(sizeBytes, 1);
+        block.set(head, 1 + sizeBytes.length);
+        block.set(data, 1 + sizeBytes.length + head.length);
+
+        this.blocks.push(block);
+        this.blockBytes += block.length;
+    }
+
+    async flushCluster() {
+        if (this.blocks.length === 0) return;
+
+        const timecode = uintElement(ID.Timecode, this.clusterTime);
+        const size = timecode.length + this.blockBytes;
+        const head = [...idBytes(ID.Cluster), ...vint(size), ...timecode];
+
+        const out = new Uint8Array(head.length + this.blockBytes);
+        out.set(head, 0);
+        let offset = head.length;
+        for (const block of this.blocks) {
+            out.set(block, offset);
+            offset += block.length;
+        }
+        this.blocks = [];
+        this.blockBytes = 0;
+        await this.sink.write(out);
+    }
+
+    /** Flushes the last cluster and closes the sink. */
+    async finish() {
+        if (!this.headerWritten) await this.writeHeader();
+        await this.flushCluster();
+        await this.sink.close();
+    }
+
+    async abort() {
+        this.blocks = [];
+        await this.sink.abort?.();
+    }
+}
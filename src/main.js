@@ -8,10 +8,7 @@
 
 import './css/style.css';
 import './css/debugPanel.css';
-import {JuliaRenderer} from "./renderers/juliaRenderer";
-import MandelbrotRenderer from "./renderers/mandelbrotRenderer";
-import RiemannRenderer from "./renderers/riemannRenderer";
-import {RosslerRenderer} from "./renderers/rosslerRenderer";
+import {loadMode} from "./renderers/modeLoader";
 import {
     hideViewInfo,
     initUI,
@@ -20,11 +17,22 @@ import {
     showViewInfo,
     updateInfo
 } from "./ui/ui";
-import {asyncDelay, clearURLParams, loadFractalParamsFromURL} from "./global/utils";
+import {asyncDelay, clearURLParams, getFractalName, loadFractalParamsFromURL} from "./global/utils";
+import {showCachedFrame, storeViewFrame} from "./ui/frameCache";
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEBUG_LEVEL, DEBUG_MODE, FRACTAL_TYPE} from "./global/constants";
 
+/**
+ * Shows a startup failure in the info label, the only UI available before the renderer exists.
+ * @param {string} message
+ */
+function showStartupError(message) {
+    document.getElementById('infoText').textContent = message;
+    document.getElementById('infoLabel').classList.add('ready');
+}
+
 /**
  * Initializes the canvas, reads URL params and triggers respective fractal rendering
+ * @returns {Promise<boolean>} false when the fractal mode could not be loaded and startup stopped
  */
 async function initFractalApp() {
     if (DEBUG_MODE > DEBUG_LEVEL.VERBOSE) console.warn(' --- FULL DEBUG MODE ACTIVE! ---');
@@ -54,46 +62,33 @@ async function initFractalApp() {
         clearURLParams();
     }
 
-    let fractalApp;
-
-    switch (params.mode) {
-        /************
-         * JULIA SET
-         ************/
-        case FRACTAL_TYPE.JULIA:
-            console.log(`Constructing Julia.`);
-            fractalApp = new JuliaRenderer(canvas);
-            break;
-
-        /****************
-         * MANDELBROT SET
-         ****************/
-        case FRACTAL_TYPE.MANDELBROT:
-            console.log(`Constructing Mandelbrot.`);
-            fractalApp = new MandelbrotRenderer(canvas);
-            break;
-
-        /****************
-         * RIEMANN ZETA
-         ****************/
-        case FRACTAL_TYPE.RIEMANN:
-            console.log(`Constructing Riemann Zeta.`);
-            fractalApp = new RiemannRenderer(canvas);
-            break;
-
-        /****************
-         * ROSSLER ATTRACTOR
-         ****************/
-        case FRACTAL_TYPE.ROSSLER:
-            console.log(`Constructing Rossler.`);
-            fractalApp = new RosslerRenderer(canvas);
-            break;
-
-        default:
-            console.error('Unknown fractal mode: ' + params.mode);
-            break;
+    // Only the chunk of the opened mode is fetched; the others load on demand (see modeLoader.js)
+    let loadError = null;
+    const modeModules = loadMode(params.mode).catch(e => {
+        console.error(`Fractal mode "${params.mode}" could not be loaded: ${e}`);
+        loadError = e;
+        return null;
+    });
+
+    // Cover the shader compilation and travel with the view's stored frame from an earlier session
+    const hideCachedFrame = validMandelbrotTravelPreset
+        ? await showCachedFrame({mode: params.mode, ...preset})
+        : () => {
+        };
+
+    const modules = await modeModules;
+    if (!modules) {
+        // Nothing to render without the renderer; say so instead of failing on a missing app further on
+        hideCachedFrame();
+        showStartupError(`${getFractalName(params.mode)} could not be loaded (${loadError?.message ?? loadError}). ` +
+            `Check the connection and reload the page.`);
+        console.groupEnd();
+        return false;
     }
 
+    console.log(`Constructing ${getFractalName(params.mode)}.`);
+    const fractalApp = new modules.Renderer(canvas);
+
     await asyncDelay(100); // Wait a moment for things to stabilize
     await initUI(fractalApp); // TODO consider initializing after travel
 
@@ -106,6 +101,8 @@ async function initFractalApp() {
     } else {
         onDefault();
     }
+    hideCachedFrame();
+    if (validMandelbrotTravelPreset) storeViewFrame(fractalApp, params.mode, params.paletteId);
 
     await asyncDelay(100); // Wait a moment for things to stabilize
 
@@ -139,16 +136,22 @@ async function initFractalApp() {
     }
 
     console.groupEnd();
+    return true;
 }
 
 document.addEventListener('DOMContentLoaded', async () => {
         if (DEBUG_MODE) console.log('%c DOMContentLoaded: %c Initializing fractal.', CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
 
-        await initFractalApp();
+        if (!await initFractalApp()) return;
         console.log('%c DOMContentLoaded: %c Fractal init complete.', CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
 
         await asyncDelay(2000); // Wait a moment for things to stabilize
         updateInfo();
+
+        // Production builds ship a service worker caching the app for repeat starts and offline use
+        if (!__DEV__ && 'serviceWorker' in navigator) {
+            navigator.serviceWorker.register('sw.js').catch(e => console.warn(`Service worker not registered: ${e}`));
+        }
     }, {
         once: true
     }
@@ -33,7 +33,7 @@ export class RosslerRenderer extends FractalRenderer {
         this.phase = [...this.DEFAULT_PHASE];
 
         this.zoom = this.DEFAULT_ZOOM;
-        this.pan = this.DEFAULT_PAN.slice();
+        this.setPan(this.DEFAULT_PAN[0], this.DEFAULT_PAN[1]);
         this.rotation = this.DEFAULT_ROTATION;
         this.colorPalette = this.DEFAULT_PALETTE.slice();
         this.params = this.DEFAULT_PARAMS.slice();
@@ -76,6 +76,8 @@ export class RosslerRenderer extends FractalRenderer {
     }
 
     draw() {
+        if (!this.gl) return;
+
         this.gl.useProgram(this.program);
 
         // Compute dynamic iteration count (base + slider adjustment + adaptive quality)
@@ -270,8 +272,9 @@ export class RosslerRenderer extends FractalRenderer {
             return (demoIndex + 1) % allPresets.length;
         };
 
+        let nextIndex = getNextPresetIndex(random);
         while (this.demoActive) {
-            demoIndex = getNextPresetIndex(random);
+            demoIndex = nextIndex;
             const currentPreset = allPresets[demoIndex];
 
             if (!currentPreset) {
@@ -290,7 +293,8 @@ export class RosslerRenderer extends FractalRenderer {
 
             if (onPresetComplete) onPresetComplete();
 
-            await asyncDelay(3500);
+            nextIndex = getNextPresetIndex(random);
+            await Promise.all([asyncDelay(3500), this.prefetchView(allPresets[nextIndex])]);
         }
 
         console.log(`Demo interrupted.`);
@@ -0,0 +1,438 @@
+/**
+ * @module CpuBackend
+ * @author Radim Brnka
+ * @description CPU rendering backend, used when the GPU path cannot run: no WebGL context at all, or no
+ * OES_texture_float for the perturbation orbit texture. Frames are rendered by the float64 kernels of cpuKernel.js
+ * on a pool of workers. The frame is split into tiles, and every tile is rendered in progressive passes (blocks of
+ * 8, 4, 2 and finally 1 pixel), so a moving view shows a coarse image at once and sharpens when it stops. With cross
+ * origin isolation the workers write straight into a SharedArrayBuffer framebuffer. Otherwise tiles travel as
+ * transferred buffers. The result is drawn with a 2D context when WebGL is missing, or uploaded as an RGBA8 texture
+ * (no float textures needed) and drawn over the canvas. Without Worker support (e.g. tests) the same passes run on
+ * the main thread in short slices.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log, LOG_LEVEL} from "../global/constants";
+import {real, yieldToEventLoop} from "../global/virtualClock";
+import {computeOrbit, PASS_STEPS, renderTile} from "./cpuKernel";
+import frameFragmentSource from '../shaders/cpuFrame.frag';
+
+/** Tile edge in pixels (a multiple of PASS_STEPS[0], so the pass grids line up across tiles) */
+export const CPU_TILE_SIZE = 64;
+/** Upper bound of the worker pool */
+const MAX_WORKERS = 8;
+/** Main-thread time slice (ms) when rendering without workers */
+const INLINE_SLICE_MS = 12;
+/** Partial results of a pass are shown at most this often (ms) */
+const PRESENT_INTERVAL_MS = 100;
+
+export class CpuBackend {
+
+    /**
+     * @param {FractalRenderer} renderer Owner; provides the canvas, the GL context (if any) and the frames
+     */
+    constructor(renderer) {
+        this.renderer = renderer;
+        this.canvas = renderer.canvas;
+        /** @type {WebGLRenderingContext|null} Present when only float textures are missing */
+        this.gl = renderer.gl ?? null;
+        /** @type {CanvasRenderingContext2D|null} */
+        this.ctx2d = this.gl ? null : this.canvas?.getContext('2d') ?? null;
+
+        /** Workers write into one shared framebuffer (needs cross-origin isolation) */
+        this.sharedMemory = typeof SharedArrayBuffer !== 'undefined' && globalThis.crossOriginIsolated === true;
+
+        const cores = globalThis.navigator?.hardwareConcurrency || 2;
+        /** Pool size; 0 renders on the main thread */
+        this.workerCount = typeof Worker === 'undefined' ? 0 : Math.max(1, Math.min(MAX_WORKERS, cores - 1));
+        /** @type {Worker[]} */
+        this.workers = [];
+        /** @type {Worker[]} */
+        this.idle = [];
+        this.ready = this.workerCount > 0 ? this.spawnWorkers() : Promise.resolve();
+
+        /** @type {import('./cpuKernel').CpuFrame|null} */
+        this.frame = null;
+        this.frameKey = '';
+        /** Bumped by every new frame; results of older generations are dropped */
+        this.generation = 0;
+
+        /** RGBA framebuffer, top-down rows */
+        this.pixels = new Uint8Array(0);
+        /** @type {Array<{x: number, y: number, width: number, height: number}>} Centre first */
+        this.tiles = [];
+        this.tilesWidth = 0;
+        this.tilesHeight = 0;
+        /** @type {Array<{tile: Object, step: number}>} Jobs of the running pass not handed out yet */
+        this.queue = [];
+        /** Jobs of the running pass not finished yet */
+        this.outstanding = 0;
+        this.passIndex = 0;
+        this.lastPresent = 0;
+        /** Shared framebuffer only: the first pass waits for tiles of superseded frames still being rendered */
+        this.awaitingStale = false;
+
+        /** Main-thread orbit (inline mode) */
+        this.orbit = new Float64Array(0);
+        this.orbitLength = 0;
+
+        this.done = Promise.resolve(false);
+        this.resolveDone = null;
+
+        /** @type {WebGLProgram|null} */
+        this.frameProgram = null;
+        /** @type {WebGLTexture|null} */
+        this.frameTexture = null;
+        /** @type {ImageData|null} */
+        this.image = null;
+
+        log(`${this.workerCount} worker(s), ${this.sharedMemory ? 'shared' : 'transferred'} framebuffer, ` +
+            `${this.gl ? 'WebGL' : '2D'} presentation.`, 'CpuBackend');
+    }
+
+    // region > FRAME --------------------------------------------------------------------------------------------------
+
+    /**
+     * Starts rendering a frame, superseding the one in progress. Requesting the frame already being rendered (or
+     * shown) is a no-op.
+     * @param {import('./cpuKernel').CpuFrame} frame
+     * @returns {Promise<boolean>} Resolves true once the last pass is shown, false if superseded first
+     */
+    render(frame) {
+        const key = JSON.stringify(frame);
+        if (key === this.frameKey) return this.done;
+        this.frameKey = key;
+
+        this.resolveDone?.(false);
+        this.done = new Promise(resolve => this.resolveDone = resolve);
+
+        const generation = ++this.generation;
+        this.frame = frame;
+        this.queue.length = 0;
+        this.outstanding = 0;
+        this.awaitingStale = false;
+
+        if (!(frame.width > 0 && frame.height > 0)) {
+            this.finish(true);
+            return this.done;
+        }
+
+        this.allocate(frame.width, frame.height);
+        this.ready.then(() => {
+            if (generation === this.generation) this.beginFrame(generation);
+        });
+        return this.done;
+    }
+
+    /**
+     * (Re)allocates the framebuffer and tile list for a frame size.
+     * @param {number} width
+     * @param {number} height
+     */
+    allocate(width, height) {
+        const size = width * height * 4;
+        if (this.pixels.length !== size) {
+            this.pixels = new Uint8Array(this.sharedMemory ? new SharedArrayBuffer(size) : new ArrayBuffer(size));
+            this.image = null;
+        }
+        if (this.tilesWidth === width && this.tilesHeight === height) return;
+
+        const tiles = [];
+        for (let y = 0; y < height; y += CPU_TILE_SIZE) {
+            for (let x = 0; x < width; x += CPU_TILE_SIZE) {
+                tiles.push({x, y, width: Math.min(CPU_TILE_SIZE, width - x), height: Math.min(CPU_TILE_SIZE, height - y)});
+            }
+        }
+        // Centre first: the part of the view the eye is on sharpens first
+        const distance = (t) => Math.hypot(t.x + t.width / 2 - width / 2, t.y + t.height / 2 - height / 2);
+        tiles.sort((a, b) => distance(a) - distance(b));
+        this.tiles = tiles;
+        this.tilesWidth = width;
+        this.tilesHeight = height;
+    }
+
+    /**
+     * Hands the frame to the workers (or builds the orbit locally) and starts the first pass. With a shared
+     * framebuffer, a worker still busy with a superseded frame's tile keeps writing into it, and the later passes
+     * skip the pixels the first pass set; so the first pass only starts once every such tile has reported back.
+     * @param {number} generation
+     */
+    beginFrame(generation) {
+        const frame = this.frame;
+        if (this.workers.length > 0) {
+            const framebuffer = this.sharedMemory ? this.pixels.buffer : null;
+            for (const worker of this.workers) worker.postMessage({type: 'frame', frame, generation, framebuffer});
+            if (this.sharedMemory && this.idle.length < this.workers.length) {
+                this.awaitingStale = true;
+                return;
+            }
+        } else {
+            if (this.orbit.length < 2 * (frame.iterations + 1)) this.orbit = new Float64Array(2 * (frame.iterations + 1));
+            this.orbitLength = computeOrbit(frame, this.orbit);
+        }
+        this.startPass(0);
+    }
+
+    /**
+     * Queues every tile for a pass.
+     * @param {number} index PASS_STEPS index
+     */
+    startPass(index) {
+        const step = PASS_STEPS[index];
+        this.passIndex = index;
+        this.queue = this.tiles.map(tile => ({tile, step}));
+        this.outstanding = this.queue.length;
+
+        if (this.workers.length > 0) this.dispatch();
+        else this.runInline(this.generation);
+    }
+
+    /**
+     * Shows a finished pass and moves on to the next one.
+     */
+    finishPass() {
+        this.present();
+        if (this.passIndex + 1 < PASS_STEPS.length) this.startPass(this.passIndex + 1);
+        else this.finish(true);
+    }
+
+    /**
+     * Settles the frame's promise.
+     * @param {boolean} completed
+     */
+    finish(completed) {
+        this.resolveDone?.(completed);
+        this.resolveDone = null;
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+    // region > WORKERS ------------------------------------------------------------------------------------------------
+
+    /**
+     * Creates the pool. Falls back to main-thread rendering if workers cannot be created.
+     * @returns {Promise<void>}
+     */
+    async spawnWorkers() {
+        try {
+            // Loaded on demand so environments without workers never see the bundler-specific worker URL
+            const {createRenderWorker} = await import(/* webpackChunkName: "cpu-backend" */ './cpuWorkers');
+            for (let i = 0; i < this.workerCount; i++) {
+                const worker = createRenderWorker();
+                worker.onmessage = ({data}) => this.onWorkerMessage(worker, data);
+                worker.onerror = (event) => log(`Render worker failed: ${event.message}`, 'CpuBackend', LOG_LEVEL.ERROR);
+                this.workers.push(worker);
+                this.idle.push(worker);
+            }
+        } catch (error) {
+            log(`Workers unavailable (${error}), rendering on the main thread.`, 'CpuBackend');
+            for (const worker of this.workers) worker.terminate();
+            this.workers = [];
+            this.idle = [];
+            // Transferred tiles need no shared memory on the main thread
+            this.sharedMemory = false;
+            this.pixels = new Uint8Array(0);
+            if (this.frame) this.allocate(this.frame.width, this.frame.height);
+        }
+    }
+
+    /**
+     * Hands queued jobs to idle workers.
+     */
+    dispatch() {
+        while (this.idle.length > 0 && this.queue.length > 0) {
+            const worker = this.idle.pop();
+            const {tile, step} = this.queue.shift();
+            if (this.sharedMemory) {
+                worker.postMessage({type: 'tile', generation: this.generation, tile, step});
+            } else {
+                const pixels = this.copyTileOut(tile);
+                worker.postMessage({type: 'tile', generation: this.generation, tile, step, pixels}, [pixels.buffer]);
+            }
+        }
+    }
+
+    /**
+     * A worker finished a job.
+     * @param {Worker} worker
+     * @param {{generation: number, tile: Object, pixels: Uint8Array|null}} data
+     */
+    onWorkerMessage(worker, data) {
+        if (!this.workers.includes(worker)) return;
+        this.idle.push(worker);
+
+        if (this.awaitingStale) {
+            if (this.idle.length === this.workers.length) {
+                this.awaitingStale = false;
+                this.startPass(0);
+            }
+            return;
+        }
+
+        if (data.generation === this.generation && this.outstanding > 0) {
+            if (data.pixels) this.copyTileIn(data.tile, data.pixels);
+            if (--this.outstanding === 0) {
+                this.finishPass();
+            } else if (real.performanceNow() - this.lastPresent > PRESENT_INTERVAL_MS) {
+                this.present();
+            }
+        }
+        this.dispatch();
+    }
+
+    /**
+     * Renders the queued jobs on the main thread, yielding between slices.
+     * @param {number} generation
+     * @returns {Promise<void>}
+     */
+    async runInline(generation) {
+        const target = {data: this.pixels, stride: this.frame.width, originX: 0, originY: 0};
+
+        while (this.queue.length > 0) {
+            const sliceEnd = real.performanceNow() + INLINE_SLICE_MS;
+            while (this.queue.length > 0 && real.performanceNow() < sliceEnd) {
+                const {tile, step} = this.queue.shift();
+                renderTile(this.frame, this.orbit, this.orbitLength, tile, step, target);
+            }
+            if (real.performanceNow() - this.lastPresent > PRESENT_INTERVAL_MS) this.present();
+            await yieldToEventLoop();
+            if (generation !== this.generation) return;
+        }
+        this.outstanding = 0;
+        this.finishPass();
+    }
+
+    /**
+     * Copies a tile out of the framebuffer (transferred mode: the worker paints the next pass over it).
+     * @param {{x: number, y: number, width: number, height: number}} tile
+     * @returns {Uint8Array}
+     */
+    copyTileOut(tile) {
+        const out = new Uint8Array(tile.width * tile.height * 4);
+        const rowBytes = tile.width * 4;
+        for (let row = 0; row < tile.height; row++) {
+            const from = ((tile.y + row) * this.frame.width + tile.x) * 4;
+            out.set(this.pixels.subarray(from, from + rowBytes), row * rowBytes);
+        }
+        return out;
+    }
+
+    /**
+     * Copies a rendered tile back into the framebuffer.
+     * @param {{x: number, y: number, width: number, height: number}} tile
+     * @param {Uint8Array} pixels
+     */
+    copyTileIn(tile, pixels) {
+        const rowBytes = tile.width * 4;
+        for (let row = 0; row < tile.height; row++) {
+            this.pixels.set(pixels.subarray(row * rowBytes, (row + 1) * rowBytes), ((tile.y + row) * this.frame.width + tile.x) * 4);
+        }
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+    // region > PRESENTATION -------------------------------------------------------------------------------------------
+
+    /**
+     * Shows the framebuffer on the canvas.
+     */
+    present() {
+        this.lastPresent = real.performanceNow();
+        const {width, height} = this.frame;
+
+        if (this.ctx2d) {
+            if (!this.image) this.image = this.ctx2d.createImageData(width, height);
+            // ImageData cannot view shared memory, hence the copy
+            this.image.data.set(this.pixels);
+            this.ctx2d.putImageData(this.image, 0, 0);
+        } else if (this.gl) {
+            this.drawTexture(width, height);
+        }
+    }
+
+    /**
+     * Uploads the framebuffer as an RGBA8 texture and draws it over the canvas.
+     * @param {number} width
+     * @param {number} height
+     */
+    drawTexture(width, height) {
+        const gl = this.gl;
+        if (!this.frameProgram) this.createFrameProgram();
+        if (!this.frameProgram) return;
+
+        gl.useProgram(this.frameProgram);
+        gl.bindBuffer(gl.ARRAY_BUFFER, this.renderer.positionBuffer);
+        gl.enableVertexAttribArray(this.framePositionLoc);
+        gl.vertexAttribPointer(this.framePositionLoc, 2, gl.FLOAT, false, 0, 0);
+
+        gl.activeTexture(gl.TEXTURE0);
+        gl.bindTexture(gl.TEXTURE_2D, this.frameTexture);
+        // WebGL 1 cannot upload from shared memory
+        const pixels = this.sharedMemory ? this.pixels.slice() : this.pixels;
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, width, height, 0, gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+        gl.uniform1i(this.frameTexLoc, 0);
+        gl.uniform2f(this.frameResolutionLoc, width, height);
+
+        gl.viewport(0, 0, width, height);
+        gl.drawArrays(gl.TRIANGLE_STRIP, 0, 4);
+
+        this.renderer.bindFullscreenQuad();
+    }
+
+    /**
+     * Compiles the frame program (shared vertex shader + cpuFrame.frag) and creates its texture.
+     */
+    createFrameProgram() {
+        const gl = this.gl;
+        const renderer = this.renderer;
+        const vertexShader = renderer.compileShader(renderer.vertexShaderSource, gl.VERTEX_SHADER);
+        const fragmentShader = renderer.compileShader(frameFragmentSource, gl.FRAGMENT_SHADER);
+        if (!vertexShader || !fragmentShader) return;
+
+        const program = gl.createProgram();
+        gl.attachShader(program, vertexShader);
+        gl.attachShader(program, fragmentShader);
+        gl.linkProgram(program);
+        gl.deleteShader(vertexShader);
+        gl.deleteShader(fragmentShader);
+        if (!gl.getProgramParameter(program, gl.LINK_STATUS)) {
+            console.error(gl.getProgramInfoLog(program));
+            gl.deleteProgram(program);
+            return;
+        }
+
+        this.frameProgram = program;
+        this.framePositionLoc = gl.getAttribLocation(program, 'a_position');
+        this.frameTexLoc = gl.getUniformLocation(program, 'u_frame');
+        this.frameResolutionLoc = gl.getUniformLocation(program, 'u_resolution');
+
+        this.frameTexture = gl.createTexture();
+        gl.bindTexture(gl.TEXTURE_2D, this.frameTexture);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.NEAREST);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.NEAREST);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+
+    /**
+     * Stops the pool and releases GL resources. The pending frame resolves false.
+     */
+    destroy() {
+        this.generation++;
+        this.queue.length = 0;
+        this.finish(false);
+
+        for (const worker of this.workers) worker.terminate();
+        this.workers = [];
+        this.idle = [];
+
+        if (this.gl) {
+            if (this.frameProgram) this.gl.deleteProgram(this.frameProgram);
+            if (this.frameTexture) this.gl.deleteTexture(this.frameTexture);
+        }
+        this.frameProgram = null;
+        this.frameTexture = null;
+        this.renderer = null;
+    }
+}
@@ -0,0 +1,282 @@
+/**
+ * @module CpuKernel
+ * @author Radim Brnka
+ * @description Float64 CPU versions of the Mandelbrot and Julia perturbation kernels and their colouring, used by the
+ * CPU rendering backend (see cpuBackend.js). They follow mandelbrot.frag and julia.frag: same view transform, same
+ * perturbation step and same colouring formulas, with float64 deltas where the shaders use float32 pairs. The
+ * reference is the view centre. A pixel rebases onto the start of the reference orbit when its delta outgrows the
+ * orbit value or the orbit escapes first, so one reference serves the whole frame without the GPU's reference search.
+ * Pure functions over plain objects and typed arrays, so the same code runs in workers, on the main thread and in tests.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/**
+ * Kernels the CPU backend implements
+ * @enum {string}
+ */
+export const CPU_KERNEL = Object.freeze({
+    MANDELBROT: 'mandelbrot',
+    JULIA: 'julia',
+});
+
+/** Progressive refinement passes: each computes every n-th pixel and paints it as an n x n block */
+export const PASS_STEPS = [8, 4, 2, 1];
+
+/**
+ * @typedef {Object} CpuFrame
+ * @property {string} kernel CPU_KERNEL
+ * @property {number} width Frame width in pixels
+ * @property {number} height Frame height in pixels
+ * @property {number} refX Reference point (Mandelbrot: c, Julia: z0)
+ * @property {number} refY
+ * @property {number} deltaX View centre minus the reference, the part the reference double cannot hold
+ * @property {number} deltaY
+ * @property {number} zoom
+ * @property {number} rotation Radians
+ * @property {number} iterations
+ * @property {number[]} [c] Julia constant
+ * @property {number[]} [colorPalette] Mandelbrot colour weights (RGB)
+ * @property {number[]} [frequency] Mandelbrot sine frequencies (RGB)
+ * @property {number[]} [phase] Mandelbrot sine phases (RGB)
+ * @property {ArrayLike<number>} [innerStops] Julia colour map, 5 RGB stops
+ */
+
+/**
+ * @typedef {Object} PixelTarget
+ * @property {Uint8Array|Uint8ClampedArray} data RGBA bytes
+ * @property {number} stride Row length in pixels
+ * @property {number} originX Frame column of data's first pixel
+ * @property {number} originY Frame row of data's first pixel
+ */
+
+/** |z|² at the escape of the last iteratePixel() call */
+let escapeR2 = 0;
+
+// region > ORBIT ------------------------------------------------------------------------------------------------------
+
+/**
+ * Iterates the reference: Mandelbrot from z0 = 0 with c = ref, Julia from z0 = ref with the frame's c.
+ * @param {CpuFrame} frame
+ * @param {Float64Array} orbit Receives x, y pairs; at least 2 * (frame.iterations + 1) long
+ * @returns {number} Orbit points written, including the first escaped one
+ */
+export function computeOrbit(frame, orbit) {
+    const julia = frame.kernel === CPU_KERNEL.JULIA;
+    const cx = julia ? frame.c[0] : frame.refX;
+    const cy = julia ? frame.c[1] : frame.refY;
+    let zx = julia ? frame.refX : 0;
+    let zy = julia ? frame.refY : 0;
+
+    for (let n = 0; n <= frame.iterations; n++) {
+        orbit[2 * n] = zx;
+        orbit[2 * n + 1] = zy;
+        if (zx * zx + zy * zy > 4) return n + 1;
+
+        const x = zx * zx - zy * zy + cx;
+        zy = 2 * zx * zy + cy;
+        zx = x;
+    }
+    return frame.iterations + 1;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > PIXEL ------------------------------------------------------------------------------------------------------
+
+/**
+ * Perturbation iteration of one pixel. dz_{n+1} = 2*Z*dz + dz² (+ dc for Mandelbrot), escape at |Z + dz|² > 4.
+ * @param {CpuFrame} frame
+ * @param {Float64Array} orbit
+ * @param {number} orbitLength Points in orbit (see computeOrbit)
+ * @param {number} dx Pixel offset from the reference (Mandelbrot: dc, Julia: dz0)
+ * @param {number} dy
+ * @returns {number} Escape iteration, frame.iterations for interior pixels; |z|² at escape is in getEscapeR2()
+ */
+export function iteratePixel(frame, orbit, orbitLength, dx, dy) {
+    const iterations = frame.iterations;
+    const julia = frame.kernel === CPU_KERNEL.JULIA;
+
+    if (orbitLength < 2) return iterateDirect(frame, orbit[0] + dx, orbit[1] + dy);
+
+    const dcx = julia ? 0 : dx;
+    const dcy = julia ? 0 : dy;
+    let dzx = julia ? dx : 0;
+    let dzy = julia ? dy : 0;
+    let m = 0;
+
+    for (let n = 0; n < iterations; n++) {
+        let Zx = orbit[2 * m];
+        let Zy = orbit[2 * m + 1];
+        const zx = Zx + dzx;
+        const zy = Zy + dzy;
+        const r2 = zx * zx + zy * zy;
+        if (r2 > 4) {
+            escapeR2 = r2;
+            return n;
+        }
+
+        // Rebase onto the orbit start once the delta dominates or the orbit has no next point
+        if (m + 1 >= orbitLength || r2 < dzx * dzx + dzy * dzy) {
+            Zx = orbit[0];
+            Zy = orbit[1];
+            dzx = zx - Zx;
+            dzy = zy - Zy;
+            m = 0;
+        }
+
+        const x = 2 * (Zx * dzx - Zy * dzy) + dzx * dzx - dzy * dzy + dcx;
+        dzy = 2 * (Zx * dzy + Zy * dzx) + 2 * dzx * dzy + dcy;
+        dzx = x;
+        m++;
+    }
+    return iterations;
+}
+
+/**
+ * Plain float64 iteration, for references that escape at once (a Julia z0 far outside the set).
+ * @param {CpuFrame} frame
+ * @param {number} x Pixel coordinate
+ * @param {number} y
+ * @returns {number}
+ */
+function iterateDirect(frame, x, y) {
+    const julia = frame.kernel === CPU_KERNEL.JULIA;
+    const cx = julia ? frame.c[0] : x;
+    const cy = julia ? frame.c[1] : y;
+    let zx = julia ? x : 0;
+    let zy = julia ? y : 0;
+
+    for (let n = 0; n < frame.iterations; n++) {
+        const r2 = zx * zx + zy * zy;
+        if (r2 > 4) {
+            escapeR2 = r2;
+            return n;
+        }
+        const t = zx * zx - zy * zy + cx;
+        zy = 2 * zx * zy + cy;
+        zx = t;
+    }
+    return frame.iterations;
+}
+
+/**
+ * |z|² at the escape found by the last iteratePixel() call.
+ * @returns {number}
+ */
+export const getEscapeR2 = () => escapeR2;
+
+/**
+ * Colours a pixel with the formulas of the mode's shader and stores it as RGBA bytes.
+ * @param {CpuFrame} frame
+ * @param {number} it Escape iteration
+ * @param {number} r2 |z|² at escape
+ * @param {Uint8Array|Uint8ClampedArray} out
+ * @param {number} offset Index of the red byte
+ */
+export function shadePixel(frame, it, r2, out, offset) {
+    out[offset + 3] = 255;
+    if (it >= frame.iterations) {
+        out[offset] = out[offset + 1] = out[offset + 2] = 0;
+        return;
+    }
+
+    const smooth = it - Math.log2(Math.log2(Math.max(r2, 1e-30)));
+
+    if (frame.kernel === CPU_KERNEL.JULIA) {
+        // julia.frag: stop map over a sine of the normalized count
+        let t = Math.min(Math.max(smooth / frame.iterations, 0), 1);
+        t = 0.5 + 0.6 * Math.sin(t * 4 * 3.14159265);
+        const segment = Math.min(Math.max(Math.ceil(t * 4) - 1, 0), 3);
+        const k = (t - segment * 0.25) * 4;
+        const stops = frame.innerStops;
+        for (let ch = 0; ch < 3; ch++) {
+            const from = stops[segment * 3 + ch];
+            out[offset + ch] = toByte(from + (stops[(segment + 1) * 3 + ch] - from) * k);
+        }
+        return;
+    }
+
+    // mandelbrot.frag: per-channel sine of the smooth count
+    const t = smooth / 100;
+    for (let ch = 0; ch < 3; ch++) {
+        out[offset + ch] = toByte(Math.sin(t * frame.frequency[ch] + frame.phase[ch]) * frame.colorPalette[ch]);
+    }
+}
+
+/**
+ * Unit float to an 8-bit channel, as the GL framebuffer stores it.
+ * @param {number} value
+ * @returns {number}
+ */
+const toByte = (value) => Math.round(Math.min(Math.max(value, 0), 1) * 255);
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > TILE -------------------------------------------------------------------------------------------------------
+
+/**
+ * Renders one progressive pass over a tile. The pass with step s computes the pixels on the s-grid that the coarser
+ * passes have not (every pixel on the first pass) and paints each as an s x s block clipped to the tile, so a frame
+ * sharpens from blocks of PASS_STEPS[0] pixels down to single pixels. Tiles must be aligned to PASS_STEPS[0].
+ * @param {CpuFrame} frame
+ * @param {Float64Array} orbit
+ * @param {number} orbitLength
+ * @param {{x: number, y: number, width: number, height: number}} tile Frame pixels, top-down rows
+ * @param {number} step PASS_STEPS entry
+ * @param {PixelTarget} target
+ */
+export function renderTile(frame, orbit, orbitLength, tile, step, target) {
+    const {width, height, zoom} = frame;
+    const cos = Math.cos(frame.rotation);
+    const sin = Math.sin(frame.rotation);
+    const firstPass = step === PASS_STEPS[0];
+    const coarse = 2 * step;
+    const x1 = tile.x + tile.width;
+    const y1 = tile.y + tile.height;
+
+    for (let py = tile.y; py < y1; py += step) {
+        // Shader space: st = fragCoord / resolution - 0.5, x scaled by the aspect ratio, y up
+        const sy = (height / 2 - py - 0.5) / height;
+        const coarseRow = py % coarse === 0;
+
+        for (let px = tile.x; px < x1; px += step) {
+            if (!firstPass && coarseRow && px % coarse === 0) continue;
+
+            const sx = (px + 0.5 - width / 2) / height;
+            const dx = frame.deltaX + zoom * (sx * cos - sy * sin);
+            const dy = frame.deltaY + zoom * (sx * sin + sy * cos);
+
+            const it = iteratePixel(frame, orbit, orbitLength, dx, dy);
+            fillBlock(frame, it, escapeR2, target, px, py, Math.min(step, x1 - px), Math.min(step, y1 - py));
+        }
+    }
+}
+
+/**
+ * Shades one pixel into the top-left corner of a block and copies it over the rest of the block.
+ * @param {CpuFrame} frame
+ * @param {number} it
+ * @param {number} r2
+ * @param {PixelTarget} target
+ * @param {number} px Frame column
+ * @param {number} py Frame row
+ * @param {number} w Block width
+ * @param {number} h Block height
+ */
+function fillBlock(frame, it, r2, target, px, py, w, h) {
+    const {data, stride} = target;
+    const first = ((py - target.originY) * stride + (px - target.originX)) * 4;
+    shadePixel(frame, it, r2, data, first);
+
+    for (let row = 0; row < h; row++) {
+        const base = first + row * stride * 4;
+        for (let col = row === 0 ? 1 : 0; col < w; col++) {
+            const i = base + col * 4;
+            data[i] = data[first];
+            data[i + 1] = data[first + 1];
+            data[i + 2] = data[first + 2];
+            data[i + 3] = 255;
+        }
+    }
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
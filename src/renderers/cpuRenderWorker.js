@@ -0,0 +1,48 @@
+/**
+ * @module CpuRenderWorker
+ * @author Radim Brnka
+ * @description Worker of the CPU rendering backend's pool (see cpuBackend.js). It receives a frame, builds the
+ * reference orbit once, then renders the tile passes it is sent. With a shared framebuffer the pixels are written in
+ * place. Otherwise each tile job carries a copy of the tile's current pixels (the coarser passes' blocks), which comes
+ * back transferred once the pass is painted over it.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {computeOrbit, renderTile} from "./cpuKernel";
+
+/** @type {import('./cpuKernel').CpuFrame|null} */
+let frame = null;
+let generation = -1;
+let orbit = new Float64Array(0);
+let orbitLength = 0;
+/** @type {Uint8Array|null} Shared framebuffer, null when tiles are transferred back */
+let shared = null;
+
+self.onmessage = ({data}) => {
+    if (data.type === 'frame') {
+        frame = data.frame;
+        generation = data.generation;
+        shared = data.framebuffer ? new Uint8Array(data.framebuffer) : null;
+        if (orbit.length < 2 * (frame.iterations + 1)) orbit = new Float64Array(2 * (frame.iterations + 1));
+        orbitLength = computeOrbit(frame, orbit);
+        return;
+    }
+
+    // Tile of a superseded frame: report it done without rendering so the pool moves on
+    const {tile, step} = data;
+    if (data.generation !== generation) {
+        self.postMessage({generation: data.generation, tile, step, pixels: null});
+        return;
+    }
+
+    if (shared) {
+        renderTile(frame, orbit, orbitLength, tile, step, {data: shared, stride: frame.width, originX: 0, originY: 0});
+        self.postMessage({generation, tile, step, pixels: null});
+        return;
+    }
+
+    const pixels = data.pixels;
+    renderTile(frame, orbit, orbitLength, tile, step, {data: pixels, stride: tile.width, originX: tile.x, originY: tile.y});
+    self.postMessage({generation, tile, step, pixels}, [pixels.buffer]);
+};
@@ -0,0 +1,14 @@
+/**
+ * @module CpuWorkers
+ * @author Radim Brnka
+ * @description Creates the render workers of the CPU backend (see cpuBackend.js). Kept in its own module, imported on
+ * demand, because the worker URL is resolved by the bundler and environments without workers never need it.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/**
+ * @returns {Worker} A worker running cpuRenderWorker.js (bundled as its own chunk)
+ */
+export const createRenderWorker = () =>
+    new Worker(/* webpackChunkName: "cpu-worker" */ new URL('./cpuRenderWorker.js', import.meta.url));
@@ -0,0 +1,357 @@
+/**
+ * @module ExpMapZoom
+ * @author Radim Brnka
+ * @description Exponential-map (log-polar) zoom video renderer for the Mandelbrot set. Instead of rendering every
+ * frame of a zoom from scratch, the target location is rendered once as a log-polar strip (radius from the start
+ * zoom down to the target, columns along the log-radius, rows along the angle) with the perturbation kernel and a
+ * single reference orbit. Each video frame is then resampled from the strip segments its annulus covers, and only a
+ * small centre disc (where the strip would be stretched) is rendered directly. Segments are computed lazily as the
+ * zoom reaches them and released once they leave the frame, so GPU memory stays bounded by the frame's log-radius
+ * window.
+ * Implements the drawTile() interface used by TileTarget, so frames go through the same offscreen tiling and
+ * supersampling as posters and regular video frames.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log} from "../global/constants";
+import {qdSubDDInto} from "../global/quadDouble";
+import {splitScaledDDInto, splitZoomInto} from "../global/utils";
+import {yieldToEventLoop} from "../global/virtualClock";
+import stripShaderRaw from '../shaders/mandelbrot.expmap.frag';
+import warpShaderSource from '../shaders/expmap.warp.frag';
+
+/** Zoom of the first video frame */
+export const EXP_MAP_START_ZOOM = 3.0;
+/** Log-radius window resampled from the strip; the disc inside it (corner radius / e^2) is rendered directly */
+const CENTRE_LOG_WINDOW = 2;
+/** Strip columns per segment texture (power of two, rows wrap around the angle) */
+const SEGMENT_WIDTH = 1024;
+/** Edge of the blocks a segment is rendered in (keeps single draws short) */
+const BLOCK_SIZE = 256;
+/** Texture unit of the strip segment being resampled (0 = orbit, 1 = series coefficients, 2 = overlay atlas) */
+const STRIP_TEXTURE_UNIT = 3;
+/** Iterations per octave of zoom, as in MandelbrotRenderer.draw() */
+const ITERATIONS_PER_OCTAVE = 50;
+
+const TAU = 2 * Math.PI;
+
+/**
+ * @param {number} value
+ * @returns {number} Smallest power of two >= value
+ */
+const nextPowerOfTwo = (value) => 2 ** Math.ceil(Math.log2(Math.max(1, value)));
+
+export class ExpMapZoom {
+
+    /**
+     * Freezes the current view (pan, zoom, rotation) as the zoom target.
+     * @param {MandelbrotRenderer} renderer
+     * @param {Object} options
+     * @param {number} options.width Frame width in pixels
+     * @param {number} options.height Frame height in pixels
+     * @param {number} options.frames Number of frames from the start zoom to the target
+     * @param {number} [options.supersample] Supersampling grid edge; raises the strip resolution to match
+     * @param {number} [options.startZoom]
+     */
+    constructor(renderer, options) {
+        this.app = renderer;
+        this.gl = renderer.gl;
+
+        const {width, height, frames, supersample = 1, startZoom = EXP_MAP_START_ZOOM} = options;
+        this.width = width;
+        this.height = height;
+        this.frames = frames;
+        this.startZoom = startZoom;
+        this.targetZoom = renderer.zoom;
+
+        const gl = this.gl;
+        const viewportMax = gl.getParameter(gl.MAX_VIEWPORT_DIMS);
+        const maxSize = Math.min(
+            gl.getParameter(gl.MAX_TEXTURE_SIZE) || 4096,
+            viewportMax?.[0] || 4096,
+            viewportMax?.[1] || 4096
+        );
+
+        // The frame corner sets the angular resolution: one strip row per output pixel along the outer ring
+        const cornerPx = 0.5 * Math.hypot(width, height);
+        /** @type {number} Strip rows per full turn */
+        this.angles = Math.min(nextPowerOfTwo(TAU * cornerPx * supersample), 2 ** Math.floor(Math.log2(maxSize)));
+        /** @type {number} Columns per segment texture */
+        this.segmentWidth = Math.min(SEGMENT_WIDTH, this.angles);
+        this.dLnR = TAU / this.angles;
+        this.colsPerLn = this.angles / TAU;
+
+        // Radii in view units (height = 1): frame corner and the directly rendered centre disc
+        this.cornerSt = 0.5 * Math.hypot(width / height, 1);
+        this.centreSt = this.cornerSt / Math.exp(CENTRE_LOG_WINDOW);
+
+        this.lnRMax = Math.log(startZoom * this.cornerSt) + this.dLnR;
+        const lnRMin = Math.log(this.targetZoom * this.centreSt) - this.dLnR;
+        this.columns = Math.ceil((this.lnRMax - lnRMin) / this.dLnR) + 1;
+        // Neighbouring segments share one column so linear filtering never crosses a texture edge
+        this.segmentCount = Math.ceil(this.columns / (this.segmentWidth - 1));
+
+        /** @type {Map<number, {texture: WebGLTexture, framebuffer: WebGLFramebuffer}>} Live segments by index */
+        this.segments = new Map();
+        this.segmentsRendered = 0;
+        this.stripProgram = null;
+        this.warpProgram = null;
+        this.shader = null;
+        this.frame = null;
+    }
+
+    // region > SETUP --------------------------------------------------------------------------------------------------
+
+    /**
+     * @param {string} fragmentSource
+     * @param {string[]} uniformNames
+     * @returns {{program: WebGLProgram, positionLoc: number, uniforms: Object<string, WebGLUniformLocation>}}
+     */
+    createProgram(fragmentSource, uniformNames) {
+        const gl = this.gl;
+        const fragmentShader = this.app.compileShader(fragmentSource, gl.FRAGMENT_SHADER);
+        if (!fragmentShader) throw new Error('Exp-map shader failed to compile.');
+
+        const program = gl.createProgram();
+        gl.attachShader(program, this.app.vertexShader);
+        gl.attachShader(program, fragmentShader);
+        gl.linkProgram(program);
+        gl.deleteShader(fragmentShader);
+        if (!gl.getProgramParameter(program, gl.LINK_STATUS)) {
+            const info = gl.getProgramInfoLog(program);
+            gl.deleteProgram(program);
+            throw new Error(`Exp-map shader failed to link: ${info}`);
+        }
+
+        const uniforms = {};
+        for (const name of uniformNames) uniforms[name] = gl.getUniformLocation(program, name);
+        return {program, positionLoc: gl.getAttribLocation(program, 'a_position'), uniforms};
+    }
+
+    /**
+     * Activates a program on the renderer's full-screen quad.
+     * @param {{program: WebGLProgram, positionLoc: number}} p
+     */
+    useProgram(p) {
+        const gl = this.gl;
+        gl.useProgram(p.program);
+        gl.bindBuffer(gl.ARRAY_BUFFER, this.app.positionBuffer);
+        gl.enableVertexAttribArray(p.positionLoc);
+        gl.vertexAttribPointer(p.positionLoc, 2, gl.FLOAT, false, 0, 0);
+    }
+
+    /**
+     * Compiles the programs and builds the reference orbit at the target view.
+     */
+    async prepare() {
+        if (!(this.targetZoom < this.startZoom)) {
+            throw new Error(`Zoom in beyond ${this.startZoom} first; the video ends at the current view.`);
+        }
+
+        // Series approximation skips iterations tuned for the target zoom only; shallower frames need plain perturbation
+        if (this.app.currentShader && this.app.currentShader !== 'perturbation') {
+            this.shader = this.app.currentShader;
+            this.app.switchShader('perturbation');
+        }
+
+        this.stripProgram = this.createProgram(
+            stripShaderRaw.replace('__MAX_ITER__', this.app.MAX_ITER).toString(),
+            ['u_colStart', 'u_lnRMax', 'u_dLnR', 'u_angles', 'u_iterBase', 'u_iterSlope', 'u_delta_pan_h',
+                'u_delta_pan_l', 'u_delta_exp', 'u_colorPalette', 'u_frequency', 'u_phase', 'u_orbitTex', 'u_orbitW']);
+        this.warpProgram = this.createProgram(warpShaderSource,
+            ['u_resolution', 'u_fragOffset', 'u_rotation', 'u_colBase', 'u_colsPerLn', 'u_colMax', 'u_segStart',
+                'u_segWidth', 'u_strip']);
+        this.app.bindFullscreenQuad();
+
+        // One reference orbit near the target serves every depth of the zoom
+        this.app.markOrbitDirty();
+        this.app.draw();
+
+        log(`Strip ${this.columns} × ${this.angles} in ${this.segmentCount} segments.`, 'ExpMapZoom');
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+    // region > STRIP --------------------------------------------------------------------------------------------------
+
+    /**
+     * Renders one strip segment into its own texture, block by block.
+     * @param {number} index
+     * @param {AbortSignal} [signal]
+     */
+    async renderSegment(index, signal) {
+        const gl = this.gl;
+        const app = this.app;
+        const width = this.segmentWidth;
+        const height = this.angles;
+
+        const texture = gl.createTexture();
+        gl.activeTexture(gl.TEXTURE0 + STRIP_TEXTURE_UNIT);
+        gl.bindTexture(gl.TEXTURE_2D, texture);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, width, height, 0, gl.RGBA, gl.UNSIGNED_BYTE, null);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.REPEAT);
+        const framebuffer = gl.createFramebuffer();
+        gl.bindFramebuffer(gl.FRAMEBUFFER, framebuffer);
+        gl.framebufferTexture2D(gl.FRAMEBUFFER, gl.COLOR_ATTACHMENT0, gl.TEXTURE_2D, texture, 0);
+        const segment = {texture, framebuffer};
+        this.segments.set(index, segment);
+
+        // Iterations follow MandelbrotRenderer.draw() at the zoom where this radius meets the centre disc
+        const iterBase = 200 + ITERATIONS_PER_OCTAVE * Math.log2(app.DEFAULT_ZOOM * this.centreSt) + app.extraIterations;
+        const deltaPan = new Float64Array(4);
+        qdSubDDInto(app.panQD.x, app.refPanDD.x, deltaPan, 0);
+        qdSubDDInto(app.panQD.y, app.refPanDD.y, deltaPan, 2);
+        // Uploaded in the target zoom's scale; the shader takes it to each column's own exponent
+        const deltaExp = splitZoomInto(this.targetZoom, new Float64Array(3));
+        splitScaledDDInto(deltaPan[0], deltaPan[1], -deltaExp, deltaPan, 0);
+        splitScaledDDInto(deltaPan[2], deltaPan[3], -deltaExp, deltaPan, 2);
+        const u = this.stripProgram.uniforms;
+
+        const bind = () => {
+            this.useProgram(this.stripProgram);
+            gl.bindFramebuffer(gl.FRAMEBUFFER, framebuffer);
+            gl.activeTexture(gl.TEXTURE0);
+            gl.bindTexture(gl.TEXTURE_2D, app.orbitTex);
+            gl.uniform1i(u.u_orbitTex, 0);
+            gl.uniform1f(u.u_orbitW, app.MAX_ITER);
+            gl.uniform1f(u.u_colStart, index * (width - 1));
+            gl.uniform1f(u.u_lnRMax, this.lnRMax);
+            gl.uniform1f(u.u_dLnR, this.dLnR);
+            gl.uniform1f(u.u_angles, height);
+            gl.uniform1f(u.u_iterBase, iterBase);
+            gl.uniform1f(u.u_iterSlope, ITERATIONS_PER_OCTAVE / Math.LN2);
+            gl.uniform2f(u.u_delta_pan_h, deltaPan[0], deltaPan[2]);
+            gl.uniform2f(u.u_delta_pan_l, deltaPan[1], deltaPan[3]);
+            gl.uniform1f(u.u_delta_exp, deltaExp);
+            gl.uniform3fv(u.u_colorPalette, app.colorPalette);
+            gl.uniform3fv(u.u_frequency, app.frequency);
+            gl.uniform3fv(u.u_phase, app.phase);
+        };
+
+        try {
+            for (let y = 0; y < height; y += BLOCK_SIZE) {
+                for (let x = 0; x < width; x += BLOCK_SIZE) {
+                    if (signal?.aborted) throw new DOMException('Video export cancelled.', 'AbortError');
+
+                    // GL state may have been touched while yielding
+                    bind();
+                    gl.viewport(x, y, Math.min(BLOCK_SIZE, width - x), Math.min(BLOCK_SIZE, height - y));
+                    gl.drawArrays(gl.TRIANGLE_STRIP, 0, 4);
+                    gl.flush();
+                    await yieldToEventLoop();
+                }
+            }
+            this.segmentsRendered++;
+        } catch (e) {
+            this.releaseSegment(index);
+            throw e;
+        } finally {
+            gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+            app.bindFullscreenQuad();
+        }
+    }
+
+    /** @param {number} index */
+    releaseSegment(index) {
+        const segment = this.segments.get(index);
+        if (!segment) return;
+        this.gl.deleteFramebuffer(segment.framebuffer);
+        this.gl.deleteTexture(segment.texture);
+        this.segments.delete(index);
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+    // region > FRAMES -------------------------------------------------------------------------------------------------
+
+    /**
+     * Moves to a frame: sets the renderer zoom (for the centre pass), renders the strip segments the frame needs
+     * and releases those it has zoomed past.
+     * @param {number} index 0 .. frames - 1
+     * @param {AbortSignal} [signal]
+     */
+    async setFrame(index, signal) {
+        const t = this.frames > 1 ? index / (this.frames - 1) : 1;
+        const lnZoom = Math.log(this.startZoom) + (Math.log(this.targetZoom) - Math.log(this.startZoom)) * t;
+
+        const colBase = (this.lnRMax - lnZoom) * this.colsPerLn;
+        const colOuter = colBase - Math.log(this.cornerSt) * this.colsPerLn;
+        const colCentre = colBase - Math.log(this.centreSt) * this.colsPerLn;
+        const step = this.segmentWidth - 1;
+        const first = Math.max(0, Math.floor((colOuter - 0.5) / step));
+        const last = Math.min(this.segmentCount - 1, Math.floor((colCentre - 0.5) / step));
+
+        for (const k of [...this.segments.keys()]) {
+            if (k < first) this.releaseSegment(k);
+        }
+        for (let k = first; k <= last; k++) {
+            if (!this.segments.has(k)) await this.renderSegment(k, signal);
+        }
+
+        this.app.zoom = Math.exp(lnZoom);
+        this.frame = {colBase, colMax: colCentre, first, last};
+    }
+
+    /**
+     * Composes a tile of the current frame: one warp pass per visible segment, then the centre disc rendered
+     * directly by the Mandelbrot renderer. Same signature as FractalRenderer.drawTile().
+     */
+    drawTile(offsetX, offsetY, width, height, fullWidth, fullHeight) {
+        const gl = this.gl;
+        const {colBase, colMax, first, last} = this.frame;
+        const u = this.warpProgram.uniforms;
+
+        gl.viewport(0, 0, width, height);
+        gl.clearColor(0, 0, 0, 1);
+        gl.clear(gl.COLOR_BUFFER_BIT);
+
+        this.useProgram(this.warpProgram);
+        gl.uniform2f(u.u_resolution, fullWidth, fullHeight);
+        gl.uniform2f(u.u_fragOffset, offsetX, offsetY);
+        gl.uniform1f(u.u_rotation, this.app.rotation);
+        gl.uniform1f(u.u_colBase, colBase);
+        gl.uniform1f(u.u_colsPerLn, this.colsPerLn);
+        gl.uniform1f(u.u_colMax, colMax);
+        gl.uniform1f(u.u_segWidth, this.segmentWidth);
+        gl.uniform1i(u.u_strip, STRIP_TEXTURE_UNIT);
+        gl.activeTexture(gl.TEXTURE0 + STRIP_TEXTURE_UNIT);
+        for (let k = first; k <= last; k++) {
+            gl.bindTexture(gl.TEXTURE_2D, this.segments.get(k).texture);
+            gl.uniform1f(u.u_segStart, k * (this.segmentWidth - 1));
+            gl.drawArrays(gl.TRIANGLE_STRIP, 0, 4);
+        }
+        gl.activeTexture(gl.TEXTURE0);
+        this.app.bindFullscreenQuad();
+
+        // Centre correction: scissor the direct render to the disc's bounding box within this tile
+        const radius = this.centreSt * fullHeight + 2;
+        const x0 = Math.max(0, Math.floor(fullWidth / 2 - radius - offsetX));
+        const y0 = Math.max(0, Math.floor(fullHeight / 2 - radius - offsetY));
+        const x1 = Math.min(width, Math.ceil(fullWidth / 2 + radius - offsetX));
+        const y1 = Math.min(height, Math.ceil(fullHeight / 2 + radius - offsetY));
+        if (x1 > x0 && y1 > y0) {
+            gl.enable(gl.SCISSOR_TEST);
+            gl.scissor(x0, y0, x1 - x0, y1 - y0);
+            this.app.drawTile(offsetX, offsetY, width, height, fullWidth, fullHeight);
+            gl.disable(gl.SCISSOR_TEST);
+        }
+    }
+
+    /** Releases the strip and programs and restores the target view. */
+    dispose() {
+        for (const k of [...this.segments.keys()]) this.releaseSegment(k);
+        if (this.stripProgram) this.gl.deleteProgram(this.stripProgram.program);
+        if (this.warpProgram) this.gl.deleteProgram(this.warpProgram.program);
+        this.stripProgram = this.warpProgram = null;
+
+        this.app.zoom = this.targetZoom;
+        if (this.shader) this.app.switchShader(this.shader);
+        this.app.bindFullscreenQuad();
+
+        log(`${this.segmentsRendered} strip segments rendered (${this.segmentsRendered * this.segmentWidth * this.angles} samples).`, 'ExpMapZoom');
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+}
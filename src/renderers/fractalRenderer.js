@@ -1,12 +1,13 @@
 import {debugPanel, updateInfo} from "../ui/ui";
+import {profiler} from "../global/profiler";
+import {recordFrame} from "../global/telemetry";
 import {
     compareComplex,
     comparePalettes,
-    ddAdd,
     ddMake,
-    ddSet,
-    ddValue,
     hslToRgb,
+    interpolateZoom,
+    isSameZoom,
     lerp,
     normalizeRotation,
     rgbToHsl
@@ -23,9 +24,24 @@ import {
     FF_ADAPTIVE_QUALITY,
     FF_DEMO_ALWAYS_RESETS,
     log,
+    LOG_LEVEL,
     PI
 } from "../global/constants";
 import Renderer from "./renderer";
+import {
+    coordinateToNumber,
+    formatCoordinate,
+    qdAdd,
+    qdAddScaled,
+    qdCopy,
+    qdFrom,
+    qdMake,
+    qdSet,
+    qdSubDDInto,
+    qdSubInto,
+    qdToDD,
+    qdValue
+} from "../global/quadDouble";
 
 /**
  * FractalRenderer
@@ -69,12 +85,28 @@ class FractalRenderer extends Renderer {
         /** @type {COMPLEX} */
         this.pan = [...this.DEFAULT_PAN];
 
-        /** DD accumulator mirrors into this.pan */
+        /** Canonical pan (quad-double); panDD and pan mirror it */
+        this.panQD = {
+            x: qdMake(this.pan[0]),
+            y: qdMake(this.pan[1]),
+        };
+
+        /** Leading double-double of panQD (perturbation references and UI read this) */
         this.panDD = {
             x: ddMake(this.pan[0], 0),
             y: ddMake(this.pan[1], 0),
         };
 
+        /** Anchor scratch for screenToFractal() during resizes */
+        this.anchorQD = {x: qdMake(), y: qdMake()};
+
+        /**
+         * Per-frame DD scratch (delta x hi/lo, delta y hi/lo, zoom mantissa hi/lo, zoom exponent), reused so uniform
+         * uploads allocate nothing
+         * @type {Float64Array}
+         */
+        this.ddScratch = new Float64Array(7);
+
         /**
          * Rotation in rad
          * @type {number}
@@ -125,6 +157,8 @@ class FractalRenderer extends Renderer {
             color0: NaN,
             color1: NaN,
             color2: NaN,
+            fragX: NaN,
+            fragY: NaN,
         };
 
         // Common uniform locations (cached in onProgramCreated)
@@ -134,6 +168,29 @@ class FractalRenderer extends Renderer {
         this.colorLoc = null;
         this.rotationLoc = null;
         this.resolutionLoc = null;
+        this.fragOffsetLoc = null;
+
+        /**
+         * Tile cache composing the view from cached kernel output; set by renderers whose pixels depend only on the
+         * fractal coordinate (see tileCacheKey)
+         * @type {TileCache|null}
+         */
+        this.tileCache = null;
+
+        /**
+         * CPU kernel of the mode (CPU_KERNEL), null for modes without a CPU fallback
+         * @type {string|null}
+         */
+        this.cpuKernel = null;
+
+        /**
+         * True once the mode renders on the CPU (see enableCpuBackend); the backend itself loads asynchronously
+         * @type {boolean}
+         */
+        this.cpuFallback = false;
+
+        /** @type {CpuBackend|null} */
+        this.cpuBackend = null;
     }
 
     /**
@@ -142,6 +199,27 @@ class FractalRenderer extends Renderer {
      */
     markOrbitDirty() {}
 
+    /**
+     * Hook for demos and tours: precomputes what the next destination will need (reference orbit etc.) while the
+     * current one is held, so the arrival frame does not pay for it. Demo loops therefore pick their destination one
+     * hold ahead and pass it here during the hold. Resolves immediately by default.
+     * @param {PRESET} view Destination (pan, zoom, ...)
+     * @return {Promise<void>}
+     */
+    prefetchView(view) {
+        return Promise.resolve();
+    }
+
+    /**
+     * Identifies everything besides the fractal coordinate the kernel output depends on (shader, iterations, colors,
+     * ...). Tiles rendered under the same key are interchangeable. null means the view cannot be served from the
+     * tile cache.
+     * @return {string|null}
+     */
+    tileCacheKey() {
+        return null;
+    }
+
     /**
      * Invalidates the uniform cache, forcing all uniforms to be re-uploaded on next draw().
      * Called after GL program creation/recreation.
@@ -157,27 +235,50 @@ class FractalRenderer extends Renderer {
         this._uniformCache.color0 = NaN;
         this._uniformCache.color1 = NaN;
         this._uniformCache.color2 = NaN;
+        this._uniformCache.fragX = NaN;
+        this._uniformCache.fragY = NaN;
     }
 
-    // --------- Pan API (use these; they keep DD + array in sync) ---------
+    // --------- Pan API (use these; they keep QD, DD and array in sync) ---------
 
     /** @returns {number[]} the canonical array */
     getPan() {
         return [this.pan[0], this.pan[1]];
     }
 
+    /**
+     * Pan as serialisable coordinates: numbers for shallow views, decimal strings once a double no longer resolves
+     * the view (URLs, presets).
+     * @returns {COORDINATE[]}
+     */
+    getPanCoordinates() {
+        return [formatCoordinate(this.panQD.x, this.zoom), formatCoordinate(this.panQD.y, this.zoom)];
+    }
+
+    /** Mirrors panQD into panDD and pan */
+    syncPan() {
+        qdToDD(this.panQD.x, this.panDD.x);
+        qdToDD(this.panQD.y, this.panDD.y);
+        this.pan[0] = qdValue(this.panQD.x);
+        this.pan[1] = qdValue(this.panQD.y);
+    }
+
     /**
      * Sets the pan values for the object.
      *
-     * @param {number} x - The horizontal pan value.
-     * @param {number} y - The vertical pan value.
+     * @param {COORDINATE|Float64Array} x - The horizontal pan value (number, decimal string or quad-double).
+     * @param {COORDINATE|Float64Array} y - The vertical pan value (number, decimal string or quad-double).
      * @return {void}
      */
     setPan(x, y) {
-        ddSet(this.panDD.x, x);
-        ddSet(this.panDD.y, y);
-        this.pan[0] = ddValue(this.panDD.x);
-        this.pan[1] = ddValue(this.panDD.y);
+        if (typeof x === 'number' && typeof y === 'number') {
+            qdSet(this.panQD.x, x);
+            qdSet(this.panQD.y, y);
+        } else {
+            qdFrom(this.panQD.x, x);
+            qdFrom(this.panQD.y, y);
+        }
+        this.syncPan();
     }
 
     /**
@@ -188,20 +289,51 @@ class FractalRenderer extends Renderer {
      * @return {void}
      */
     addPan(dx, dy) {
-        ddAdd(this.panDD.x, dx);
-        ddAdd(this.panDD.y, dy);
-        this.pan[0] = ddValue(this.panDD.x);
-        this.pan[1] = ddValue(this.panDD.y);
+        qdAdd(this.panQD.x, dx);
+        qdAdd(this.panQD.y, dy);
+        this.syncPan();
+    }
+
+    /**
+     * Quad-double endpoints of a pan animation from the current pan to the target.
+     * @param {COORDINATE[]} targetPan
+     * @returns {{start: Object, target: Object, delta: Object}} Each an {x, y} pair of quad-doubles
+     */
+    panPath(targetPan) {
+        const start = {x: qdCopy(qdMake(), this.panQD.x), y: qdCopy(qdMake(), this.panQD.y)};
+        const target = {x: qdFrom(qdMake(), targetPan[0]), y: qdFrom(qdMake(), targetPan[1])};
+        const delta = {x: qdSubInto(target.x, start.x, qdMake()), y: qdSubInto(target.y, start.y, qdMake())};
+        return {start, target, delta};
+    }
+
+    /**
+     * Sets the pan at progress k of a panPath(); k = 1 lands exactly on the target.
+     * @param {{start: Object, target: Object, delta: Object}} path
+     * @param {number} k
+     */
+    setPanAlong(path, k) {
+        if (k === 1) {
+            qdCopy(this.panQD.x, path.target.x);
+            qdCopy(this.panQD.y, path.target.y);
+        } else {
+            qdAddScaled(qdCopy(this.panQD.x, path.start.x), path.delta.x, k);
+            qdAddScaled(qdCopy(this.panQD.y, path.start.y), path.delta.y, k);
+        }
+        this.syncPan();
     }
 
     /**
      * Set pan so that fractal point (fxAnchor,fyAnchor) remains under a screen point
-     * whose view vector is (vx,vy).
+     * whose view vector is (vx,vy). Anchors may be numbers or quad-doubles (see screenToFractal).
      */
     setPanFromAnchor(fxAnchor, fyAnchor, vx, vy) {
-        const px = fxAnchor - vx * this.zoom;
-        const py = fyAnchor - vy * this.zoom;
-        this.setPan(px, py);
+        if (typeof fxAnchor === 'number') {
+            this.setPan(fxAnchor - vx * this.zoom, fyAnchor - vy * this.zoom);
+            return;
+        }
+        qdAdd(qdCopy(this.panQD.x, fxAnchor), -vx * this.zoom);
+        qdAdd(qdCopy(this.panQD.y, fyAnchor), -vy * this.zoom);
+        this.syncPan();
     }
 
     /**
@@ -278,6 +410,12 @@ class FractalRenderer extends Renderer {
             this.interactionTimer = null;
         }
 
+        this.cpuBackend?.destroy();
+        this.cpuBackend = null;
+
+        this.tileCache?.destroy();
+        this.tileCache = null;
+
         // Parent handles shader/program cleanup
         super.destroy();
 
@@ -294,31 +432,88 @@ class FractalRenderer extends Renderer {
 
     init() {
         this.generatePresetIDs();
+        if (!this.gl) {
+            this.enableCpuBackend('WebGL is not available');
+            return;
+        }
+        this.tileCache?.resetContext();
         super.initGLProgram();
         this.draw();
     }
 
+    /**
+     * Switches the mode to the CPU backend (see cpuBackend.js) when its GPU path cannot run. The backend is loaded as
+     * a separate chunk, so draws before it arrives are skipped. Modes without a CPU kernel only log the reason.
+     * @param {string} reason
+     * @returns {boolean} True if the mode renders on the CPU from now on
+     */
+    enableCpuBackend(reason) {
+        if (!this.cpuKernel) {
+            log(`${reason}, this mode has no CPU fallback.`, this.constructor.name, LOG_LEVEL.ERROR);
+            return false;
+        }
+        if (this.cpuFallback) return true;
+
+        log(`${reason}, rendering on the CPU.`, this.constructor.name, LOG_LEVEL.WARN);
+        this.cpuFallback = true;
+        import(/* webpackChunkName: "cpu-backend" */ './cpuBackend').then(({CpuBackend}) => {
+            if (!this.canvas) return;
+            this.cpuBackend = new CpuBackend(this);
+            this.draw();
+        }).catch((e) => log(`CPU backend failed to load: ${e}`, this.constructor.name, LOG_LEVEL.ERROR));
+        return true;
+    }
+
+    /**
+     * The current view as a CPU backend frame (see CpuFrame in cpuKernel.js). The reference is the view centre
+     * rounded to a double; the remainder of the quad-double pan goes to the delta. Subclasses add their colouring.
+     * @returns {CpuFrame}
+     */
+    getCpuFrame() {
+        const refX = qdValue(this.panQD.x);
+        const refY = qdValue(this.panQD.y);
+        const d = this.ddScratch;
+        qdSubDDInto(this.panQD.x, {hi: refX, lo: 0}, d, 0);
+        qdSubDDInto(this.panQD.y, {hi: refY, lo: 0}, d, 2);
+
+        return {
+            kernel: this.cpuKernel,
+            width: this.canvas.width,
+            height: this.canvas.height,
+            refX,
+            refY,
+            deltaX: d[0] + d[1],
+            deltaY: d[2] + d[3],
+            zoom: this.zoom,
+            rotation: this.rotation,
+            iterations: this.iterations,
+        };
+    }
+
     resizeCanvas() {
         log(`resizeCanvas`, this.constructor.name);
 
-        this.gl.useProgram(this.program);
+        if (this.gl) this.gl.useProgram(this.program);
 
         // Keep the center fixed
         const oldRect = this.canvas.getBoundingClientRect();
         const cx = oldRect.width / 2;
         const cy = oldRect.height / 2;
 
-        const [centerFx, centerFy] = this.screenToFractal(cx, cy);
+        const anchor = this.anchorQD;
+        this.screenToFractal(cx, cy, anchor);
 
         const dpr = window.devicePixelRatio || 1;
         this.canvas.width = Math.floor(oldRect.width * dpr);
         this.canvas.height = Math.floor(oldRect.height * dpr);
 
-        this.gl.viewport(0, 0, this.canvas.width, this.canvas.height);
-        if (this.resolutionLoc) this.gl.uniform2f(this.resolutionLoc, this.canvas.width, this.canvas.height);
+        if (this.gl) {
+            this.gl.viewport(0, 0, this.canvas.width, this.canvas.height);
+            if (this.resolutionLoc) this.gl.uniform2f(this.resolutionLoc, this.canvas.width, this.canvas.height);
+        }
 
         const [vx, vy] = this.screenToViewVector(cx, cy);
-        this.setPanFromAnchor(centerFx, centerFy, vx, vy);
+        this.setPanFromAnchor(anchor.x, anchor.y, vx, vy);
 
         // After resizing, request a clean rebuild for perturbation renderers (safe no-op otherwise)
         this.markOrbitDirty();
@@ -348,6 +543,7 @@ class FractalRenderer extends Renderer {
         this.colorLoc = this.gl.getUniformLocation(this.program, "u_colorPalette");
         this.rotationLoc = this.gl.getUniformLocation(this.program, "u_rotation");
         this.resolutionLoc = this.gl.getUniformLocation(this.program, "u_resolution");
+        this.fragOffsetLoc = this.gl.getUniformLocation(this.program, "u_fragOffset");
 
         this.invalidateUniformCache();
     }
@@ -357,8 +553,11 @@ class FractalRenderer extends Renderer {
      * Called by draw() before the base draw operation.
      */
     uploadCommonUniforms() {
-        const w = this.canvas.width;
-        const h = this.canvas.height;
+        // Poster tiles see the full poster as their resolution and shift fragments by the tile origin
+        const w = this.tile ? this.tile.fullWidth : this.canvas.width;
+        const h = this.tile ? this.tile.fullHeight : this.canvas.height;
+        const fx = this.tile ? this.tile.offsetX : 0;
+        const fy = this.tile ? this.tile.offsetY : 0;
         const uc = this._uniformCache;
 
         // Only upload uniforms that have changed
@@ -368,6 +567,12 @@ class FractalRenderer extends Renderer {
             uc.resH = h;
         }
 
+        if (this.fragOffsetLoc && (uc.fragX !== fx || uc.fragY !== fy)) {
+            this.gl.uniform2f(this.fragOffsetLoc, fx, fy);
+            uc.fragX = fx;
+            uc.fragY = fy;
+        }
+
         if (this.panLoc && (uc.pan0 !== this.pan[0] || uc.pan1 !== this.pan[1])) {
             this.gl.uniform2fv(this.panLoc, this.pan);
             uc.pan0 = this.pan[0];
@@ -405,18 +610,63 @@ class FractalRenderer extends Renderer {
      * Uses dirty checking to avoid redundant uniform uploads.
      */
     draw() {
+        if (this.cpuFallback) {
+            this.cpuBackend?.render(this.getCpuFrame());
+            if (this.onDrawCallback) this.onDrawCallback();
+            return;
+        }
+
         this.gl.useProgram(this.program);
 
+        profiler.begin('uniforms');
         this.uploadCommonUniforms();
+        profiler.end();
 
+        if (this.tile) {
+            // Offscreen poster tile: no timing, telemetry, adaptive quality or overlays
+            super.baseDraw();
+            return;
+        }
+
+        profiler.begin('draw');
         debugPanel?.beginGpuTimer();
-        super.baseDraw();
+        if (!this.tileCache?.compose()) {
+            // Tiles rendered while trying the cache leave their own view in the uniforms
+            if (this.tileCache) this.uploadCommonUniforms();
+            super.baseDraw();
+        }
         debugPanel?.endGpuTimer();
+        profiler.end();
 
+        recordFrame(this, debugPanel?.perf?.gpuMsSmoothed ?? NaN);
         this.adjustAdaptiveQuality();
 
         // Invoke draw callback if set (used for axes overlay sync)
-        if (this.onDrawCallback) this.onDrawCallback();
+        if (this.onDrawCallback) {
+            profiler.begin('overlay');
+            this.onDrawCallback();
+            profiler.end();
+        }
+    }
+
+    /**
+     * Renders a sub-rectangle of a virtual fullWidth x fullHeight frame of the current view into the currently bound
+     * framebuffer. Offsets are in GL pixel coordinates (origin bottom-left) and may be fractional for sub-pixel
+     * jitter. View state is untouched, so perturbation renderers reuse one reference orbit for all tiles.
+     * @param {number} offsetX
+     * @param {number} offsetY
+     * @param {number} width Tile width in pixels
+     * @param {number} height Tile height in pixels
+     * @param {number} fullWidth
+     * @param {number} fullHeight
+     */
+    drawTile(offsetX, offsetY, width, height, fullWidth, fullHeight) {
+        this.tile = {offsetX, offsetY, width, height, fullWidth, fullHeight};
+        try {
+            this.draw();
+        } finally {
+            this.tile = null;
+        }
     }
 
     /**
@@ -529,9 +779,10 @@ class FractalRenderer extends Renderer {
      * Screen point -> fractal coordinates (float64 JS side; fine for UI)
      * @param {number} screenX
      * @param {number} screenY
+     * @param {{x: Float64Array, y: Float64Array}|null} [out] Receives the point at full (quad-double) precision
      * @returns {COMPLEX}
      */
-    screenToFractal(screenX, screenY) {
+    screenToFractal(screenX, screenY, out = null) {
         const dpr = window.devicePixelRatio || 1;
         const rect = this.canvas.getBoundingClientRect();
         const w = rect.width * dpr;
@@ -554,6 +805,11 @@ class FractalRenderer extends Renderer {
         const rotatedX = cosR * stX - sinR * stY;
         const rotatedY = sinR * stX + cosR * stY;
 
+        if (out) {
+            qdAdd(qdCopy(out.x, this.panQD.x), rotatedX * this.zoom);
+            qdAdd(qdCopy(out.y, this.panQD.y), rotatedY * this.zoom);
+        }
+
         return [rotatedX * this.zoom + this.pan[0], rotatedY * this.zoom + this.pan[1]];
     }
 
@@ -889,9 +1145,10 @@ class FractalRenderer extends Renderer {
     }
 
     /**
-     * Animates pan from current position to the new one
+     * Animates pan from current position to the new one. Interpolates in quad-double, so deep targets given as decimal
+     * strings are reached exactly.
      *
-     * @param {COMPLEX} targetPan
+     * @param {COORDINATE[]} targetPan
      * @param [duration] in ms
      * @param {EASE_TYPE|Function} easeFunction
      * @return {Promise<void>}
@@ -902,15 +1159,16 @@ class FractalRenderer extends Renderer {
 
         this.markOrbitDirty();
 
-        if (compareComplex(this.pan, targetPan, 6)) {
+        const path = this.panPath(targetPan);
+
+        if (compareComplex(this.pan, targetPan.map(coordinateToNumber), 6)
+            && Math.hypot(path.delta.x[0], path.delta.y[0]) <= this.zoom * 1e-6) {
             console.log(`Already at the target pan. Skipping.`);
             console.groupEnd();
             return;
         }
         console.log(`Panning to ${targetPan}.`);
 
-        const startPan = [...this.pan];
-
         await new Promise((resolve) => {
             let startTime = null;
 
@@ -920,9 +1178,7 @@ class FractalRenderer extends Renderer {
 
                 const k = easeFunction(t);
 
-                const nx = lerp(startPan[0], targetPan[0], k);
-                const ny = lerp(startPan[1], targetPan[1], k);
-                this.setPan(nx, ny);
+                this.setPanAlong(path, t < 1 ? k : 1);
 
                 this.draw();
                 updateInfo(true);
@@ -1016,7 +1272,7 @@ class FractalRenderer extends Renderer {
         console.groupCollapsed(`%c ${this.constructor.name}: animateZoomTo`, CONSOLE_GROUP_STYLE);
         this.stopCurrentZoomAnimation();
 
-        if (this.zoom.toFixed(20) === targetZoom.toFixed(20)) {
+        if (isSameZoom(this.zoom, targetZoom)) {
             console.log(`Already at the target zoom. Skipping.`);
             console.groupEnd();
             return;
@@ -1030,12 +1286,12 @@ class FractalRenderer extends Renderer {
         }
 
         const startZoom = this.zoom;
-        const ratio = targetZoom / startZoom;
 
         // Compute anchor once. During zoom animation, rotation is constant, so view-vector stays valid.
         const [vx, vy] = this.screenToViewVector(anchorX, anchorY);
-        const fxAnchor = vx * startZoom + this.pan[0];
-        const fyAnchor = vy * startZoom + this.pan[1];
+        const anchor = {x: qdMake(), y: qdMake()};
+        qdAdd(qdCopy(anchor.x, this.panQD.x), vx * startZoom);
+        qdAdd(qdCopy(anchor.y, this.panQD.y), vy * startZoom);
 
         // orbit boundary policy hook (safe no-op for non-perturbation renderers)
         this.markOrbitDirty();
@@ -1052,11 +1308,11 @@ class FractalRenderer extends Renderer {
                     const k = easeFunction(t);
                     this.zoom = startZoom + (targetZoom - startZoom) * k;
                 } else {
-                    this.zoom = startZoom * Math.pow(ratio, t);
+                    this.zoom = interpolateZoom(startZoom, targetZoom, t);
                 }
 
                 // Recompute pan from the fixed anchor point (stable in deep zoom)
-                this.setPanFromAnchor(fxAnchor, fyAnchor, vx, vy);
+                this.setPanFromAnchor(anchor.x, anchor.y, vx, vy);
 
                 this.markOrbitDirty();
                 this.draw();
@@ -1095,7 +1351,7 @@ class FractalRenderer extends Renderer {
 
         this.markOrbitDirty();
 
-        if (this.zoom.toFixed(20) === targetZoom.toFixed(20)) {
+        if (isSameZoom(this.zoom, targetZoom)) {
             console.log(`Already at the target zoom. Skipping.`);
             console.groupEnd();
             return;
@@ -1114,7 +1370,7 @@ class FractalRenderer extends Renderer {
                     const k = easeFunction(t);
                     this.zoom = startZoom + (targetZoom - startZoom) * k;
                 } else {
-                    this.zoom = startZoom * Math.pow(targetZoom / startZoom, t);
+                    this.zoom = interpolateZoom(startZoom, targetZoom, t);
                 }
 
                 this.draw();
@@ -0,0 +1,208 @@
+/**
+ * @module GLCallCounter
+ * @author Radim Brnka
+ * @description Debug-only WebGL context wrapper. Counts every context call by name and flags state changes that
+ * had no effect: uniform uploads of the value the location already holds, useProgram/bindBuffer/bindTexture/
+ * activeTexture with the already-bound object, and full texImage2D re-uploads into an already allocated texture of
+ * the same size (texSubImage2D would do). Counters roll over per frame (see GLCallStats.endFrame()).
+ * Installed by Renderer only when DEBUG_MODE is FULL; production builds never reference the proxy.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+/** Uniform setters whose argument list (after the location) fully describes the new value */
+const UNIFORM_SETTERS = new Set([
+    'uniform1f', 'uniform2f', 'uniform3f', 'uniform4f',
+    'uniform1i', 'uniform2i', 'uniform3i', 'uniform4i',
+    'uniform1fv', 'uniform2fv', 'uniform3fv', 'uniform4fv',
+    'uniform1iv', 'uniform2iv', 'uniform3iv', 'uniform4iv',
+    'uniformMatrix2fv', 'uniformMatrix3fv', 'uniformMatrix4fv',
+]);
+
+/** Per-frame counters */
+function createFrameCounters() {
+    return {
+        total: 0,
+        /** @type {Object<string, number>} */
+        calls: {},
+        redundantUniforms: 0,
+        redundantBinds: 0,
+        textureReuploads: 0,
+        /** @type {Object<string, number>} Redundant uniform uploads by uniform name (when known) */
+        redundantByUniform: {},
+    };
+}
+
+/**
+ * Snapshots uniform arguments into a comparable key (arrays are copied by value, typed arrays get mutated in place).
+ * @param {IArguments|Array} args
+ * @returns {string}
+ */
+function uniformKey(args) {
+    let key = '';
+    for (let i = 1; i < args.length; i++) {
+        const a = args[i];
+        key += (a && typeof a === 'object' && 'length' in a) ? Array.prototype.join.call(a, ',') : String(a);
+        key += '|';
+    }
+    return key;
+}
+
+export class GLCallStats {
+    constructor(target) {
+        /** Unwrapped context (use for the debug tooling's own queries so they are not counted) */
+        this.target = target;
+        this.current = createFrameCounters();
+        /** Counters of the last completed frame */
+        this.lastFrame = createFrameCounters();
+        this.frames = 0;
+
+        /** @type {WeakMap<WebGLUniformLocation, string>} */
+        this.uniformValues = new WeakMap();
+        /** @type {WeakMap<WebGLUniformLocation, string>} Uniform names for reporting */
+        this.uniformNames = new WeakMap();
+        /** @type {WeakMap<WebGLTexture, {w: number, h: number}>} */
+        this.textureSizes = new WeakMap();
+
+        this.program = null;
+        this.activeUnit = target.TEXTURE0;
+        /** @type {Map<number, WebGLTexture>} texture unit -> TEXTURE_2D binding */
+        this.boundTextures = new Map();
+        /** @type {Map<number, WebGLBuffer>} buffer target -> binding */
+        this.boundBuffers = new Map();
+    }
+
+    /** Closes the current frame; its counters become lastFrame. */
+    endFrame() {
+        this.lastFrame = this.current;
+        this.current = createFrameCounters();
+        this.frames++;
+    }
+
+    /**
+     * Top call names of the last frame.
+     * @param {number} [n]
+     * @returns {Array<[string, number]>}
+     */
+    topCalls(n = 6) {
+        return Object.entries(this.lastFrame.calls).sort((a, b) => b[1] - a[1]).slice(0, n);
+    }
+
+    /**
+     * Bookkeeping before a call is forwarded to the real context.
+     * @param {string} name
+     * @param {IArguments} args
+     */
+    observe(name, args) {
+        const f = this.current;
+        f.total++;
+        f.calls[name] = (f.calls[name] || 0) + 1;
+
+        if (UNIFORM_SETTERS.has(name)) {
+            const loc = args[0];
+            if (!loc) return;
+            const key = uniformKey(args);
+            if (this.uniformValues.get(loc) === key) {
+                f.redundantUniforms++;
+                const uname = this.uniformNames.get(loc) || '?';
+                f.redundantByUniform[uname] = (f.redundantByUniform[uname] || 0) + 1;
+            } else {
+                this.uniformValues.set(loc, key);
+            }
+            return;
+        }
+
+        switch (name) {
+            case 'useProgram':
+                if (args[0] === this.program) f.redundantBinds++;
+                this.program = args[0];
+                break;
+            case 'activeTexture':
+                if (args[0] === this.activeUnit) f.redundantBinds++;
+                this.activeUnit = args[0];
+                break;
+            case 'bindTexture':
+                if (args[0] !== this.target.TEXTURE_2D) break;
+                if (this.boundTextures.get(this.activeUnit) === args[1]) f.redundantBinds++;
+                this.boundTextures.set(this.activeUnit, args[1]);
+                break;
+            case 'bindBuffer':
+                if (this.boundBuffers.get(args[0]) === args[1]) f.redundantBinds++;
+                this.boundBuffers.set(args[0], args[1]);
+                break;
+            case 'texImage2D': {
+                if (args[0] !== this.target.TEXTURE_2D || args[1] !== 0) break;
+                const tex = this.boundTextures.get(this.activeUnit);
+                if (!tex) break;
+                // (target, level, internalFormat, width, height, ...) or (target, level, internalFormat, format, type, source)
+                const w = args.length >= 9 ? args[3] : args[5]?.width;
+                const h = args.length >= 9 ? args[4] : args[5]?.height;
+                const prev = this.textureSizes.get(tex);
+                if (prev && prev.w === w && prev.h === h) f.textureReuploads++;
+                this.textureSizes.set(tex, {w, h});
+                break;
+            }
+            case 'deleteProgram':
+                if (args[0] === this.program) this.program = null;
+                break;
+        }
+    }
+}
+
+/**
+ * Wraps a WebGL context in a counting proxy. Constants and properties pass through; methods are forwarded with the
+ * real context as `this`. The stats object is reachable as `proxy.glStats`.
+ * @param {WebGLRenderingContext} gl
+ * @returns {WebGLRenderingContext}
+ */
+export function createCountingContext(gl) {
+    const stats = new GLCallStats(gl);
+    const wrappers = new Map();
+
+    return new Proxy(gl, {
+        get(target, prop) {
+            if (prop === 'glStats') return stats;
+
+            const value = target[prop];
+            if (typeof value !== 'function') return value;
+
+            let wrapped = wrappers.get(prop);
+            if (!wrapped) {
+                const name = String(prop);
+                if (name === 'getUniformLocation') {
+                    wrapped = function (program, uname) {
+                        stats.observe(name, arguments);
+                        const loc = value.call(target, program, uname);
+                        if (loc) stats.uniformNames.set(loc, uname);
+                        return loc;
+                    };
+                } else {
+                    wrapped = function () {
+                        stats.observe(name, arguments);
+                        return value.apply(target, arguments);
+                    };
+                }
+                wrappers.set(prop, wrapped);
+            }
+            return wrapped;
+        }
+    });
+}
+
+/**
+ * Returns the stats of a counting context, or null for a plain context.
+ * @param {WebGLRenderingContext|null} gl
+ * @returns {GLCallStats|null}
+ */
+export function getGLCallStats(gl) {
+    return gl?.glStats || null;
+}
+
+/**
+ * Returns the underlying context of a counting proxy (or the context itself).
+ * @param {WebGLRenderingContext|null} gl
+ * @returns {WebGLRenderingContext|null}
+ */
+export function unwrapGL(gl) {
+    return gl?.glStats?.target || gl || null;
+}
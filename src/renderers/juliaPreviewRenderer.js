@@ -72,6 +72,8 @@ export class JuliaPreviewRenderer extends FractalRenderer {
      * @override
      */
     draw() {
+        if (!this.gl) return; // No WebGL and no CPU kernel for the preview
+
         this.gl.useProgram(this.program);
 
         const baseIters = Math.floor(3000 * Math.pow(2, -Math.log2(this.zoom)));
@@ -3,16 +3,22 @@ import FractalRenderer from "./fractalRenderer";
 import {
     asyncDelay,
     compareComplex,
-    ddSubDD,
     degToRad,
+    fillTexels,
     hexToRGB,
+    interpolateZoom,
     lerp,
     normalizeRotation,
-    splitFloat,
+    splitFloatInto,
+    splitScaledDDInto,
+    splitZoomInto,
 } from "../global/utils";
 import "../global/types";
+import {qdSubDDInto} from "../global/quadDouble";
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEFAULT_JULIA_PALETTE, EASE_TYPE,} from "../global/constants";
 import {updateJuliaSliders} from "../ui/juliaSlidersController";
+import {profiler} from "../global/profiler";
+import {CPU_KERNEL} from "./cpuKernel";
 /** @type {string} */
 import fragmentShaderRaw from '../shaders/julia.frag';
 import fragmentShaderRawLegacy from '../shaders/julia.legacy.frag';
@@ -127,6 +133,8 @@ export class JuliaRenderer extends FractalRenderer {
         this.cAnimationActive = false; // Defers orbit rebuild during C-animation for performance
         this.demoTime = 0;
 
+        this.cpuKernel = CPU_KERNEL.JULIA;
+
         this.init();
     }
 
@@ -155,6 +163,7 @@ export class JuliaRenderer extends FractalRenderer {
         this.deltaZ0LLoc = this.gl.getUniformLocation(this.program, "u_delta_z0_l");
         this.zoomHLoc = this.gl.getUniformLocation(this.program, "u_zoom_h");
         this.zoomLLoc = this.gl.getUniformLocation(this.program, "u_zoom_l");
+        this.zoomExpLoc = this.gl.getUniformLocation(this.program, "u_zoom_exp");
 
         this.orbitTexLoc = this.gl.getUniformLocation(this.program, "u_orbitTex");
         this.orbitWLoc = this.gl.getUniformLocation(this.program, "u_orbitW");
@@ -162,7 +171,8 @@ export class JuliaRenderer extends FractalRenderer {
         // Set up orbit texture
         this.floatTexExt = this.gl.getExtension("OES_texture_float");
         if (!this.floatTexExt) {
-            console.error("Missing OES_texture_float. Julia deep zoom perturbation requires it.");
+            // The orbit texture needs float textures; render on the CPU instead
+            this.enableCpuBackend('Missing OES_texture_float');
             return;
         }
 
@@ -296,34 +306,30 @@ export class JuliaRenderer extends FractalRenderer {
         let zx = this.refZ0[0];
         let zy = this.refZ0[1];
 
+        profiler.begin('orbit');
+        const orbitData = this.orbitData;
+        const end = this.MAX_ITER * 4;
         for (let n = 0; n < this.MAX_ITER; n++) {
-            const sx = splitFloat(zx);
-            const sy = splitFloat(zy);
-
             const idx = n * 4;
-            this.orbitData[idx] = sx.high;
-            this.orbitData[idx + 1] = sx.low;
-            this.orbitData[idx + 2] = sy.high;
-            this.orbitData[idx + 3] = sy.low;
+            splitFloatInto(zx, orbitData, idx);
+            splitFloatInto(zy, orbitData, idx + 2);
 
             const zx2 = zx * zx - zy * zy + cx;
             const zy2 = 2.0 * zx * zy + cy;
             zx = zx2; zy = zy2;
 
             if (zx * zx + zy * zy > 4.0) {
-                const fx = splitFloat(zx);
-                const fy = splitFloat(zy);
-                for (let k = n + 1; k < this.MAX_ITER; k++) {
-                    const j = k * 4;
-                    this.orbitData[j] = fx.high;
-                    this.orbitData[j + 1] = fx.low;
-                    this.orbitData[j + 2] = fy.high;
-                    this.orbitData[j + 3] = fy.low;
+                if (idx + 4 < end) {
+                    splitFloatInto(zx, orbitData, idx + 4);
+                    splitFloatInto(zy, orbitData, idx + 6);
+                    fillTexels(orbitData, idx + 4, end);
                 }
                 break;
             }
         }
+        profiler.end();
 
+        profiler.begin('upload');
         this.gl.activeTexture(this.gl.TEXTURE0);
         this.gl.bindTexture(this.gl.TEXTURE_2D, this.orbitTex);
 
@@ -341,6 +347,7 @@ export class JuliaRenderer extends FractalRenderer {
 
         if (this.orbitTexLoc) this.gl.uniform1i(this.orbitTexLoc, 0);
         if (this.orbitWLoc) this.gl.uniform1f(this.orbitWLoc, this.MAX_ITER);
+        profiler.end();
     }
 
     /**
@@ -356,7 +363,7 @@ export class JuliaRenderer extends FractalRenderer {
         if (!this.refPan) return true;
         if (!Number.isFinite(this.zoom)) return false;
 
-        const z = Math.max(this.zoom, 1e-300);
+        const z = Math.max(this.zoom, Number.MIN_VALUE);
 
         const dx = this.pan[0] - this.refPan[0];
         const dy = this.pan[1] - this.refPan[1];
@@ -376,8 +383,6 @@ export class JuliaRenderer extends FractalRenderer {
     }
 
     draw() {
-        this.gl.useProgram(this.program);
-
         // Iteration strategy avoids exploding to infinity at tiny zooms
         // const safe = Math.max(this.zoom, 1e-300);
         // const log2Depth = Math.log2(this.DEFAULT_ZOOM / safe);
@@ -388,6 +393,13 @@ export class JuliaRenderer extends FractalRenderer {
         const baseIters = Math.floor(3000 * Math.pow(2, -Math.log2(this.zoom)));
         this.iterations = Math.min(2000, baseIters + this.extraIterations);
 
+        if (this.cpuFallback) {
+            super.draw();
+            return;
+        }
+
+        this.gl.useProgram(this.program);
+
         // Detect view changes -> mark orbit dirty (use tolerant checks to avoid noise)
         const panMoved =
             Number.isFinite(this._prevPan0) && Number.isFinite(this._prevPan1)
@@ -423,31 +435,54 @@ export class JuliaRenderer extends FractalRenderer {
 
         if (this.orbitDirty && canRebaseNow) {
             // During interaction/animation, skip grid search (use view center directly)
+            profiler.begin('reference');
             this.pickReferenceNearViewCenter(isDeferringForAnimation);
+            profiler.end();
             this.computeReferenceOrbit();
             this.orbitDirty = false;
         }
 
-        // Compute deltaZ0 = panDD - refZ0DD on JS side (float64) for precision
+        profiler.begin('uniforms.dd');
+        // Compute deltaZ0 = panQD - refZ0DD on JS side (exact at any depth) for precision
         // This avoids float32 precision loss when the shader subtracts pan - refZ0
-        const deltaZ0X = ddSubDD(this.panDD.x, this.refZ0DD.x);
-        const deltaZ0Y = ddSubDD(this.panDD.y, this.refZ0DD.y);
+        const d = this.ddScratch;
+        qdSubDDInto(this.panQD.x, this.refZ0DD.x, d, 0);
+        qdSubDDInto(this.panQD.y, this.refZ0DD.y, d, 2);
+
+        // Zoom goes up as mantissa hi/lo and exponent, deltaZ0 pre-scaled by the same 2^-exp, so neither underflows
+        // float32 at depth (the shader iterates the scaled deltas)
+        const zoomExp = splitZoomInto(this.zoom, d, 4);
+        splitScaledDDInto(d[0], d[1], -zoomExp, d, 0);
+        splitScaledDDInto(d[2], d[3], -zoomExp, d, 2);
 
         // Upload deltaZ0 hi/lo
-        if (this.deltaZ0HLoc) this.gl.uniform2f(this.deltaZ0HLoc, deltaZ0X.hi, deltaZ0Y.hi);
-        if (this.deltaZ0LLoc) this.gl.uniform2f(this.deltaZ0LLoc, deltaZ0X.lo, deltaZ0Y.lo);
+        if (this.deltaZ0HLoc) this.gl.uniform2f(this.deltaZ0HLoc, d[0], d[2]);
+        if (this.deltaZ0LLoc) this.gl.uniform2f(this.deltaZ0LLoc, d[1], d[3]);
 
-        // Upload zoom hi/lo
-        const z = splitFloat(this.zoom);
-        if (this.zoomHLoc) this.gl.uniform1f(this.zoomHLoc, z.high);
-        if (this.zoomLLoc) this.gl.uniform1f(this.zoomLLoc, z.low);
+        // Upload zoom mantissa hi/lo and exponent
+        if (this.zoomHLoc) this.gl.uniform1f(this.zoomHLoc, d[4]);
+        if (this.zoomLLoc) this.gl.uniform1f(this.zoomLLoc, d[5]);
+        if (this.zoomExpLoc) this.gl.uniform1f(this.zoomExpLoc, zoomExp);
 
         if (this.cLoc) this.gl.uniform2fv(this.cLoc, this.c);
         if (this.innerStopsLoc) this.gl.uniform3fv(this.innerStopsLoc, this.innerStops);
+        profiler.end();
 
         super.draw();
     }
 
+    /**
+     * @inheritDoc
+     * @override
+     */
+    getCpuFrame() {
+        return {
+            ...super.getCpuFrame(),
+            c: [...this.c],
+            innerStops: Array.from(this.innerStops),
+        };
+    }
+
     /**
      * @inheritDoc
      * @override
@@ -699,7 +734,6 @@ export class JuliaRenderer extends FractalRenderer {
         // Phase 2: Consolidated animation to preset
         // Capture start values
         const startC = [...this.c];
-        const startPan = [...this.pan];
         const startZoom = this.zoom;
         const startRotation = this.rotation;
         const startStops = Array.from(this.innerStops);
@@ -709,6 +743,7 @@ export class JuliaRenderer extends FractalRenderer {
         const targetPan = preset.pan || this.DEFAULT_PAN;
         const targetZoom = preset.zoom || this.DEFAULT_ZOOM;
         const targetRotation = preset.rotation ?? 0;
+        const panPath = this.panPath(targetPan);
 
         // Target palette (if specified)
         let targetPalette = null;
@@ -739,14 +774,11 @@ export class JuliaRenderer extends FractalRenderer {
                 this.c[0] = lerp(startC[0], targetC[0], k);
                 this.c[1] = lerp(startC[1], targetC[1], k);
 
-                // Interpolate pan
-                this.setPan(
-                    lerp(startPan[0], targetPan[0], k),
-                    lerp(startPan[1], targetPan[1], k)
-                );
+                // Interpolate pan (quad-double, exact at the target)
+                this.setPanAlong(panPath, t < 1 ? k : 1);
 
                 // Interpolate zoom (exponential for smooth zoom feel)
-                this.zoom = startZoom * Math.pow(targetZoom / startZoom, k);
+                this.zoom = interpolateZoom(startZoom, targetZoom, k);
 
                 // Interpolate rotation
                 this.rotation = lerp(startRotation, targetRotation, k);
@@ -937,8 +969,9 @@ export class JuliaRenderer extends FractalRenderer {
         };
 
         // Continue cycling through presets while demo is active.
+        let nextIndex = getNextPresetIndex(random);
         while (this.demoActive) {
-            demoIndex = getNextPresetIndex(random);
+            demoIndex = nextIndex;
             const currentPreset = allPresets[demoIndex];
 
             if (!currentPreset) {
@@ -965,7 +998,8 @@ export class JuliaRenderer extends FractalRenderer {
                 onPresetComplete();
             }
 
-            await asyncDelay(2000);
+            nextIndex = getNextPresetIndex(random);
+            await Promise.all([asyncDelay(2000), this.prefetchView(allPresets[nextIndex])]);
         }
 
         console.log(`Demo interrupted.`);
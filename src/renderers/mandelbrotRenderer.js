@@ -1,6 +1,19 @@
 import FractalRenderer from "./fractalRenderer";
-import {asyncDelay, ddSubDD, hexToRGBArray, lerp, normalizeRotation, splitFloat} from "../global/utils";
+import {
+    asyncDelay,
+    fillTexels,
+    hexToRGBArray,
+    lerp,
+    normalizeRotation,
+    splitFloatInto,
+    splitScaledDDInto,
+    splitZoomInto
+} from "../global/utils";
+import {coordinateToNumber, qdSubDDInto} from "../global/quadDouble";
 import {CONSOLE_GROUP_STYLE, EASE_TYPE, log, PI} from "../global/constants";
+import {CPU_KERNEL} from "./cpuKernel";
+import {profiler} from "../global/profiler";
+import {cacheGet, cachePut, viewStateKey} from "../global/renderCache";
 import presetsData from '../data/mandelbrot.json';
 /** @type {string} */
 import fragmentShaderRaw from '../shaders/mandelbrot.frag';
@@ -43,6 +56,8 @@ class MandelbrotRenderer extends FractalRenderer {
         /** IMPORTANT: MAX_ITER must remain constant after shader compilation + orbit buffer allocation. */
         this.MAX_ITER = 5000;
 
+        this.cpuKernel = CPU_KERNEL.MANDELBROT;
+
         // Reference search parameters (for perturbation rebasing)
         this.REF_SEARCH_GRID = 7;
         this.REF_SEARCH_RADIUS = 0.50;
@@ -50,6 +65,13 @@ class MandelbrotRenderer extends FractalRenderer {
         // Hysteresis state for rebasing
         this.rebaseArmed = true;
 
+        /** @type {Object|null} Reference orbit precomputed for an upcoming demo destination (see prefetchView) */
+        this.prefetched = null;
+        /** @type {Object|null} The prefetched reference currently uploaded to the orbit texture */
+        this.activePrefetch = null;
+        /** @type {number} Invalidates prefetches superseded by a newer one */
+        this.prefetchToken = 0;
+
         // Shader switching
         this.currentShader = 'perturbation';
         this.fragmentShaderSource = SHADER_OPTIONS[this.currentShader].source;
@@ -105,6 +127,7 @@ class MandelbrotRenderer extends FractalRenderer {
         // zoom hi/lo
         this.zoomHLoc = this.gl.getUniformLocation(this.program, 'u_zoom_h');
         this.zoomLLoc = this.gl.getUniformLocation(this.program, 'u_zoom_l');
+        this.zoomExpLoc = this.gl.getUniformLocation(this.program, 'u_zoom_exp');
 
         // orbit texture uniforms
         this.orbitTexLoc = this.gl.getUniformLocation(this.program, 'u_orbitTex');
@@ -117,7 +140,8 @@ class MandelbrotRenderer extends FractalRenderer {
         // Set up orbit texture
         this.floatTexExt = this.gl.getExtension("OES_texture_float");
         if (!this.floatTexExt) {
-            console.error('Missing OES_texture_float. Perturbation orbit texture upload requires it.');
+            // The orbit texture needs float textures; render on the CPU instead
+            this.enableCpuBackend('Missing OES_texture_float');
             return;
         }
 
@@ -175,6 +199,35 @@ class MandelbrotRenderer extends FractalRenderer {
         return iters;
     }
 
+    /**
+     * Grid search around a view center for the reference point that escapes last (prefers interior points).
+     * @param {number} panX
+     * @param {number} panY
+     * @param {number} zoom Scales the search radius
+     * @param {number} probeIters
+     * @returns {{cx: number, cy: number, score: number}}
+     */
+    findReference(panX, panY, zoom, probeIters) {
+        const grid = this.REF_SEARCH_GRID;
+        const half = (grid - 1) / 2;
+        const step = (2.0 * this.REF_SEARCH_RADIUS) / (grid - 1);
+
+        // Start with view center as fallback
+        let best = {cx: panX, cy: panY, score: this.escapeItersDouble(panX, panY, probeIters)};
+
+        for (let j = 0; j < grid; j++) {
+            for (let i = 0; i < grid; i++) {
+                const cx = panX + (i - half) * step * zoom;
+                const cy = panY + (j - half) * step * zoom;
+
+                const score = this.escapeItersDouble(cx, cy, probeIters);
+                if (score > best.score) best = {cx, cy, score};
+            }
+        }
+
+        return best;
+    }
+
     /**
      * Choose a good refPan near view center:
      * - sample a grid around view center (radius scales with zoom)
@@ -195,10 +248,6 @@ class MandelbrotRenderer extends FractalRenderer {
             return;
         }
 
-        const grid = this.REF_SEARCH_GRID;
-        const half = (grid - 1) / 2;
-        const step = (2.0 * this.REF_SEARCH_RADIUS) / (grid - 1);
-
         const base = this.zoom; // scale offsets by current zoom
 
         const probeIters = Math.min(this.MAX_ITER, Math.max(200, Math.floor(this.iterations)));
@@ -212,26 +261,7 @@ class MandelbrotRenderer extends FractalRenderer {
             currentRefScore = this.escapeItersDouble(this.refPan[0], this.refPan[1], probeIters);
         }
 
-        // Start with view center as fallback
-        let bestCx = this.pan[0];
-        let bestCy = this.pan[1];
-        let bestScore = this.escapeItersDouble(this.pan[0], this.pan[1], probeIters);
-
-        for (let j = 0; j < grid; j++) {
-            for (let i = 0; i < grid; i++) {
-                const ox = (i - half) * step;
-                const oy = (j - half) * step;
-                const cx = this.pan[0] + ox * base;
-                const cy = this.pan[1] + oy * base;
-
-                const score = this.escapeItersDouble(cx, cy, probeIters);
-                if (score > bestScore) {
-                    bestScore = score;
-                    bestCx = cx;
-                    bestCy = cy;
-                }
-            }
-        }
+        const {cx: bestCx, cy: bestCy, score: bestScore} = this.findReference(this.pan[0], this.pan[1], base, probeIters);
 
         // Stability: only switch reference if the new one is significantly better.
         // This prevents jitter from small score differences between frames.
@@ -254,9 +284,29 @@ class MandelbrotRenderer extends FractalRenderer {
     computeReferenceOrbit() {
         if (!this.orbitData || !this.orbitTex) return;
 
-        const cx = this.refPan[0];
-        const cy = this.refPan[1];
+        const useSeriesShader = this.currentShader === 'series' && this.coeffData;
+
+        // Track when series becomes unreliable; dc_max is estimated from the view size (half view width)
+        profiler.begin('orbit');
+        this.skipIter = this.buildReferenceOrbit(this.refPan[0], this.refPan[1], this.orbitData,
+            useSeriesShader ? this.coeffData : null, this.zoom * 0.5);
+        profiler.end();
+
+        profiler.begin('upload');
+        this.uploadReferenceOrbit(this.orbitData, useSeriesShader ? this.coeffData : null);
+        profiler.end();
+    }
 
+    /**
+     * Iterates the reference orbit of c = (cx, cy) and, optionally, its series approximation coefficients.
+     * @param {number} cx
+     * @param {number} cy
+     * @param {Float32Array} orbitData MAX_ITER x (hi_x, lo_x, hi_y, lo_y)
+     * @param {Float32Array|null} coeffData A and B coefficient rows, or null when the series shader is not used
+     * @param {number} dcMax Largest pixel offset from the reference (for the series validity estimate)
+     * @return {number} Iterations the series shader may skip
+     */
+    buildReferenceOrbit(cx, cy, orbitData, coeffData, dcMax) {
         let zx = 0.0, zy = 0.0;
 
         // Series approximation coefficients (complex numbers)
@@ -267,42 +317,25 @@ class MandelbrotRenderer extends FractalRenderer {
 
         // Track when series becomes unreliable
         // Series is valid while |B * dc²| << |A * dc|
-        // We estimate dc_max based on zoom and view size
-        const dcMax = this.zoom * 0.5;  // Half view width
         let lastValidSkip = 0;
 
-        const useSeriesShader = this.currentShader === 'series' && this.coeffData;
+        const useSeriesShader = !!coeffData;
 
-        for (let n = 0; n < this.MAX_ITER; n++) {
-            const sx = splitFloat(zx);
-            const sy = splitFloat(zy);
+        const rowB = this.MAX_ITER * 4;
 
+        for (let n = 0; n < this.MAX_ITER; n++) {
+            // Split straight into the hi/lo texel layout (no intermediate objects)
             const idx = n * 4;
-            this.orbitData[idx] = sx.high;
-            this.orbitData[idx + 1] = sx.low;
-            this.orbitData[idx + 2] = sy.high;
-            this.orbitData[idx + 3] = sy.low;
+            splitFloatInto(zx, orbitData, idx);
+            splitFloatInto(zy, orbitData, idx + 2);
 
             // Store coefficients if using series shader
             if (useSeriesShader) {
-                const sAx = splitFloat(Ax);
-                const sAy = splitFloat(Ay);
-                const sBx = splitFloat(Bx);
-                const sBy = splitFloat(By);
-
-                // Row 0: A coefficients
-                const idxA = n * 4;
-                this.coeffData[idxA] = sAx.high;
-                this.coeffData[idxA + 1] = sAx.low;
-                this.coeffData[idxA + 2] = sAy.high;
-                this.coeffData[idxA + 3] = sAy.low;
-
-                // Row 1: B coefficients (offset by MAX_ITER * 4)
-                const idxB = this.MAX_ITER * 4 + n * 4;
-                this.coeffData[idxB] = sBx.high;
-                this.coeffData[idxB + 1] = sBx.low;
-                this.coeffData[idxB + 2] = sBy.high;
-                this.coeffData[idxB + 3] = sBy.low;
+                // Row 0: A coefficients, row 1: B coefficients (offset by MAX_ITER * 4)
+                splitFloatInto(Ax, coeffData, idx);
+                splitFloatInto(Ay, coeffData, idx + 2);
+                splitFloatInto(Bx, coeffData, rowB + idx);
+                splitFloatInto(By, coeffData, rowB + idx + 2);
 
                 // Check series validity: |B * dc²| should be much smaller than |A * dc|
                 const Amag = Math.sqrt(Ax * Ax + Ay * Ay);
@@ -348,44 +381,35 @@ class MandelbrotRenderer extends FractalRenderer {
 
             if (zx * zx + zy * zy > 4.0) {
                 // Fill remainder with last value (keeps texture defined)
-                const fx = splitFloat(zx);
-                const fy = splitFloat(zy);
-                for (let k = n + 1; k < this.MAX_ITER; k++) {
-                    const j = k * 4;
-                    this.orbitData[j] = fx.high;
-                    this.orbitData[j + 1] = fx.low;
-                    this.orbitData[j + 2] = fy.high;
-                    this.orbitData[j + 3] = fy.low;
-                }
-
-                // Fill remaining coefficients with last values
-                if (useSeriesShader) {
-                    const sAx = splitFloat(Ax);
-                    const sAy = splitFloat(Ay);
-                    const sBx = splitFloat(Bx);
-                    const sBy = splitFloat(By);
-                    for (let k = n + 1; k < this.MAX_ITER; k++) {
-                        const idxA = k * 4;
-                        this.coeffData[idxA] = sAx.high;
-                        this.coeffData[idxA + 1] = sAx.low;
-                        this.coeffData[idxA + 2] = sAy.high;
-                        this.coeffData[idxA + 3] = sAy.low;
-
-                        const idxB = this.MAX_ITER * 4 + k * 4;
-                        this.coeffData[idxB] = sBx.high;
-                        this.coeffData[idxB + 1] = sBx.low;
-                        this.coeffData[idxB + 2] = sBy.high;
-                        this.coeffData[idxB + 3] = sBy.low;
+                if (n + 1 < this.MAX_ITER) {
+                    const first = idx + 4;
+                    splitFloatInto(zx, orbitData, first);
+                    splitFloatInto(zy, orbitData, first + 2);
+                    fillTexels(orbitData, first, rowB);
+
+                    // Fill remaining coefficients with last values
+                    if (useSeriesShader) {
+                        splitFloatInto(Ax, coeffData, first);
+                        splitFloatInto(Ay, coeffData, first + 2);
+                        splitFloatInto(Bx, coeffData, rowB + first);
+                        splitFloatInto(By, coeffData, rowB + first + 2);
+                        fillTexels(coeffData, first, rowB);
+                        fillTexels(coeffData, rowB + first, rowB * 2);
                     }
                 }
                 break;
             }
         }
 
-        // Store the valid skip iteration
-        this.skipIter = lastValidSkip;
+        return lastValidSkip;
+    }
 
-        // Upload orbit texture
+    /**
+     * Uploads a reference orbit (and series coefficients) to the orbit textures.
+     * @param {Float32Array} orbitData
+     * @param {Float32Array|null} coeffData
+     */
+    uploadReferenceOrbit(orbitData, coeffData) {
         this.gl.activeTexture(this.gl.TEXTURE0);
         this.gl.bindTexture(this.gl.TEXTURE_2D, this.orbitTex);
 
@@ -398,14 +422,14 @@ class MandelbrotRenderer extends FractalRenderer {
             0,
             this.gl.RGBA,
             this.gl.FLOAT,
-            this.orbitData
+            orbitData
         );
 
         if (this.orbitTexLoc) this.gl.uniform1i(this.orbitTexLoc, 0);
         if (this.orbitWLoc) this.gl.uniform1f(this.orbitWLoc, this.MAX_ITER);
 
         // Upload coefficient texture if using series shader
-        if (useSeriesShader && this.coeffTex) {
+        if (coeffData && this.coeffTex) {
             this.gl.activeTexture(this.gl.TEXTURE1);
             this.gl.bindTexture(this.gl.TEXTURE_2D, this.coeffTex);
 
@@ -419,7 +443,7 @@ class MandelbrotRenderer extends FractalRenderer {
                 0,
                 this.gl.RGBA,
                 this.gl.FLOAT,
-                this.coeffData
+                coeffData
             );
 
             if (this.coeffTexLoc) this.gl.uniform1i(this.coeffTexLoc, 1);
@@ -427,42 +451,151 @@ class MandelbrotRenderer extends FractalRenderer {
         }
     }
 
+    // region > PREFETCH
+
     /**
-     * @inheritDoc
+     * Precomputes the reference and its orbit for a destination while the demo holds the current view. The search
+     * and the orbit run in separate event loop turns so frames still being drawn are not delayed. Results are kept
+     * in the persistent render cache, so a replayed demo after a reload skips both.
      * @override
+     * @param {MANDELBROT_PRESET} view
+     * @return {Promise<void>}
      */
-    draw() {
-        this.gl.useProgram(this.program);
+    async prefetchView(view) {
+        if (!view?.pan || !Number.isFinite(view.zoom)) return;
+        const token = ++this.prefetchToken;
+        const shader = this.currentShader;
+        // Saved deep presets carry decimal strings; the search and the orbit run in doubles
+        const pan = [coordinateToNumber(view.pan[0]), coordinateToNumber(view.pan[1])];
+        const probeIters = Math.min(this.MAX_ITER, Math.max(200, this.iterationsForZoom(view.zoom)));
+        const cacheKey = viewStateKey('orbit', {
+            mode: 'mandelbrot', pan: view.pan, zoom: view.zoom, shader, maxIter: this.MAX_ITER, probeIters
+        });
+
+        const cached = await cacheGet(cacheKey);
+        if (token !== this.prefetchToken || shader !== this.currentShader) return;
+        if (cached) {
+            this.prefetched = {pan, zoom: view.zoom, ...cached, shader};
+            log(`Restored cached reference for [${view.pan[0]}, ${view.pan[1]}] @ ${view.zoom.toExponential(2)}`);
+            return;
+        }
+
+        await asyncDelay(0);
+        if (token !== this.prefetchToken) return;
+        profiler.begin('prefetch');
+        const ref = this.findReference(pan[0], pan[1], view.zoom, probeIters);
+        profiler.end();
+
+        await asyncDelay(0);
+        if (token !== this.prefetchToken || shader !== this.currentShader) return;
+        profiler.begin('prefetch');
+        const orbitData = new Float32Array(this.MAX_ITER * 4);
+        const coeffData = shader === 'series' ? new Float32Array(this.MAX_ITER * 4 * 2) : null;
+        const skipIter = this.buildReferenceOrbit(ref.cx, ref.cy, orbitData, coeffData, view.zoom * 0.5);
+        profiler.end();
+
+        const reference = {refPan: [ref.cx, ref.cy], orbitData, coeffData, skipIter};
+        this.prefetched = {pan, zoom: view.zoom, ...reference, shader};
+        log(`Prefetched reference for [${view.pan[0]}, ${view.pan[1]}] @ ${view.zoom.toExponential(2)}`);
+        cachePut(cacheKey, 'orbit', reference, orbitData.byteLength + (coeffData?.byteLength ?? 0));
+    }
 
+    /**
+     * Installs the prefetched reference if the view is on its way into (or at) the prefetched destination.
+     * Series coefficients are only valid near the destination zoom, plain perturbation at any shallower zoom.
+     * @return {boolean} True if the prefetched orbit serves this view (no search or rebuild needed)
+     */
+    usePrefetchedReference() {
+        const p = this.prefetched;
+        if (!p || p.shader !== this.currentShader) return false;
+        if (this.zoom < p.zoom * 0.5 || (p.coeffData && this.zoom > p.zoom * 1.5)) return false;
+        if (Math.hypot(this.pan[0] - p.pan[0], this.pan[1] - p.pan[1]) > this.zoom * 0.25) return false;
+
+        if (this.activePrefetch !== p) {
+            this.refPan[0] = p.refPan[0];
+            this.refPan[1] = p.refPan[1];
+            this.refPanDD.x.hi = p.refPan[0];
+            this.refPanDD.x.lo = 0;
+            this.refPanDD.y.hi = p.refPan[1];
+            this.refPanDD.y.lo = 0;
+            this.skipIter = p.skipIter;
+
+            profiler.begin('upload');
+            this.uploadReferenceOrbit(p.orbitData, p.coeffData);
+            profiler.end();
+            this.activePrefetch = p;
+        }
+        return true;
+    }
+
+    // endregion
+
+    /**
+     * Iteration budget for a zoom level. Grows with depth, clamped to MAX_ITER; adaptive quality adjusts it through
+     * extraIterations.
+     * @param {number} zoom
+     * @return {number}
+     */
+    iterationsForZoom(zoom) {
         // Iteration strategy avoids exploding to infinity at tiny zooms
         // TODO Tune! main point is: clamp to MAX_ITER.
-        const safe = Math.max(this.zoom, 1e-300);
+        const safe = Math.max(zoom, Number.MIN_VALUE);
         const log2Depth = Math.log2(this.DEFAULT_ZOOM / safe);
         const baseIters = Math.floor(200 + 50 * log2Depth);
-        this.iterations = Math.max(50, Math.min(this.MAX_ITER, baseIters + this.extraIterations));
+        return Math.max(50, Math.min(this.MAX_ITER, baseIters + this.extraIterations));
+    }
+
+    /**
+     * @inheritDoc
+     * @override
+     */
+    draw() {
+        if (this.cpuFallback) {
+            this.iterations = this.iterationsForZoom(this.zoom);
+            super.draw();
+            return;
+        }
+
+        this.gl.useProgram(this.program);
+
+        this.iterations = this.iterationsForZoom(this.zoom);
 
         const mustRebaseNow = this.needsRebase();
         const canRebaseNow = !this.interactionActive || mustRebaseNow;
 
         if (this.orbitDirty && canRebaseNow) {
-            this.pickReferenceNearViewCenter();
-            this.computeReferenceOrbit();
+            // Demo travels into a prefetched destination reuse its orbit instead of searching every frame
+            if (!this.usePrefetchedReference()) {
+                this.activePrefetch = null;
+                profiler.begin('reference');
+                this.pickReferenceNearViewCenter();
+                profiler.end();
+                this.computeReferenceOrbit();
+            }
             this.orbitDirty = false;
         }
 
-        // Compute deltaPan = panDD - refPanDD on JS side (float64) for precision
+        profiler.begin('uniforms.dd');
+        // Compute deltaPan = panQD - refPanDD on JS side (exact at any depth) for precision
         // This avoids float32 precision loss when the shader subtracts viewPan - refPan
-        const deltaPanX = ddSubDD(this.panDD.x, this.refPanDD.x);
-        const deltaPanY = ddSubDD(this.panDD.y, this.refPanDD.y);
+        const d = this.ddScratch;
+        qdSubDDInto(this.panQD.x, this.refPanDD.x, d, 0);
+        qdSubDDInto(this.panQD.y, this.refPanDD.y, d, 2);
+
+        // Zoom goes up as mantissa hi/lo and exponent, deltaPan pre-scaled by the same 2^-exp, so neither underflows
+        // float32 at depth (the shader iterates the scaled deltas)
+        const zoomExp = splitZoomInto(this.zoom, d, 4);
+        splitScaledDDInto(d[0], d[1], -zoomExp, d, 0);
+        splitScaledDDInto(d[2], d[3], -zoomExp, d, 2);
 
         // Upload deltaPan hi/lo
-        if (this.deltaPanHLoc) this.gl.uniform2f(this.deltaPanHLoc, deltaPanX.hi, deltaPanY.hi);
-        if (this.deltaPanLLoc) this.gl.uniform2f(this.deltaPanLLoc, deltaPanX.lo, deltaPanY.lo);
+        if (this.deltaPanHLoc) this.gl.uniform2f(this.deltaPanHLoc, d[0], d[2]);
+        if (this.deltaPanLLoc) this.gl.uniform2f(this.deltaPanLLoc, d[1], d[3]);
 
-        // Upload zoom hi/lo
-        const z = splitFloat(this.zoom);
-        if (this.zoomHLoc) this.gl.uniform1f(this.zoomHLoc, z.high);
-        if (this.zoomLLoc) this.gl.uniform1f(this.zoomLLoc, z.low);
+        // Upload zoom mantissa hi/lo and exponent
+        if (this.zoomHLoc) this.gl.uniform1f(this.zoomHLoc, d[4]);
+        if (this.zoomLLoc) this.gl.uniform1f(this.zoomLLoc, d[5]);
+        if (this.zoomExpLoc) this.gl.uniform1f(this.zoomExpLoc, zoomExp);
 
         // Upload color parameters
         if (this.frequencyLoc) this.gl.uniform3fv(this.frequencyLoc, this.frequency);
@@ -472,10 +605,24 @@ class MandelbrotRenderer extends FractalRenderer {
         if (this.skipIterLoc && this.currentShader === 'series') {
             this.gl.uniform1f(this.skipIterLoc, this.skipIter);
         }
+        profiler.end();
 
         super.draw();
     }
 
+    /**
+     * @inheritDoc
+     * @override
+     */
+    getCpuFrame() {
+        return {
+            ...super.getCpuFrame(),
+            colorPalette: [...this.colorPalette],
+            frequency: [...this.frequency],
+            phase: [...this.phase],
+        };
+    }
+
     needsRebase() {
         const dx = this.pan[0] - this.refPan[0];
         const dy = this.pan[1] - this.refPan[1];
@@ -500,6 +647,8 @@ class MandelbrotRenderer extends FractalRenderer {
             return true;  // Already using this shader
         }
 
+        if (this.cpuFallback) return false;  // The CPU kernel has no shader variants
+
         log(`Switching Mandelbrot shader: ${this.currentShader} → ${shaderId}`);
 
         this.currentShader = shaderId;
@@ -547,6 +696,8 @@ class MandelbrotRenderer extends FractalRenderer {
         this.phase = [...this.DEFAULT_PHASE];
         this.currentPaletteIndex = 0;
         this.orbitDirty = true;
+        this.prefetched = null;
+        this.activePrefetch = null;
         super.reset();
     }
 
@@ -727,7 +878,10 @@ class MandelbrotRenderer extends FractalRenderer {
         const nearTargetZoom = zoomRatio < 2.5; // Within ~12x zoom difference
 
         // Pan distance relative to TARGET view size (what matters at the end)
-        const panDist = Math.hypot(this.pan[0] - preset.pan[0], this.pan[1] - preset.pan[1]);
+        const panDist = Math.hypot(
+            this.pan[0] - coordinateToNumber(preset.pan[0]),
+            this.pan[1] - coordinateToNumber(preset.pan[1])
+        );
         const targetViewSize = preset.zoom;
         const panRatio = panDist / targetViewSize;
         const atTargetPan = panRatio < 0.1; // Essentially same position at target zoom
@@ -883,8 +1037,9 @@ class MandelbrotRenderer extends FractalRenderer {
         };
 
         // Continue cycling through presets while demo is active.
+        let nextIndex = getNextPresetIndex(random);
         while (this.demoActive) {
-            demoIndex = getNextPresetIndex(random);
+            demoIndex = nextIndex;
             const currentPreset = allPresets[demoIndex];
 
             if (!currentPreset) {
@@ -911,7 +1066,8 @@ class MandelbrotRenderer extends FractalRenderer {
                 onPresetComplete();
             }
 
-            await asyncDelay(3500);
+            nextIndex = getNextPresetIndex(random);
+            await Promise.all([asyncDelay(3500), this.prefetchView(allPresets[nextIndex])]);
         }
 
         console.log(`Demo interrupted.`);
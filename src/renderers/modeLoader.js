@@ -0,0 +1,122 @@
+/**
+ * @module ModeLoader
+ * @author Radim Brnka
+ * @description On-demand loading of the fractal modes. Each mode (its renderer, shaders, presets and mode-only UI
+ * modules) is a separate chunk fetched by a dynamic import, so the entry bundle only carries the shared shell and a
+ * visitor opening one mode does not download and parse the others. Once the current mode is running, the mode the
+ * user is most likely to switch to next is fetched in idle time, so the switch itself rarely waits for the network.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {FRACTAL_TYPE, log, LOG_LEVEL} from "../global/constants";
+
+/**
+ * @typedef {Object} ModeModules
+ * @property {typeof FractalRenderer} Renderer Renderer class of the mode
+ * @property {Object} [extras] Mode-only modules (e.g. the Julia preview, Riemann overlays and tour audio)
+ */
+
+/**
+ * Chunk loaders per mode. Imports sharing a webpackChunkName end up in the same chunk.
+ * @type {Object<number, function(): Promise<ModeModules>>}
+ */
+const MODE_CHUNKS = {
+    [FRACTAL_TYPE.MANDELBROT]: () => Promise.all([
+        import(/* webpackChunkName: "mandelbrot" */ './mandelbrotRenderer'),
+        import(/* webpackChunkName: "mandelbrot" */ './expMapZoom'),
+        import(/* webpackChunkName: "mandelbrot" */ './juliaPreviewRenderer')
+    ]).then(([renderer, expMapZoom, juliaPreview]) => ({
+        Renderer: renderer.default,
+        extras: {ExpMapZoom: expMapZoom.ExpMapZoom, JuliaPreviewRenderer: juliaPreview.JuliaPreviewRenderer}
+    })),
+
+    [FRACTAL_TYPE.JULIA]: () => import(/* webpackChunkName: "julia" */ './juliaRenderer')
+        .then(module => ({Renderer: module.JuliaRenderer, extras: {}})),
+
+    [FRACTAL_TYPE.RIEMANN]: () => Promise.all([
+        import(/* webpackChunkName: "riemann" */ './riemannRenderer'),
+        import(/* webpackChunkName: "riemann" */ '../ui/axesOverlay'),
+        import(/* webpackChunkName: "riemann" */ '../ui/zetaPathOverlay'),
+        import(/* webpackChunkName: "riemann" */ '../global/audioManager')
+    ]).then(([renderer, axesOverlay, zetaPathOverlay, tourAudio]) => ({
+        Renderer: renderer.default,
+        extras: {axesOverlay, zetaPathOverlay, tourAudio}
+    })),
+
+    [FRACTAL_TYPE.ROSSLER]: () => import(/* webpackChunkName: "rossler" */ './rosslerRenderer')
+        .then(module => ({Renderer: module.RosslerRenderer, extras: {}}))
+};
+
+/**
+ * Mode most likely opened after each mode: Mandelbrot and Julia are switched between with persistence, the others
+ * follow the mode cycle order.
+ * @type {Object<number, number>}
+ */
+const LIKELY_NEXT_MODE = {
+    [FRACTAL_TYPE.MANDELBROT]: FRACTAL_TYPE.JULIA,
+    [FRACTAL_TYPE.JULIA]: FRACTAL_TYPE.MANDELBROT,
+    [FRACTAL_TYPE.RIEMANN]: FRACTAL_TYPE.ROSSLER,
+    [FRACTAL_TYPE.ROSSLER]: FRACTAL_TYPE.MANDELBROT
+};
+
+/** @type {Map<number, Promise<ModeModules>>} */
+const pending = new Map();
+/** @type {Map<number, ModeModules>} */
+const loaded = new Map();
+
+/**
+ * Loads a mode's chunk (once; later calls share the same promise). A failed load is forgotten so it can be retried.
+ * @param {number} mode FRACTAL_TYPE
+ * @returns {Promise<ModeModules>}
+ */
+export function loadMode(mode) {
+    if (pending.has(mode)) return pending.get(mode);
+
+    const chunk = MODE_CHUNKS[mode];
+    if (!chunk) return Promise.reject(new Error(`Unknown fractal mode "${mode}"!`));
+
+    const promise = chunk().then(modules => {
+        loaded.set(mode, modules);
+        return modules;
+    }, error => {
+        pending.delete(mode);
+        throw error;
+    });
+    pending.set(mode, promise);
+    return promise;
+}
+
+/**
+ * Modules of a mode that has finished loading.
+ * @param {number} mode FRACTAL_TYPE
+ * @returns {ModeModules|null}
+ */
+export const getLoadedMode = (mode) => loaded.get(mode) ?? null;
+
+/**
+ * Fetches the mode most likely opened after the given one once the browser is idle.
+ * @param {number} mode FRACTAL_TYPE of the mode now running
+ */
+export function prefetchLikelyMode(mode) {
+    const next = LIKELY_NEXT_MODE[mode];
+    if (next === undefined || pending.has(next)) return;
+
+    const idle = globalThis.requestIdleCallback ?? (callback => setTimeout(callback, 2000));
+    idle(() => loadMode(next).then(
+        () => log(`Prefetched mode ${next}.`, 'ModeLoader'),
+        error => log(`Prefetch of mode ${next} failed: ${error}`, 'ModeLoader', LOG_LEVEL.WARN)
+    ));
+}
+
+/**
+ * Mode of a renderer instance, among the loaded modes.
+ * @param {FractalRenderer} renderer
+ * @returns {number|null} FRACTAL_TYPE
+ */
+export function getRendererMode(renderer) {
+    for (const [mode, {Renderer}] of loaded) {
+        if (renderer instanceof Renderer) return mode;
+    }
+    return null;
+}
@@ -1,4 +1,5 @@
-import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEBUG_MODE} from "../global/constants";
+import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEBUG_LEVEL, DEBUG_MODE, log, LOG_LEVEL} from "../global/constants";
+import {createCountingContext} from "./glCallCounter";
 import vertexShaderSource from '../shaders/vertexShaderInit.vert';
 
 /**
@@ -27,10 +28,14 @@ class Renderer {
         });
 
         if (!this.gl) {
-            alert('WebGL is not supported by your browser or crashed.');
+            // Fractal renderers with a CPU kernel fall back to it (see FractalRenderer.enableCpuBackend)
+            log('WebGL is not supported by your browser or crashed.', this.constructor.name, LOG_LEVEL.WARN);
             return;
         }
 
+        // Full debug builds count GL calls and redundant state changes (shown in the debug panel)
+        if (DEBUG_MODE === DEBUG_LEVEL.FULL) this.gl = createCountingContext(this.gl);
+
         /** @type {string} Vertex shader source code */
         this.vertexShaderSource = vertexShaderSource;
 
@@ -40,6 +45,16 @@ class Renderer {
         this.fragmentShader = null;
         /** @type {WebGLProgram|null} */
         this.program = null;
+        /** @type {WebGLBuffer|null} Full-screen quad vertices */
+        this.positionBuffer = null;
+        /** @type {number} */
+        this.positionLoc = -1;
+
+        /**
+         * Poster tile being rendered (see FractalRenderer.drawTile), null for regular on-screen frames.
+         * @type {{offsetX: number, offsetY: number, width: number, height: number, fullWidth: number, fullHeight: number}|null}
+         */
+        this.tile = null;
 
         this.onWebGLContextLost = this.onWebGLContextLost.bind(this);
         this.canvas.addEventListener('webglcontextlost', this.onWebGLContextLost);
@@ -136,13 +151,13 @@ class Renderer {
         this.gl.useProgram(this.program);
 
         // Full-screen quad
-        const positionBuffer = this.gl.createBuffer();
-        this.gl.bindBuffer(this.gl.ARRAY_BUFFER, positionBuffer);
+        if (this.positionBuffer) this.gl.deleteBuffer(this.positionBuffer);
+        this.positionBuffer = this.gl.createBuffer();
+        this.gl.bindBuffer(this.gl.ARRAY_BUFFER, this.positionBuffer);
         const positions = new Float32Array([-1, -1, 1, -1, -1, 1, 1, 1]);
         this.gl.bufferData(this.gl.ARRAY_BUFFER, positions, this.gl.STATIC_DRAW);
-        const positionLoc = this.gl.getAttribLocation(this.program, "a_position");
-        this.gl.enableVertexAttribArray(positionLoc);
-        this.gl.vertexAttribPointer(positionLoc, 2, this.gl.FLOAT, false, 0, 0);
+        this.positionLoc = this.gl.getAttribLocation(this.program, "a_position");
+        this.bindFullscreenQuad();
 
         // Hook for subclasses to cache uniform locations
         this.onProgramCreated();
@@ -150,6 +165,20 @@ class Renderer {
         if (DEBUG_MODE) console.groupEnd();
     }
 
+    /**
+     * Binds the full-screen quad to the position attribute and restores the main program.
+     * Attribute bindings are global GL state, so anything else drawing into this context
+     * (e.g. the overlay layer) calls this when done.
+     */
+    bindFullscreenQuad() {
+        if (!this.gl || !this.positionBuffer) return;
+
+        this.gl.useProgram(this.program);
+        this.gl.bindBuffer(this.gl.ARRAY_BUFFER, this.positionBuffer);
+        this.gl.enableVertexAttribArray(this.positionLoc);
+        this.gl.vertexAttribPointer(this.positionLoc, 2, this.gl.FLOAT, false, 0, 0);
+    }
+
     /**
      * Hook called after GL program is created and linked.
      * Subclasses can override to cache uniform locations.
@@ -160,12 +189,12 @@ class Renderer {
     }
 
     /**
-     * Base draw operation: sets viewport, clears the canvas, and draws the quad.
+     * Base draw operation: sets viewport, clears the canvas (or the bound tile framebuffer), and draws the quad.
      * Subclasses should call this after uploading their uniforms.
      */
     baseDraw() {
-        const w = this.canvas.width;
-        const h = this.canvas.height;
+        const w = this.tile ? this.tile.width : this.canvas.width;
+        const h = this.tile ? this.tile.height : this.canvas.height;
 
         this.gl.viewport(0, 0, w, h);
         this.gl.clearColor(0, 0, 0, 1);
@@ -210,6 +239,10 @@ class Renderer {
             this.gl.deleteShader(this.fragmentShader);
             this.fragmentShader = null;
         }
+        if (this.positionBuffer) {
+            this.gl.deleteBuffer(this.positionBuffer);
+            this.positionBuffer = null;
+        }
 
         this.gl = null;
         this.canvas = null;
@@ -1,7 +1,9 @@
 import FractalRenderer from "./fractalRenderer";
 import {asyncDelay, hexToRGBArray, lerp, normalizeRotation} from "../global/utils";
-import {CONSOLE_GROUP_STYLE, EASE_TYPE, log, RIEMANN_DOUBLE_PRECISION_THRESHOLD} from "../global/constants";
+import {CONSOLE_GROUP_STYLE, EASE_TYPE, FF_TILE_CACHE, log, RIEMANN_DOUBLE_PRECISION_THRESHOLD} from "../global/constants";
 import {updateInfo} from "../ui/ui";
+import {profiler} from "../global/profiler";
+import {TileCache} from "./tileCache";
 import presetsData from '../data/riemann.json';
 
 // Available shaders
@@ -59,6 +61,9 @@ class RiemannRenderer extends FractalRenderer {
         this.currentPaletteIndex = 0;
         this.zeroTourActive = false;
 
+        // Domain colouring is a fixed function of s for given kernel parameters, so views can be composed from tiles
+        this.tileCache = FF_TILE_CACHE ? new TileCache(this) : null;
+
         this.init();
     }
 
@@ -148,9 +153,33 @@ class RiemannRenderer extends FractalRenderer {
         return false;
     }
 
+    /**
+     * @inheritDoc
+     * @override
+     */
+    tileCacheKey() {
+        return [
+            this.currentShader,
+            this.iterations,
+            ...this.colorPalette,
+            ...this.frequency,
+            ...this.phase,
+            this.showCriticalLine ? 1 : 0,
+            this.useAnalyticExtension ? 1 : 0,
+            this.contourStrength,
+            this.canvas.height // tiles pin the critical line width to their level's zoom at this height
+        ].join(',');
+    }
+
     draw() {
-        // Auto-switch shader based on viewing region
-        this.checkAutoShaderSwitch();
+        if (!this.gl) return; // No CPU fallback for this mode (see FractalRenderer.enableCpuBackend)
+
+        // Auto-switch shader based on viewing region (tiles are rendered with the shader chosen for the view)
+        if (!this.tile) {
+            profiler.begin('shaderSwitch');
+            this.checkAutoShaderSwitch();
+            profiler.end();
+        }
 
         this.gl.useProgram(this.program);
 
@@ -158,11 +187,13 @@ class RiemannRenderer extends FractalRenderer {
         this.iterations = Math.max(20, Math.min(this.MAX_TERMS, this.seriesTerms + this.extraIterations));
 
         // Upload Riemann-specific uniforms
+        profiler.begin('uniforms.zeta');
         if (this.frequencyLoc) this.gl.uniform3fv(this.frequencyLoc, this.frequency);
         if (this.phaseLoc) this.gl.uniform3fv(this.phaseLoc, this.phase);
         if (this.showCriticalLineLoc) this.gl.uniform1i(this.showCriticalLineLoc, this.showCriticalLine ? 1 : 0);
         if (this.useAnalyticExtensionLoc) this.gl.uniform1i(this.useAnalyticExtensionLoc, this.useAnalyticExtension ? 1 : 0);
         if (this.contourStrengthLoc) this.gl.uniform1f(this.contourStrengthLoc, this.contourStrength);
+        profiler.end();
 
         super.draw();
     }
@@ -382,8 +413,9 @@ class RiemannRenderer extends FractalRenderer {
             return (demoIndex + 1) % allPresets.length;
         };
 
+        let nextIndex = getNextPresetIndex(random);
         while (this.demoActive) {
-            demoIndex = getNextPresetIndex(random);
+            demoIndex = nextIndex;
             const currentPreset = allPresets[demoIndex];
 
             if (!currentPreset) {
@@ -402,7 +434,8 @@ class RiemannRenderer extends FractalRenderer {
 
             if (onPresetComplete) onPresetComplete();
 
-            await asyncDelay(10000);
+            nextIndex = getNextPresetIndex(random);
+            await Promise.all([asyncDelay(10000), this.prefetchView(allPresets[nextIndex])]);
         }
 
         console.log(`Demo interrupted.`);
@@ -448,7 +481,8 @@ class RiemannRenderer extends FractalRenderer {
             }
 
             if (this.zeroTourActive) {
-                await asyncDelay(holdDuration);
+                const next = this.PRESETS[i + 1] ?? this.PRESETS[0];
+                await Promise.all([asyncDelay(holdDuration), this.prefetchView({pan: next.pan, zoom: next.zoom || 8})]);
             }
         }
 
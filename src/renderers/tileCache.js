@@ -0,0 +1,658 @@
+/**
+ * @module TileCache
+ * @author Radim Brnka
+ * @description Quadtree tile cache for views whose pixels depend only on the fractal coordinate and a handful of
+ * kernel parameters (the Riemann domain colouring). The plane is split into a pyramid of square tiles, like map
+ * tiles: tile (level, x, y) covers [x, x + 1] x [y, y + 1] scaled by 2^-level. Tiles are rendered by the renderer's
+ * own kernel straight into slots of one atlas texture and stay valid while the kernel parameters do, so panning
+ * across explored space or returning to it only costs texture sampling. A frame draws the visible tiles of the level
+ * closest to the screen resolution: cached tiles, a few freshly rendered misses, and the matching part of a coarser
+ * cached ancestor for misses still pending, which are filled in on the following frames. Slots are recycled least
+ * recently used. Rendered tiles are also written to the persistent render cache when the browser is idle and read
+ * back from it on later sessions, in which case a miss waits for its stored pixels instead of being rendered.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log} from "../global/constants";
+import {profiler} from "../global/profiler";
+import {cacheGet, cachePut, getStoredKeys, isRenderCacheAvailable, viewStateKey} from "../global/renderCache";
+import composeVertexSource from '../shaders/tileCompose.vert';
+import composeFragmentSource from '../shaders/tileCompose.frag';
+
+/** Tile edge in texels */
+export const TILE_SIZE = 256;
+/** Preferred atlas edge (clamped to the GL limits) */
+const ATLAS_SIZE = 4096;
+/** Misses rendered per frame; the rest are stood in for by coarser tiles and rendered on the next frames */
+const TILE_RENDER_BUDGET = 6;
+/** Coarser levels searched for a stand-in while a tile is pending */
+const MAX_FALLBACK_LEVELS = 4;
+/** Idle time (ms) after which pending tiles are rendered by an extra frame */
+const REFINE_DELAY = 32;
+/** Texture unit the atlas is created and sampled on (0 = orbit, 1 = series coefficients, 2 = overlay atlas) */
+const ATLAS_TEXTURE_UNIT = 3;
+/** Tiles read back and persisted per idle callback (each read stalls on the GPU) */
+const PERSIST_BATCH = 2;
+/** Floats per compose vertex: clip.xy, uv, slot bounds */
+const VERTEX_STRIDE = 8;
+
+// region > TILE GEOMETRY ----------------------------------------------------------------------------------------------
+
+/**
+ * Level whose texels best match the screen pixels of a view (tiles are drawn between ~0.7x and ~1.4x).
+ * @param {number} zoom View height in fractal units
+ * @param {number} height Canvas height in pixels
+ * @param {number} [tileSize]
+ * @returns {number} May be negative (tiles larger than one unit)
+ */
+export function tileLevel(zoom, height, tileSize = TILE_SIZE) {
+    return Math.round(Math.log2(height / (tileSize * zoom)));
+}
+
+/**
+ * Maps a fractal point to clip space, inverting the view transform of the fractal shaders
+ * (coord = rotate(fragment - center) / height * zoom + pan). Runs in float64.
+ * @param {{pan: number[], zoom: number, rotation: number, width: number, height: number}} view
+ * @param {number} x
+ * @param {number} y
+ * @returns {number[]} [x, y] in clip space
+ */
+export function fractalToClip(view, x, y) {
+    const cos = Math.cos(view.rotation);
+    const sin = Math.sin(view.rotation);
+    const dx = (x - view.pan[0]) / view.zoom;
+    const dy = (y - view.pan[1]) / view.zoom;
+    return [
+        (dx * cos + dy * sin) * 2 * view.height / view.width,
+        (dy * cos - dx * sin) * 2
+    ];
+}
+
+/**
+ * Tile index range covering the (possibly rotated) view at a level.
+ * @param {{pan: number[], zoom: number, rotation: number, width: number, height: number}} view
+ * @param {number} level
+ * @returns {{x0: number, x1: number, y0: number, y1: number}} Inclusive
+ */
+export function visibleTileRange(view, level) {
+    const size = 2 ** -level;
+    const cos = Math.cos(view.rotation);
+    const sin = Math.sin(view.rotation);
+    const hx = 0.5 * view.width / view.height;
+
+    let minX = Infinity, minY = Infinity, maxX = -Infinity, maxY = -Infinity;
+    for (const [u, v] of [[-hx, -0.5], [hx, -0.5], [-hx, 0.5], [hx, 0.5]]) {
+        const x = view.pan[0] + (u * cos - v * sin) * view.zoom;
+        const y = view.pan[1] + (u * sin + v * cos) * view.zoom;
+        minX = Math.min(minX, x);
+        maxX = Math.max(maxX, x);
+        minY = Math.min(minY, y);
+        maxY = Math.max(maxY, y);
+    }
+
+    return {
+        x0: Math.floor(minX / size),
+        x1: Math.floor(maxX / size),
+        y0: Math.floor(minY / size),
+        y1: Math.floor(maxY / size)
+    };
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > SLOT ALLOCATION --------------------------------------------------------------------------------------------
+
+/**
+ * Least-recently-used map of tile keys to atlas slots. Entries are kept in use order (a Map iterates in insertion
+ * order and every hit re-inserts), so the oldest entry is always first. Slots used by the current frame are never
+ * evicted.
+ */
+export class TileLRU {
+
+    /**
+     * @param {number} capacity Number of atlas slots
+     */
+    constructor(capacity) {
+        this.capacity = capacity;
+        /** @type {Map<string, {slot: number, frame: number}>} */
+        this.entries = new Map();
+        /** @type {number[]} */
+        this.free = [];
+        this.clear();
+    }
+
+    get size() {
+        return this.entries.size;
+    }
+
+    /**
+     * Looks a tile up and marks it used by the frame.
+     * @param {string} key
+     * @param {number} frame
+     * @returns {{slot: number, frame: number}|null}
+     */
+    get(key, frame) {
+        const entry = this.entries.get(key);
+        if (!entry) return null;
+
+        this.entries.delete(key);
+        entry.frame = frame;
+        this.entries.set(key, entry);
+        return entry;
+    }
+
+    /**
+     * Assigns a slot to a new tile, evicting the least recently used one when the atlas is full.
+     * @param {string} key
+     * @param {number} frame
+     * @returns {{slot: number, frame: number}|null} null when every slot is in use by this frame
+     */
+    allocate(key, frame) {
+        let slot;
+        if (this.free.length > 0) {
+            slot = this.free.pop();
+        } else {
+            const oldest = this.entries.entries().next().value;
+            if (!oldest || oldest[1].frame === frame) return null;
+
+            this.entries.delete(oldest[0]);
+            slot = oldest[1].slot;
+        }
+
+        const entry = {slot, frame};
+        this.entries.set(key, entry);
+        return entry;
+    }
+
+    clear() {
+        this.entries.clear();
+        this.free = [];
+        for (let slot = this.capacity - 1; slot >= 0; slot--) this.free.push(slot);
+    }
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+
+export class TileCache {
+
+    /**
+     * @param {FractalRenderer} renderer Renderer whose kernel fills the tiles; it provides tileCacheKey()
+     */
+    constructor(renderer) {
+        this.renderer = renderer;
+
+        /** @type {WebGLRenderingContext|null} Context the GL resources belong to (re-created after context loss) */
+        this.gl = null;
+        this.ready = false;
+        this.program = null;
+        this.attribs = {};
+        this.atlasLoc = null;
+        this.atlas = null;
+        this.framebuffer = null;
+        this.vertexBuffer = null;
+        this.atlasSize = 0;
+        this.slotsPerRow = 0;
+        /** @type {TileLRU|null} */
+        this.lru = null;
+
+        this.frame = 0;
+        /** Kernel parameters of the previous frame; tiles are only used once they stop changing */
+        this.paramsKey = null;
+        this.refineRequest = null;
+
+        /** @type {Set<string>|null} Persisted tile keys (live), null until the persistent cache is opened */
+        this.storedKeys = null;
+        /** @type {Set<string>} Tiles being read back from the persistent cache */
+        this.loading = new Set();
+        /** @type {Array<{key: string, persistKey: string, slot: number}>} Rendered tiles awaiting persistence */
+        this.persistQueue = [];
+        this.persistRequest = null;
+        if (isRenderCacheAvailable()) getStoredKeys('tile').then(keys => this.storedKeys = keys);
+
+        /** Counters of the last composed frame */
+        this.stats = {level: 0, tiles: 0, hits: 0, rendered: 0, fallbacks: 0};
+    }
+
+    /**
+     * Creates the atlas, its framebuffer and the compose program.
+     * @returns {boolean} false if the cache cannot be used in this context
+     */
+    init() {
+        // Objects of a previous (lost) context are gone with it
+        this.program = this.atlas = this.framebuffer = this.vertexBuffer = this.lru = null;
+        const gl = this.gl = this.renderer.gl;
+
+        const viewportMax = gl.getParameter(gl.MAX_VIEWPORT_DIMS);
+        const maxSize = Math.min(ATLAS_SIZE, gl.getParameter(gl.MAX_TEXTURE_SIZE) || 0,
+            viewportMax?.[0] || 0, viewportMax?.[1] || 0);
+        this.slotsPerRow = Math.floor(maxSize / TILE_SIZE);
+        if (this.slotsPerRow < 4) return false;
+        this.atlasSize = this.slotsPerRow * TILE_SIZE;
+
+        this.program = this.createProgram();
+        if (!this.program) return false;
+
+        this.atlas = gl.createTexture();
+        gl.activeTexture(gl.TEXTURE0 + ATLAS_TEXTURE_UNIT);
+        gl.bindTexture(gl.TEXTURE_2D, this.atlas);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, this.atlasSize, this.atlasSize, 0, gl.RGBA, gl.UNSIGNED_BYTE, null);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+        gl.activeTexture(gl.TEXTURE0);
+
+        this.framebuffer = gl.createFramebuffer();
+        gl.bindFramebuffer(gl.FRAMEBUFFER, this.framebuffer);
+        gl.framebufferTexture2D(gl.FRAMEBUFFER, gl.COLOR_ATTACHMENT0, gl.TEXTURE_2D, this.atlas, 0);
+        const complete = gl.checkFramebufferStatus(gl.FRAMEBUFFER) === gl.FRAMEBUFFER_COMPLETE;
+        gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+        if (!complete) {
+            console.warn('TileCache: atlas framebuffer incomplete, tile cache disabled.');
+            return false;
+        }
+
+        this.vertexBuffer = gl.createBuffer();
+        this.lru = new TileLRU(this.slotsPerRow * this.slotsPerRow);
+        this.paramsKey = null;
+        this.loading.clear();
+        this.persistQueue = [];
+
+        log(`Initialized (${this.atlasSize}px atlas, ${this.lru.capacity} tiles).`, 'TileCache');
+        return true;
+    }
+
+    /** Forgets the GL resources after the context was lost; they are re-created by the next frame. */
+    resetContext() {
+        this.gl = null;
+        this.ready = false;
+    }
+
+    /** Drops every cached tile (e.g. after the kernel itself changed). */
+    invalidate() {
+        this.lru?.clear();
+        this.paramsKey = null;
+    }
+
+    /**
+     * Draws the current view from the cache into the canvas. Misses within the frame budget are rendered first;
+     * the remaining ones are shown from coarser tiles and another frame is scheduled to fill them in.
+     * Leaves the renderer's program and quad bound again.
+     * @returns {boolean} false if the view could not be covered (the caller renders it directly)
+     */
+    compose() {
+        const r = this.renderer;
+        const paramsKey = r.tileCacheKey();
+        if (!paramsKey || !r.canvas?.width || !r.canvas.height) {
+            this.paramsKey = null;
+            return false;
+        }
+
+        if (this.gl !== r.gl) this.ready = this.init();
+        if (!this.ready) return false;
+
+        // Parameters changing every frame (palette transitions) would only fill the atlas with tiles never reused
+        if (paramsKey !== this.paramsKey) {
+            this.paramsKey = paramsKey;
+            this.scheduleRefine();
+            return false;
+        }
+
+        const view = {
+            pan: [r.pan[0], r.pan[1]],
+            zoom: r.zoom,
+            rotation: r.rotation,
+            width: r.canvas.width,
+            height: r.canvas.height
+        };
+        const level = tileLevel(view.zoom, view.height);
+        const range = visibleTileRange(view, level);
+        if ((range.x1 - range.x0 + 1) * (range.y1 - range.y0 + 1) > this.lru.capacity / 2) return false;
+
+        profiler.begin('tiles');
+        const frame = ++this.frame;
+        const size = 2 ** -level;
+        const quads = [];
+        const misses = [];
+
+        for (let y = range.y0; y <= range.y1; y++) {
+            for (let x = range.x0; x <= range.x1; x++) {
+                const corners = [
+                    fractalToClip(view, x * size, y * size),
+                    fractalToClip(view, (x + 1) * size, y * size),
+                    fractalToClip(view, x * size, (y + 1) * size),
+                    fractalToClip(view, (x + 1) * size, (y + 1) * size)
+                ];
+                if (corners.every(c => c[0] < -1) || corners.every(c => c[0] > 1) ||
+                    corners.every(c => c[1] < -1) || corners.every(c => c[1] > 1)) continue;
+
+                const key = `${paramsKey}|${level}/${x}/${y}`;
+                const hit = this.lru.get(key, frame);
+                if (hit) {
+                    quads.push({corners, slot: hit.slot, sub: [0, 0, 1, 1]});
+                } else {
+                    const cx = (x + 0.5) * size - view.pan[0];
+                    const cy = (y + 0.5) * size - view.pan[1];
+                    misses.push({x, y, key, corners, distance: cx * cx + cy * cy});
+                }
+            }
+        }
+
+        // Render the misses nearest the centre first
+        misses.sort((a, b) => a.distance - b.distance);
+
+        let rendered = 0, fallbacks = 0, uncovered = 0;
+        for (const miss of misses) {
+            const persistKey = this.storedKeys && viewStateKey('tile', {key: miss.key});
+            const stored = persistKey && this.storedKeys.has(persistKey);
+            if (stored && !this.loading.has(miss.key)) this.loadTile(miss.key, persistKey);
+
+            const entry = !stored && rendered < TILE_RENDER_BUDGET ? this.lru.allocate(miss.key, frame) : null;
+            if (entry) {
+                this.renderTile(level, miss.x, miss.y, entry.slot, view.height);
+                quads.push({corners: miss.corners, slot: entry.slot, sub: [0, 0, 1, 1]});
+                if (persistKey) this.queuePersist(miss.key, persistKey, entry.slot);
+                rendered++;
+                continue;
+            }
+
+            const ancestor = this.findAncestor(paramsKey, level, miss.x, miss.y, frame);
+            if (ancestor) {
+                quads.push({corners: miss.corners, ...ancestor});
+                fallbacks++;
+            } else {
+                uncovered++;
+            }
+        }
+
+        const covered = uncovered === 0;
+        if (covered) this.drawQuads(quads, view);
+        r.bindFullscreenQuad();
+        if (fallbacks > 0 || uncovered > 0) this.scheduleRefine();
+
+        this.stats = {level, tiles: quads.length + uncovered, hits: quads.length - rendered - fallbacks, rendered, fallbacks};
+        profiler.end();
+        return covered;
+    }
+
+    /**
+     * Renders one tile with the renderer's kernel into an atlas slot. The tile is drawn as part of a virtual frame
+     * centred on the tile with the canvas height and the level's nominal view zoom, so zoom-relative details
+     * (critical line width) match what the view would show at that level.
+     * @param {number} level
+     * @param {number} x
+     * @param {number} y
+     * @param {number} slot
+     * @param {number} height Canvas height
+     */
+    renderTile(level, x, y, slot, height) {
+        const r = this.renderer;
+        const gl = this.gl;
+        const size = 2 ** -level;
+        const sx = (slot % this.slotsPerRow) * TILE_SIZE;
+        const sy = Math.floor(slot / this.slotsPerRow) * TILE_SIZE;
+
+        const pan = r.pan, zoom = r.zoom, rotation = r.rotation;
+        r.pan = [(x + 0.5) * size, (y + 0.5) * size];
+        r.zoom = size * height / TILE_SIZE;
+        r.rotation = 0;
+
+        gl.bindFramebuffer(gl.FRAMEBUFFER, this.framebuffer);
+        gl.enable(gl.SCISSOR_TEST);
+        gl.scissor(sx, sy, TILE_SIZE, TILE_SIZE);
+
+        // Scissored draw over the whole atlas; the fragment offset moves the slot onto the tile of the virtual frame
+        const inset = 0.5 * (height - TILE_SIZE);
+        r.tile = {
+            offsetX: inset - sx,
+            offsetY: inset - sy,
+            width: this.atlasSize,
+            height: this.atlasSize,
+            fullWidth: height,
+            fullHeight: height
+        };
+        try {
+            r.draw();
+        } finally {
+            r.tile = null;
+            r.pan = pan;
+            r.zoom = zoom;
+            r.rotation = rotation;
+            gl.disable(gl.SCISSOR_TEST);
+            gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+        }
+    }
+
+    /**
+     * Finds the nearest coarser cached tile containing a tile.
+     * @returns {{slot: number, sub: number[]}|null} Slot and the tile's part of it (u0, v0, u1, v1 in 0..1)
+     */
+    findAncestor(paramsKey, level, x, y, frame) {
+        for (let k = 1; k <= MAX_FALLBACK_LEVELS; k++) {
+            const n = 2 ** k;
+            const ax = Math.floor(x / n);
+            const ay = Math.floor(y / n);
+            const entry = this.lru.get(`${paramsKey}|${level - k}/${ax}/${ay}`, frame);
+            if (entry) {
+                const ix = x - ax * n;
+                const iy = y - ay * n;
+                return {slot: entry.slot, sub: [ix / n, iy / n, (ix + 1) / n, (iy + 1) / n]};
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Draws the tile quads (two triangles each) into the canvas.
+     * @param {Array<{corners: number[][], slot: number, sub: number[]}>} quads
+     * @param {{width: number, height: number}} view
+     */
+    drawQuads(quads, view) {
+        const gl = this.gl;
+        const data = new Float32Array(quads.length * 6 * VERTEX_STRIDE);
+        const texel = 1 / this.atlasSize;
+        const span = TILE_SIZE * texel;
+
+        let d = 0;
+        for (const {corners, slot, sub} of quads) {
+            const u = (slot % this.slotsPerRow) * span;
+            const v = Math.floor(slot / this.slotsPerRow) * span;
+            const bounds = [u + 0.5 * texel, v + 0.5 * texel, u + span - 0.5 * texel, v + span - 0.5 * texel];
+            const uv = [
+                [u + sub[0] * span, v + sub[1] * span], [u + sub[2] * span, v + sub[1] * span],
+                [u + sub[0] * span, v + sub[3] * span], [u + sub[2] * span, v + sub[3] * span]
+            ];
+
+            for (const i of [0, 1, 2, 2, 1, 3]) {
+                data[d++] = corners[i][0];
+                data[d++] = corners[i][1];
+                data[d++] = uv[i][0];
+                data[d++] = uv[i][1];
+                data[d++] = bounds[0];
+                data[d++] = bounds[1];
+                data[d++] = bounds[2];
+                data[d++] = bounds[3];
+            }
+        }
+
+        gl.viewport(0, 0, view.width, view.height);
+        gl.clearColor(0, 0, 0, 1);
+        gl.clear(gl.COLOR_BUFFER_BIT);
+
+        gl.useProgram(this.program);
+        gl.activeTexture(gl.TEXTURE0 + ATLAS_TEXTURE_UNIT);
+        gl.bindTexture(gl.TEXTURE_2D, this.atlas);
+        gl.uniform1i(this.atlasLoc, ATLAS_TEXTURE_UNIT);
+
+        const F = Float32Array.BYTES_PER_ELEMENT;
+        gl.bindBuffer(gl.ARRAY_BUFFER, this.vertexBuffer);
+        gl.bufferData(gl.ARRAY_BUFFER, data, gl.STREAM_DRAW);
+        this.pointer(this.attribs.a_position, 2, 0);
+        this.pointer(this.attribs.a_uv, 2, 2 * F);
+        this.pointer(this.attribs.a_bounds, 4, 4 * F);
+
+        gl.drawArrays(gl.TRIANGLES, 0, quads.length * 6);
+
+        for (const loc of Object.values(this.attribs)) {
+            if (loc >= 0) gl.disableVertexAttribArray(loc);
+        }
+        gl.activeTexture(gl.TEXTURE0);
+    }
+
+    /**
+     * Redraws once the view has been idle for a moment, so pending tiles get rendered even when nothing else is
+     * drawing. Every frame postpones it; while animating, the frames themselves fill the cache.
+     */
+    scheduleRefine() {
+        clearTimeout(this.refineRequest);
+        this.refineRequest = setTimeout(() => {
+            this.refineRequest = null;
+            if (this.renderer.gl) this.renderer.draw();
+        }, REFINE_DELAY);
+    }
+
+    // region > Persistence ------------------------------------------------------------------------------------------
+
+    /**
+     * Reads a persisted tile into a free slot; the view shows a coarser stand-in until it arrives.
+     * @param {string} key In-memory tile key
+     * @param {string} persistKey Key in the persistent cache
+     */
+    async loadTile(key, persistKey) {
+        const gl = this.gl;
+        this.loading.add(key);
+        const pixels = await cacheGet(persistKey);
+        if (!this.loading.delete(key) || gl !== this.gl || !this.ready) return;
+
+        // A tile that vanished in the meantime (evicted elsewhere) is rendered on the next frame instead
+        if (!pixels) {
+            this.storedKeys?.delete(persistKey);
+        } else if (!this.lru.get(key, this.frame)) {
+            const entry = this.lru.allocate(key, this.frame);
+            if (!entry) return;
+
+            gl.activeTexture(gl.TEXTURE0 + ATLAS_TEXTURE_UNIT);
+            gl.bindTexture(gl.TEXTURE_2D, this.atlas);
+            gl.texSubImage2D(gl.TEXTURE_2D, 0, (entry.slot % this.slotsPerRow) * TILE_SIZE,
+                Math.floor(entry.slot / this.slotsPerRow) * TILE_SIZE, TILE_SIZE, TILE_SIZE,
+                gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+            gl.activeTexture(gl.TEXTURE0);
+        }
+        this.scheduleRefine();
+    }
+
+    /**
+     * Queues a freshly rendered tile to be read back and persisted once the browser is idle.
+     * @param {string} key
+     * @param {string} persistKey
+     * @param {number} slot
+     */
+    queuePersist(key, persistKey, slot) {
+        this.persistQueue.push({key, persistKey, slot});
+        this.schedulePersist();
+    }
+
+    /** @private */
+    schedulePersist() {
+        if (this.persistRequest) return;
+
+        const idle = globalThis.requestIdleCallback ?? (callback => setTimeout(callback, 200));
+        this.persistRequest = idle(() => {
+            this.persistRequest = null;
+            this.persistTiles();
+        });
+    }
+
+    /** Reads back and stores a batch of queued tiles still held in the slots they were rendered to. */
+    persistTiles() {
+        const gl = this.gl;
+        if (!gl || !this.ready) return;
+
+        gl.bindFramebuffer(gl.FRAMEBUFFER, this.framebuffer);
+        for (let n = 0; n < PERSIST_BATCH && this.persistQueue.length > 0;) {
+            const {key, persistKey, slot} = this.persistQueue.shift();
+            if (this.lru.entries.get(key)?.slot !== slot) continue;
+
+            const pixels = new Uint8Array(TILE_SIZE * TILE_SIZE * 4);
+            gl.readPixels((slot % this.slotsPerRow) * TILE_SIZE, Math.floor(slot / this.slotsPerRow) * TILE_SIZE,
+                TILE_SIZE, TILE_SIZE, gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+            cachePut(persistKey, 'tile', pixels, pixels.byteLength);
+            n++;
+        }
+        gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+
+        if (this.persistQueue.length > 0) this.schedulePersist();
+    }
+
+    // endregion -------------------------------------------------------------------------------------------------------
+
+    destroy() {
+        clearTimeout(this.refineRequest);
+        this.refineRequest = null;
+        (globalThis.cancelIdleCallback ?? clearTimeout)(this.persistRequest);
+        this.persistRequest = null;
+        this.persistQueue = [];
+        this.loading.clear();
+        if (this.gl) this.releaseResources();
+        this.ready = false;
+        this.gl = null;
+    }
+
+    // region > Internals ----------------------------------------------------------------------------------------------
+
+    /** @private */
+    releaseResources() {
+        const gl = this.gl;
+        if (this.program) gl.deleteProgram(this.program);
+        if (this.atlas) gl.deleteTexture(this.atlas);
+        if (this.framebuffer) gl.deleteFramebuffer(this.framebuffer);
+        if (this.vertexBuffer) gl.deleteBuffer(this.vertexBuffer);
+        this.program = this.atlas = this.framebuffer = this.vertexBuffer = null;
+        this.lru = null;
+    }
+
+    /** @private */
+    createProgram() {
+        const gl = this.gl;
+        const compile = (source, type) => {
+            const shader = gl.createShader(type);
+            gl.shaderSource(shader, source);
+            gl.compileShader(shader);
+            if (!gl.getShaderParameter(shader, gl.COMPILE_STATUS)) {
+                console.error(gl.getShaderInfoLog(shader));
+                gl.deleteShader(shader);
+                return null;
+            }
+            return shader;
+        };
+
+        const vs = compile(composeVertexSource, gl.VERTEX_SHADER);
+        const fs = compile(composeFragmentSource, gl.FRAGMENT_SHADER);
+        if (!vs || !fs) return null;
+
+        const program = gl.createProgram();
+        gl.attachShader(program, vs);
+        gl.attachShader(program, fs);
+        gl.linkProgram(program);
+        gl.deleteShader(vs);
+        gl.deleteShader(fs);
+        if (!gl.getProgramParameter(program, gl.LINK_STATUS)) {
+            console.error(gl.getProgramInfoLog(program));
+            gl.deleteProgram(program);
+            return null;
+        }
+
+        for (const name of ['a_position', 'a_uv', 'a_bounds']) this.attribs[name] = gl.getAttribLocation(program, name);
+        this.atlasLoc = gl.getUniformLocation(program, 'u_atlas');
+        return program;
+    }
+
+    /** @private */
+    pointer(loc, size, offset) {
+        if (loc < 0) return;
+        this.gl.enableVertexAttribArray(loc);
+        this.gl.vertexAttribPointer(loc, size, this.gl.FLOAT, false, VERTEX_STRIDE * Float32Array.BYTES_PER_ELEMENT, offset);
+    }
+
+    // endregion--------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,18 @@
+/*
+ * CPU Frame Shader
+ * Draws a frame rendered by the CPU backend (cpuBackend.js), uploaded as an RGBA8 texture with top-down rows.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision mediump float;
+
+uniform sampler2D u_frame;
+uniform vec2 u_resolution;
+
+void main() {
+    vec2 uv = gl_FragCoord.xy / u_resolution;
+    gl_FragColor = vec4(texture2D(u_frame, vec2(uv.x, 1.0 - uv.y)).rgb, 1.0);
+}
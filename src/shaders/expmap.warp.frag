@@ -0,0 +1,53 @@
+/*
+ * Exponential Map Warp Shader
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @description
+ * Resamples one segment of the log-polar strip (mandelbrot.expmap.frag) back into a Cartesian video frame.
+ * Pixels whose strip column lies outside the segment, or inside the centre disc that is rendered directly, are
+ * discarded, so a frame is composed from one pass per visible segment plus the centre correction.
+ *
+ * @license   MIT
+ */
+
+precision highp float;
+
+uniform vec2 u_resolution;
+uniform vec2 u_fragOffset; // tile offset in pixels
+uniform float u_rotation;
+
+// strip column = u_colBase - ln(|st|) * u_colsPerLn
+uniform float u_colBase;
+uniform float u_colsPerLn;
+uniform float u_colMax;    // columns beyond this belong to the centre correction
+
+uniform float u_segStart;  // strip column of the segment's first texel edge
+uniform float u_segWidth;  // texels per segment row
+uniform sampler2D u_strip;
+
+void main() {
+    float aspect = u_resolution.x / u_resolution.y;
+
+    vec2 st = (gl_FragCoord.xy + u_fragOffset) / u_resolution;
+    st -= 0.5;
+    st.x *= aspect;
+
+    float cosR = cos(u_rotation);
+    float sinR = sin(u_rotation);
+    vec2 r = vec2(
+    st.x * cosR - st.y * sinR,
+    st.x * sinR + st.y * cosR
+    );
+
+    float len = length(r);
+    if (len <= 0.0) discard;
+
+    float col = u_colBase - log(len) * u_colsPerLn;
+    float local = col - u_segStart;
+    if (col > u_colMax || local < 0.5 || local >= u_segWidth - 0.5) discard;
+
+    // Rows wrap around the full turn (REPEAT)
+    float turn = atan(r.y, r.x) / 6.28318530718;
+    gl_FragColor = vec4(texture2D(u_strip, vec2(local / u_segWidth, turn)).rgb, 1.0);
+}
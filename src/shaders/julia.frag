@@ -15,15 +15,18 @@
 precision highp float;
 
 uniform vec2  u_resolution;
+uniform vec2  u_fragOffset; // poster tile offset in pixels (zero on screen)
 uniform float u_rotation;
 
 // delta z0 (pan - refZ0) computed on JS side for float64 precision
 uniform vec2  u_delta_z0_h;
 uniform vec2  u_delta_z0_l;
 
-// zoom hi/lo
+// zoom = (hi+lo) * 2^u_zoom_exp; below the float32 range the mantissa is in [1, 2) and deltaZ0 is
+// pre-scaled by 2^-u_zoom_exp, so deltas are iterated in that scale (see rescale())
 uniform float u_zoom_h;
 uniform float u_zoom_l;
+uniform float u_zoom_exp;
 
 // Julia constant
 uniform vec2  u_c;
@@ -127,6 +130,24 @@ vec3 getColorFromMap(float t) {
     }
 }
 
+// Power-of-two scaling, exact
+df df_scale(df a, float s) { return df_make(a.hi * s, a.lo * s); }
+df2 df2_scale(df2 a, float s) { return df2_make(df_scale(a.x, s), df_scale(a.y, s)); }
+
+// Scaled deltas (dz = dz' * 2^scaleExp) above this magnitude are folded back towards the true scale, which keeps dz'^2
+// finite and takes the deltas unscaled as soon as they fit float32
+const float RESCALE_LIMIT = 281474976710656.0; // 2^48
+
+void rescale(inout df2 dz, inout float scaleExp, inout float scale) {
+    float m = max(abs(dz.x.hi), abs(dz.y.hi));
+    if (m > RESCALE_LIMIT) {
+        float step = min(floor(log2(m)), -scaleExp);
+        dz = df2_scale(dz, exp2(-step));
+        scaleExp += step;
+        scale = exp2(scaleExp);
+    }
+}
+
 df2 sampleZRef(int n) {
     float x = (float(n) + 0.5) / u_orbitW;
     vec4 t = texture2D(u_orbitTex, vec2(x, 0.5));
@@ -136,7 +157,7 @@ df2 sampleZRef(int n) {
 void main() {
     float aspect = u_resolution.x / u_resolution.y;
 
-    vec2 st = gl_FragCoord.xy / u_resolution;
+    vec2 st = (gl_FragCoord.xy + u_fragOffset) / u_resolution;
     st -= 0.5;
     st.x *= aspect;
 
@@ -149,13 +170,13 @@ void main() {
 
     df zoom = df_make(u_zoom_h, u_zoom_l);
 
-    // deltaZ0 = pan - refZ0 (computed on JS side with float64 precision)
+    // deltaZ0 = pan - refZ0 (computed on JS side with float64 precision), scaled by 2^-u_zoom_exp
     df2 deltaZ0 = df2_make(
         df_make(u_delta_z0_h.x, u_delta_z0_l.x),
         df_make(u_delta_z0_h.y, u_delta_z0_l.y)
     );
 
-    // dz0 = deltaZ0 + zoom * r
+    // dz0 = deltaZ0 + zoom * r (both in the 2^u_zoom_exp scale)
     df2 dz = df2_add(
         deltaZ0,
         df2_make(df_mul_f(zoom, r.x), df_mul_f(zoom, r.y))
@@ -165,25 +186,32 @@ void main() {
     float zx = 0.0;
     float zy = 0.0;
 
+    // Scale of the deltas, dz = dz' * 2^scaleExp. The scale underflows to 0 below the float32 range, where the dz'^2 term
+    // is negligible next to 2*zref*dz' anyway
+    float scaleExp = u_zoom_exp;
+    float scale = exp2(scaleExp);
+
     for (int n = 0; n < MAX_ITER; n++) {
         float fn = float(n);
         if (fn >= u_iterations) { it = fn; break; }
 
         df2 zref = sampleZRef(n);
 
-        zx = df_to_float(zref.x) + df_to_float(dz.x);
-        zy = df_to_float(zref.y) + df_to_float(dz.y);
+        zx = df_to_float(zref.x) + df_to_float(dz.x) * scale;
+        zy = df_to_float(zref.y) + df_to_float(dz.y) * scale;
         if (zx*zx + zy*zy > 4.0) { it = fn; break; }
 
         // Correct Julia perturbation:
-        // dz_{n+1} = 2*zref*dz + dz^2   (NO +dc term)
+        // dz_{n+1} = 2*zref*dz + dz^2   (NO +dc term), scaled: dz'_{n+1} = 2*zref*dz' + 2^scaleExp*dz'^2
         df2 zref_dz = df2_mul(zref, dz);
         zref_dz.x = df_mul_f(zref_dz.x, 2.0);
         zref_dz.y = df_mul_f(zref_dz.y, 2.0);
 
         df2 dz2 = df2_sqr(dz);
+        if (scaleExp < 0.0) dz2 = df2_scale(dz2, scale);
 
         dz = df2_add(zref_dz, dz2);
+        if (scaleExp < 0.0) rescale(dz, scaleExp, scale);
 
         if (n == MAX_ITER - 1) it = u_iterations;
     }
@@ -17,6 +17,7 @@ precision mediump float;
 
 // Uniforms
 uniform vec2 u_resolution;// Canvas resolution in pixels
+uniform vec2 u_fragOffset;// Poster tile offset in pixels (zero on screen)
 uniform vec2 u_pan;// Pan offset in fractal space
 uniform float u_zoom;// Zoom factor
 uniform float u_iterations;// For normalizing the smooth iteration count
@@ -49,7 +50,7 @@ vec3 getColorFromMap(float t) {
 void main() {
     // Map fragment coordinates to normalized device coordinates
     float aspect = u_resolution.x / u_resolution.y;
-    vec2 st = gl_FragCoord.xy / u_resolution;
+    vec2 st = (gl_FragCoord.xy + u_fragOffset) / u_resolution;
     st -= 0.5;// center at (0,0)
     st.x *= aspect;// adjust x for aspect ratio
 
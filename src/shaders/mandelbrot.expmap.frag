@@ -0,0 +1,221 @@
+/*
+ * Mandelbrot Exponential Map Shader (Log-Polar Strip)
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @description
+ * Renders one segment of the exponential (log-polar) strip around the reference point for exp-map zoom videos.
+ * Columns run along the log-radius (fast axis, outermost first), rows along the angle, so texels are square in
+ * the complex plane at every depth. Same perturbation kernel and coloring as mandelbrot.frag; the iteration
+ * budget grows with depth the way MandelbrotRenderer.draw() grows it with zoom.
+ *
+ * @license   MIT
+ */
+
+precision highp float;
+
+// strip geometry
+uniform float u_colStart; // strip column of this segment's first texel
+uniform float u_lnRMax;   // log radius of column 0
+uniform float u_dLnR;     // log-radius step per column (= 2*pi / u_angles)
+uniform float u_angles;   // rows per full turn
+
+// iterations = u_iterBase - u_iterSlope * ln(radius)
+uniform float u_iterBase;
+uniform float u_iterSlope;
+
+// delta pan (viewPan - refPan) computed on JS side for float64 precision, scaled by 2^-u_delta_exp
+uniform vec2 u_delta_pan_h;
+uniform vec2 u_delta_pan_l;
+uniform float u_delta_exp;
+
+uniform vec3  u_colorPalette;
+uniform vec3  u_frequency;
+uniform vec3  u_phase;
+
+uniform sampler2D u_orbitTex;
+uniform float u_orbitW;
+
+const int MAX_ITER = __MAX_ITER__;
+
+// --- df helpers ---
+struct df  { float hi; float lo; };
+struct df2 { df x; df y; };
+
+df df_make(float hi, float lo){ df a; a.hi=hi; a.lo=lo; return a; }
+df df_from(float a){ return df_make(a, 0.0); }
+float df_to_float(df a){ return a.hi + a.lo; }
+
+df twoSum(float a, float b) {
+    float s  = a + b;
+    float bb = s - a;
+    float err = (a - (s - bb)) + (b - bb);
+    return df_make(s, err);
+}
+
+df quickTwoSum(float a, float b) {
+    float s = a + b;
+    float err = b - (s - a);
+    return df_make(s, err);
+}
+
+df df_add(df a, df b) {
+    df s = twoSum(a.hi, b.hi);
+    float t = a.lo + b.lo;
+    df u = twoSum(s.lo, t);
+    df v = twoSum(s.hi, u.hi);
+    float lo = u.lo + v.lo;
+    return quickTwoSum(v.hi, lo);
+}
+
+df df_sub(df a, df b) { return df_add(a, df_make(-b.hi, -b.lo)); }
+
+const float SPLIT = 4097.0;
+
+df twoProd(float a, float b) {
+    float p = a * b;
+
+    float aSplit = a * SPLIT;
+    float aHi = aSplit - (aSplit - a);
+    float aLo = a - aHi;
+
+    float bSplit = b * SPLIT;
+    float bHi = bSplit - (bSplit - b);
+    float bLo = b - bHi;
+
+    float err = ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+    return df_make(p, err);
+}
+
+df df_mul(df a, df b) {
+    df p = twoProd(a.hi, b.hi);
+    float err = a.hi * b.lo + a.lo * b.hi + a.lo * b.lo;
+    df s = twoSum(p.lo, err);
+    df r = twoSum(p.hi, s.hi);
+    float lo = s.lo + r.lo;
+    return quickTwoSum(r.hi, lo);
+}
+
+df df_mul_f(df a, float b) { return df_mul(a, df_from(b)); }
+
+df2 df2_make(df x, df y){ df2 r; r.x=x; r.y=y; return r; }
+df2 df2_add(df2 a, df2 b){ return df2_make(df_add(a.x, b.x), df_add(a.y, b.y)); }
+
+df2 df2_mul(df2 a, df2 b){
+    // (ax + i ay)(bx + i by) = (axbx - ayby) + i(axby + aybx)
+    df axbx = df_mul(a.x, b.x);
+    df ayby = df_mul(a.y, b.y);
+    df axby = df_mul(a.x, b.y);
+    df aybx = df_mul(a.y, b.x);
+    return df2_make(df_sub(axbx, ayby), df_add(axby, aybx));
+}
+
+df2 df2_sqr(df2 a){
+    df xx = df_mul(a.x, a.x);
+    df yy = df_mul(a.y, a.y);
+    df xy = df_mul(a.x, a.y);
+    return df2_make(df_sub(xx, yy), df_mul_f(xy, 2.0));
+}
+
+// Power-of-two scaling, exact
+df df_scale(df a, float s) { return df_make(a.hi * s, a.lo * s); }
+df2 df2_scale(df2 a, float s) { return df2_make(df_scale(a.x, s), df_scale(a.y, s)); }
+
+// Radii below 2^-40 (ZOOM_EXPONENT_THRESHOLD in utils.js) are iterated as mantissa and exponent, as in mandelbrot.frag
+const float SCALED_LN_RADIUS = -27.7258872; // ln(2^-40)
+const float LN2 = 0.69314718056;
+
+// Scaled deltas (dz = dz' * 2^scaleExp) above this magnitude are folded back towards the true scale, which keeps dz'^2
+// finite and takes the deltas unscaled as soon as they fit float32
+const float RESCALE_LIMIT = 281474976710656.0; // 2^48
+
+void rescale(inout df2 dz, inout df2 dc, inout float scaleExp, inout float scale) {
+    float m = max(abs(dz.x.hi), abs(dz.y.hi));
+    if (m > RESCALE_LIMIT) {
+        float step = min(floor(log2(m)), -scaleExp);
+        float down = exp2(-step);
+        dz = df2_scale(dz, down);
+        dc = df2_scale(dc, down);
+        scaleExp += step;
+        scale = exp2(scaleExp);
+    }
+}
+
+df2 sampleZRef(int n){
+    float x = (float(n) + 0.5) / u_orbitW;
+    vec4 t = texture2D(u_orbitTex, vec2(x, 0.5));
+    return df2_make(df_make(t.r, t.g), df_make(t.b, t.a));
+}
+
+void main() {
+    float col = gl_FragCoord.x + u_colStart;
+    float theta = 6.28318530718 * gl_FragCoord.y / u_angles;
+    float lnR = u_lnRMax - col * u_dLnR;
+
+    // radius = exp(lnR) = mantissa * 2^scaleExp, so deep columns do not underflow float32
+    float scaleExp = lnR < SCALED_LN_RADIUS ? floor(lnR / LN2) : 0.0;
+    float scale = exp2(scaleExp);
+    float radius = exp(lnR - scaleExp * LN2);
+
+    float iterations = clamp(floor(u_iterBase - u_iterSlope * lnR), 50.0, float(MAX_ITER));
+
+    // deltaPan = viewPan - refPan (computed on JS side with float64 precision), taken to this column's scale
+    df2 deltaPan = df2_make(
+        df_make(u_delta_pan_h.x, u_delta_pan_l.x),
+        df_make(u_delta_pan_h.y, u_delta_pan_l.y)
+    );
+    deltaPan = df2_scale(deltaPan, exp2(u_delta_exp - scaleExp));
+
+    // dc = deltaPan + radius * e^(i theta) (both in the 2^scaleExp scale)
+    df2 dc = df2_make(df_from(radius * cos(theta)), df_from(radius * sin(theta)));
+    dc = df2_add(dc, deltaPan);
+
+    df2 dz = df2_make(df_from(0.0), df_from(0.0));
+
+    float it = 0.0;
+    float zx = 0.0;
+    float zy = 0.0;
+
+    for (int n = 0; n < MAX_ITER; n++) {
+        float fn = float(n);
+        if (fn >= iterations) { it = fn; break; }
+
+        df2 zref = sampleZRef(n);
+
+        // bailout approx using float
+        zx = df_to_float(zref.x) + df_to_float(dz.x) * scale;
+        zy = df_to_float(zref.y) + df_to_float(dz.y) * scale;
+        if (zx*zx + zy*zy > 4.0) { it = fn; break; }
+
+        // dz_{n+1} = 2*zref*dz + dz^2 + dc, in the scaled form dz'_{n+1} = 2*zref*dz' + 2^scaleExp*dz'^2 + dc'
+        df2 zref_dz = df2_mul(zref, dz);
+        zref_dz.x = df_mul_f(zref_dz.x, 2.0);
+        zref_dz.y = df_mul_f(zref_dz.y, 2.0);
+
+        df2 dz2 = df2_sqr(dz);
+        if (scaleExp < 0.0) dz2 = df2_scale(dz2, scale);
+
+        dz = df2_add(df2_add(zref_dz, dz2), dc);
+        if (scaleExp < 0.0) rescale(dz, dc, scaleExp, scale);
+
+        if (n == MAX_ITER - 1) it = iterations;
+    }
+
+    if (it >= iterations) {
+        gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+    } else {
+        // Smooth coloring using |z|² for crisp edge detail
+        float r2 = max(zx*zx + zy*zy, 1e-30);
+        float smoothIt = it - log2(log2(r2));
+
+        // Sine-based coloring with configurable frequency and phase
+        float t = smoothIt / 100.0;
+        vec3 fractalColor = vec3(
+            sin(t * u_frequency.r + u_phase.r),
+            sin(t * u_frequency.g + u_phase.g),
+            sin(t * u_frequency.b + u_phase.b)
+        ) * u_colorPalette;
+
+        gl_FragColor = vec4(fractalColor, 1.0);
+    }
+}
@@ -0,0 +1,19 @@
+/*
+ * Overlay Glyph Fragment Shader
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision mediump float;
+
+uniform sampler2D u_atlas;
+
+varying vec2 v_uv;
+varying vec4 v_color;
+
+void main() {
+    float a = texture2D(u_atlas, v_uv).a;
+    gl_FragColor = vec4(v_color.rgb, v_color.a * a);
+}
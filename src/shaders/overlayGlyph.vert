@@ -0,0 +1,63 @@
+/*
+ * Overlay Glyph Vertex Shader
+ * Places glyph quads from the overlay atlas. Anchors are in fractal space (relative to the batch origin)
+ * or in CSS pixels from the bottom-left corner; offsets are CSS pixels, y pointing down like a 2D canvas.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision highp float;
+
+attribute vec2 a_anchor;
+attribute vec2 a_offset;
+attribute vec2 a_uv;
+attribute vec4 a_color;
+attribute vec4 a_flags;    // x: screen-space anchor, y: clamp X padding, z: clamp Y padding, w: cull margin
+
+uniform vec2 u_resolution;
+uniform vec2 u_offset;     // batch origin - pan
+uniform float u_zoom;
+uniform float u_rotation;
+uniform float u_pixelRatio;
+
+varying vec2 v_uv;
+varying vec4 v_color;
+
+vec2 toScreen(vec2 p) {
+    vec2 d = (p + u_offset) / u_zoom;
+    float c = cos(u_rotation);
+    float s = sin(u_rotation);
+    vec2 st = vec2(c * d.x + s * d.y, -s * d.x + c * d.y);
+    return st * u_resolution.y + 0.5 * u_resolution;
+}
+
+void main() {
+    vec2 anchor = a_flags.x > 0.5 ? a_anchor * u_pixelRatio : toScreen(a_anchor);
+
+    // Keep axis labels on screen when their axis scrolls out of view
+    if (a_flags.y > 0.0) {
+        float pad = a_flags.y * u_pixelRatio;
+        anchor.x = clamp(anchor.x, pad, u_resolution.x - pad);
+    }
+    if (a_flags.z > 0.0) {
+        float pad = a_flags.z * u_pixelRatio;
+        anchor.y = clamp(anchor.y, pad, u_resolution.y - pad);
+    }
+
+    // Collapse labels whose anchor is too close to the edge
+    if (a_flags.w > 0.0) {
+        float m = a_flags.w * u_pixelRatio;
+        if (anchor.x < m || anchor.x > u_resolution.x - m || anchor.y < m || anchor.y > u_resolution.y - m) {
+            gl_Position = vec4(2.0, 2.0, 0.0, 1.0);
+            return;
+        }
+    }
+
+    vec2 p = anchor + vec2(a_offset.x, -a_offset.y) * u_pixelRatio;
+
+    gl_Position = vec4(p / u_resolution * 2.0 - 1.0, 0.0, 1.0);
+    v_uv = a_uv;
+    v_color = a_color;
+}
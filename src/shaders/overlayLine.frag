@@ -0,0 +1,15 @@
+/*
+ * Overlay Line Fragment Shader
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision mediump float;
+
+varying vec4 v_color;
+
+void main() {
+    gl_FragColor = v_color;
+}
@@ -0,0 +1,45 @@
+/*
+ * Overlay Line Vertex Shader
+ * Expands one line segment (given in fractal space, relative to the batch origin) into a screen-space quad.
+ * Used instanced (ANGLE_instanced_arrays) or with per-vertex expanded data as a fallback.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision highp float;
+
+attribute vec2 a_corner;   // x: 0..1 along the segment, y: -1..1 across
+attribute vec4 a_segment;  // p0.xy, p1.xy relative to the batch origin
+attribute vec4 a_color;
+attribute float a_width;   // CSS pixels
+
+uniform vec2 u_resolution;
+uniform vec2 u_offset;     // batch origin - pan
+uniform float u_zoom;
+uniform float u_rotation;
+uniform float u_pixelRatio;
+
+varying vec4 v_color;
+
+vec2 toScreen(vec2 p) {
+    vec2 d = (p + u_offset) / u_zoom;
+    float c = cos(u_rotation);
+    float s = sin(u_rotation);
+    vec2 st = vec2(c * d.x + s * d.y, -s * d.x + c * d.y);
+    return st * u_resolution.y + 0.5 * u_resolution;
+}
+
+void main() {
+    vec2 s0 = toScreen(a_segment.xy);
+    vec2 s1 = toScreen(a_segment.zw);
+    vec2 dir = s1 - s0;
+    float len = length(dir);
+    vec2 normal = len > 0.0 ? vec2(-dir.y, dir.x) / len : vec2(0.0, 1.0);
+
+    vec2 p = mix(s0, s1, a_corner.x) + normal * (a_corner.y * 0.5 * a_width * u_pixelRatio);
+
+    gl_Position = vec4(p / u_resolution * 2.0 - 1.0, 0.0, 1.0);
+    v_color = a_color;
+}
@@ -5,6 +5,7 @@
 precision highp float;
 
 uniform vec2 u_resolution;
+uniform vec2 u_fragOffset; // poster tile offset in pixels (zero on screen)
 uniform float u_zoom;
 uniform vec2 u_pan;
 uniform float u_rotation;
@@ -267,7 +268,7 @@ vec3 hsl2rgb(vec3 hsl) {
 // ─────────────────────────────────────────────────────────────────────────────
 
 void main() {
-    vec2 uv = (gl_FragCoord.xy - 0.5 * u_resolution) / u_resolution.y;
+    vec2 uv = (gl_FragCoord.xy + u_fragOffset - 0.5 * u_resolution) / u_resolution.y;
 
     float cosR = cos(u_rotation);
     float sinR = sin(u_rotation);
@@ -1,6 +1,7 @@
 precision highp float;
 
 uniform vec2 u_resolution;
+uniform vec2 u_fragOffset; // poster tile offset in pixels (zero on screen)
 uniform float u_zoom;
 uniform vec2 u_pan;
 uniform int u_termCount;
@@ -59,7 +60,7 @@ vec2 analyticZeta(vec2 s) {
 
 void main() {
     // Map pixel coordinates to the fractal plane.
-    vec2 uv = (gl_FragCoord.xy - 0.5 * u_resolution) / u_resolution.y;
+    vec2 uv = (gl_FragCoord.xy + u_fragOffset - 0.5 * u_resolution) / u_resolution.y;
     vec2 coord = uv * u_zoom + u_pan;
 
     vec2 z;
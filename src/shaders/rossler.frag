@@ -4,6 +4,7 @@ precision mediump float;
 
 // Uniforms:
 uniform vec2 u_resolution;// Canvas resolution in pixels.
+uniform vec2 u_fragOffset;// Poster tile offset in pixels (zero on screen).
 uniform vec2 u_pan;// Pan offset in attractor space.
 uniform float u_zoom;// Zoom factor.
 uniform float u_rotation;// Rotation angle in radians.
@@ -55,7 +56,7 @@ float distToSegment(vec2 p, vec2 a, vec2 b) {
 void main() {
     // Map fragment coordinates to normalized space.
     float aspect = u_resolution.x / u_resolution.y;
-    vec2 uv = gl_FragCoord.xy / u_resolution;
+    vec2 uv = (gl_FragCoord.xy + u_fragOffset) / u_resolution;
     uv -= 0.5;
     uv.x *= aspect;
 
@@ -0,0 +1,20 @@
+/*
+ * Tile Compose Fragment Shader
+ * Samples a tile from the cache atlas. Coordinates are clamped to the tile's own slot so linear filtering never
+ * bleeds in the neighbouring tiles of the atlas.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision highp float;
+
+uniform sampler2D u_atlas;
+
+varying vec2 v_uv;
+varying vec4 v_bounds;
+
+void main() {
+    gl_FragColor = vec4(texture2D(u_atlas, clamp(v_uv, v_bounds.xy, v_bounds.zw)).rgb, 1.0);
+}
@@ -0,0 +1,24 @@
+/*
+ * Tile Compose Vertex Shader
+ * Places one cached tile (or the part of a coarser ancestor standing in for it) on screen. Corners arrive in clip
+ * space, already transformed from fractal space on the CPU in float64.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+precision highp float;
+
+attribute vec2 a_position; // clip space
+attribute vec2 a_uv;       // atlas coordinates
+attribute vec4 a_bounds;   // atlas slot, inset by half a texel (min.xy, max.xy)
+
+varying vec2 v_uv;
+varying vec4 v_bounds;
+
+void main() {
+    v_uv = a_uv;
+    v_bounds = a_bounds;
+    gl_Position = vec4(a_position, 0.0, 1.0);
+}
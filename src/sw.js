@@ -0,0 +1,140 @@
+/**
+ * @module ServiceWorker
+ * @author Radim Brnka
+ * @description Service worker template, completed by the webpack build (src/config/serviceWorkerPlugin.js), which
+ * fills in the precache manifest and cache version placeholders below. Not part of the bundle.
+ *
+ * - Precached (cache-first): the hashed entry bundle and CSS, images and the web manifest, fetched on install.
+ * - Runtime cache-first: mode chunks (hashed, loaded on demand) once first fetched.
+ * - Stale-while-revalidate: the page itself, the tour audio and web fonts; served from the cache when present and
+ *   refreshed in the background, so a new deployment is picked up on the following start.
+ *
+ * Old caches are dropped on activation, so every build keeps exactly one set.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+const PRECACHE_MANIFEST = __PRECACHE_MANIFEST__;
+const CACHE_VERSION = __CACHE_VERSION__;
+
+const CACHE_PREFIX = 'fractal-traveler-';
+const PRECACHE = `${CACHE_PREFIX}precache-${CACHE_VERSION}`;
+const RUNTIME_CACHE = `${CACHE_PREFIX}runtime-${CACHE_VERSION}`;
+
+/** Same-origin paths of on-demand chunks (hashed file names, so never stale) */
+const CHUNK_PATH = /\/js\/[^/]+\.js$/;
+/** Same-origin paths served stale-while-revalidate besides the page (the tour audio is not hashed) */
+const REVALIDATED_PATH = /\/audio\/[^/]+$/;
+/** Cross-origin hosts served stale-while-revalidate (web fonts) */
+const REVALIDATED_HOSTS = ['fonts.googleapis.com', 'fonts.gstatic.com'];
+
+const scopeUrl = new URL(self.registration.scope);
+const precached = new Set(PRECACHE_MANIFEST.map(path => new URL(path, scopeUrl).href));
+const pagePaths = [scopeUrl.pathname, `${scopeUrl.pathname}index.html`];
+
+self.addEventListener('install', (event) => {
+    event.waitUntil(
+        caches.open(PRECACHE)
+            .then(cache => cache.addAll([...precached]))
+            .then(() => self.skipWaiting())
+    );
+});
+
+self.addEventListener('activate', (event) => {
+    event.waitUntil(
+        caches.keys()
+            .then(keys => Promise.all(keys
+                .filter(key => key.startsWith(CACHE_PREFIX) && key !== PRECACHE && key !== RUNTIME_CACHE)
+                .map(key => caches.delete(key))))
+            .then(() => self.clients.claim())
+    );
+});
+
+self.addEventListener('fetch', (event) => {
+    const request = event.request;
+    if (request.method !== 'GET') return;
+
+    const url = new URL(request.url);
+    url.hash = '';
+    const sameOrigin = url.origin === scopeUrl.origin;
+
+    if (sameOrigin && precached.has(url.href)) {
+        event.respondWith(cacheFirst(PRECACHE, url.href, request));
+    } else if (sameOrigin && pagePaths.includes(url.pathname)) {
+        // One entry for the page, whatever query or path variant it was opened with
+        event.respondWith(staleWhileRevalidate(scopeUrl.href, request, event));
+    } else if (sameOrigin && REVALIDATED_PATH.test(url.pathname)) {
+        event.respondWith(staleWhileRevalidate(url.href, request, event));
+    } else if (sameOrigin && CHUNK_PATH.test(url.pathname)) {
+        event.respondWith(cacheFirst(RUNTIME_CACHE, url.href, request));
+    } else if (REVALIDATED_HOSTS.includes(url.hostname)) {
+        event.respondWith(staleWhileRevalidate(url.href, request, event));
+    }
+});
+
+// region > STRATEGIES -------------------------------------------------------------------------------------------------
+
+/**
+ * Serves from the cache, falling back to (and storing) the network response.
+ * @param {string} cacheName
+ * @param {string} key
+ * @param {Request} request
+ * @returns {Promise<Response>}
+ */
+async function cacheFirst(cacheName, key, request) {
+    const cache = await caches.open(cacheName);
+    const cached = await cache.match(key);
+    if (cached) return withRange(cached, request);
+
+    const response = await fetch(request.headers.has('range') ? key : request);
+    if (response.ok) await cache.put(key, response.clone());
+    return withRange(response, request);
+}
+
+/**
+ * Serves the cached response right away (if any) and refreshes it from the network in the background.
+ * @param {string} key
+ * @param {Request} request
+ * @param {FetchEvent} event
+ * @returns {Promise<Response>}
+ */
+async function staleWhileRevalidate(key, request, event) {
+    const cache = await caches.open(RUNTIME_CACHE);
+    const cached = await cache.match(key);
+
+    // Range requests (media) are refreshed with a full request, so the cache always holds the whole file
+    const refresh = fetch(request.headers.has('range') ? key : request)
+        .then(async response => {
+            if (response.ok || response.type === 'opaque') await cache.put(key, response.clone());
+            return response;
+        });
+    event.waitUntil(refresh.catch(() => undefined));
+
+    if (cached) return withRange(cached, request);
+    return withRange(await refresh, request);
+}
+
+/**
+ * Answers a range request from a full response (media elements seek with range requests).
+ * @param {Response} response
+ * @param {Request} request
+ * @returns {Promise<Response>}
+ */
+async function withRange(response, request) {
+    const range = /^bytes=(\d*)-(\d*)$/.exec(request.headers.get('range') || '');
+    if (!range || response.status !== 200) return response;
+
+    const blob = await response.blob();
+    const start = range[1] ? Number(range[1]) : Math.max(0, blob.size - Number(range[2]));
+    const end = range[1] && range[2] ? Math.min(Number(range[2]), blob.size - 1) : blob.size - 1;
+    if (start >= blob.size || start > end) {
+        return new Response(null, {status: 416, headers: {'Content-Range': `bytes */${blob.size}`}});
+    }
+
+    const headers = new Headers(response.headers);
+    headers.set('Content-Range', `bytes ${start}-${end}/${blob.size}`);
+    headers.set('Content-Length', String(end - start + 1));
+    return new Response(blob.slice(start, end + 1), {status: 206, statusText: 'Partial Content', headers});
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
@@ -0,0 +1,93 @@
+// __tests__/cpuBackend.test.js
+import {CpuBackend} from '../renderers/cpuBackend';
+import {computeOrbit, CPU_KERNEL, PASS_STEPS, renderTile} from '../renderers/cpuKernel';
+
+const frame = (overrides = {}) => ({
+    kernel: CPU_KERNEL.MANDELBROT,
+    width: 150, height: 70,
+    refX: -0.75, refY: 0.1, deltaX: 0, deltaY: 0,
+    zoom: 0.5, rotation: 0.3, iterations: 200,
+    colorPalette: [1, 0.8, 0.6], frequency: [3, 5, 7], phase: [0, 1, 2],
+    ...overrides,
+});
+
+/** Headless owner: no GL and no 2D context, so frames stay in the framebuffer */
+const createBackend = () => new CpuBackend({canvas: {getContext: () => null}, gl: null});
+
+describe('CpuBackend', () => {
+    test('renders a frame on the main thread when workers are unavailable', async () => {
+        const backend = createBackend();
+        expect(backend.workerCount).toBe(0);
+
+        const f = frame();
+        await expect(backend.render(f)).resolves.toBe(true);
+
+        const orbit = new Float64Array(2 * (f.iterations + 1));
+        const length = computeOrbit(f, orbit);
+        const expected = {data: new Uint8Array(f.width * f.height * 4), stride: f.width, originX: 0, originY: 0};
+        for (const step of PASS_STEPS) renderTile(f, orbit, length, {x: 0, y: 0, width: f.width, height: f.height}, step, expected);
+
+        expect(backend.pixels).toEqual(expected.data);
+        backend.destroy();
+    });
+
+    test('splits the frame into tiles covering it once, centre first', () => {
+        const backend = createBackend();
+        backend.allocate(150, 70);
+
+        const covered = new Uint8Array(150 * 70);
+        for (const tile of backend.tiles) {
+            for (let y = tile.y; y < tile.y + tile.height; y++) {
+                for (let x = tile.x; x < tile.x + tile.width; x++) covered[y * 150 + x]++;
+            }
+        }
+        expect(covered.every(n => n === 1)).toBe(true);
+        expect(backend.tiles[0]).toEqual({x: 64, y: 0, width: 64, height: 64});
+        backend.destroy();
+    });
+
+    test('a new frame supersedes the one in progress', async () => {
+        const backend = createBackend();
+        const first = backend.render(frame());
+        const second = backend.render(frame({zoom: 0.25}));
+
+        // The same frame again is not restarted
+        expect(backend.render(frame({zoom: 0.25}))).toBe(second);
+        await expect(first).resolves.toBe(false);
+        await expect(second).resolves.toBe(true);
+        backend.destroy();
+    });
+
+    test('with a shared framebuffer, a new frame waits for tiles of the old one still being rendered', async () => {
+        const backend = createBackend();
+        const posted = [];
+        const worker = () => ({postMessage: (message) => posted.push(message), terminate: () => {}});
+        const workers = [worker(), worker()];
+        backend.workers = [...workers];
+        backend.idle = [...workers];
+        backend.sharedMemory = true;
+        const tilesOf = (generation) => posted.filter(m => m.type === 'tile' && m.generation === generation);
+
+        backend.render(frame());
+        await backend.ready;
+        expect(tilesOf(1)).toHaveLength(2);
+
+        backend.render(frame({zoom: 0.25}));
+        await backend.ready;
+        expect(tilesOf(2)).toHaveLength(0);
+
+        const [first, second] = tilesOf(1);
+        backend.onWorkerMessage(workers[1], {generation: 1, tile: first.tile, step: first.step, pixels: null});
+        expect(tilesOf(2)).toHaveLength(0);
+        backend.onWorkerMessage(workers[0], {generation: 1, tile: second.tile, step: second.step, pixels: null});
+        expect(tilesOf(2)).toHaveLength(2);
+        backend.destroy();
+    });
+
+    test('destroy settles the pending frame', async () => {
+        const backend = createBackend();
+        const pending = backend.render(frame());
+        backend.destroy();
+        await expect(pending).resolves.toBe(false);
+    });
+});
@@ -0,0 +1,137 @@
+// __tests__/cpuKernel.test.js
+import {computeOrbit, CPU_KERNEL, getEscapeR2, iteratePixel, PASS_STEPS, renderTile, shadePixel} from '../renderers/cpuKernel';
+
+/** Plain float64 escape count for comparison */
+const escapeCount = (zx, zy, cx, cy, iterations) => {
+    for (let n = 0; n < iterations; n++) {
+        if (zx * zx + zy * zy > 4) return n;
+        const t = zx * zx - zy * zy + cx;
+        zy = 2 * zx * zy + cy;
+        zx = t;
+    }
+    return iterations;
+};
+
+const mandelbrotFrame = (overrides = {}) => ({
+    kernel: CPU_KERNEL.MANDELBROT,
+    width: 40, height: 30,
+    refX: -0.75, refY: 0.1, deltaX: 0, deltaY: 0,
+    zoom: 0.05, rotation: 0, iterations: 300,
+    colorPalette: [1, 0.8, 0.6], frequency: [3, 5, 7], phase: [0, 1, 2],
+    ...overrides,
+});
+
+const orbitFor = (frame) => {
+    const orbit = new Float64Array(2 * (frame.iterations + 1));
+    return {orbit, length: computeOrbit(frame, orbit)};
+};
+
+describe('CpuKernel', () => {
+    test('builds the reference orbit up to the first escaped point', () => {
+        // c = -1 cycles 0, -1, 0, -1 ... and never escapes
+        const bounded = orbitFor(mandelbrotFrame({refX: -1, refY: 0, iterations: 10}));
+        expect(bounded.length).toBe(11);
+        expect(Array.from(bounded.orbit.slice(0, 6))).toEqual([0, 0, -1, 0, 0, 0]);
+
+        // c = 1: 0, 1, 2, 5 escapes at the fourth point
+        const escaping = orbitFor(mandelbrotFrame({refX: 1, refY: 0, iterations: 10}));
+        expect(escaping.length).toBe(4);
+        expect(escaping.orbit[6]).toBe(5);
+    });
+
+    test('matches plain iteration around the reference', () => {
+        const frame = mandelbrotFrame();
+        const {orbit, length} = orbitFor(frame);
+        let same = 0, total = 0;
+        for (let i = -10; i <= 10; i++) {
+            for (let j = -10; j <= 10; j++) {
+                const dx = i * 0.003, dy = j * 0.003;
+                const expected = escapeCount(0, 0, frame.refX + dx, frame.refY + dy, frame.iterations);
+                const it = iteratePixel(frame, orbit, length, dx, dy);
+                expect(Math.abs(it - expected)).toBeLessThanOrEqual(1);
+                if (it === expected) same++;
+                total++;
+            }
+        }
+        // Rounding differs only on the odd pixel sitting right at an escape boundary
+        expect(same / total).toBeGreaterThan(0.97);
+    });
+
+    test('rebases pixels whose reference escapes first', () => {
+        // The reference c = 0.5 escapes after a few steps; c = -0.25 is interior and needs rebasing to stay bounded
+        const frame = mandelbrotFrame({refX: 0.5, refY: 0, iterations: 500});
+        const {orbit, length} = orbitFor(frame);
+        expect(length).toBeLessThan(10);
+        expect(iteratePixel(frame, orbit, length, -0.75, 0)).toBe(500);
+        expect(iteratePixel(frame, orbit, length, 0.1, 0.9)).toBe(escapeCount(0, 0, 0.6, 0.9, 500));
+    });
+
+    test('iterates Julia deltas around z0 with the frame constant', () => {
+        const frame = {...mandelbrotFrame(), kernel: CPU_KERNEL.JULIA, refX: 0.1, refY: -0.2, c: [-0.8, 0.156]};
+        const {orbit, length} = orbitFor(frame);
+        for (const [dx, dy] of [[0, 0], [0.3, 0.1], [-0.5, 0.4], [1.2, -0.7]]) {
+            expect(iteratePixel(frame, orbit, length, dx, dy))
+                .toBe(escapeCount(0.1 + dx, -0.2 + dy, -0.8, 0.156, frame.iterations));
+        }
+    });
+
+    test('shades with the shader colouring formulas', () => {
+        const out = new Uint8Array(4);
+        const frame = mandelbrotFrame();
+
+        shadePixel(frame, frame.iterations, 0, out, 0);
+        expect(Array.from(out)).toEqual([0, 0, 0, 255]);
+
+        shadePixel(frame, 42, 16, out, 0);
+        const t = (42 - Math.log2(Math.log2(16))) / 100;
+        const expected = [0, 1, 2].map(ch =>
+            Math.round(Math.min(Math.max(Math.sin(t * frame.frequency[ch] + frame.phase[ch]) * frame.colorPalette[ch], 0), 1) * 255));
+        expect(Array.from(out.slice(0, 3))).toEqual(expected);
+
+        // Julia stop map: t = 0.5 lands exactly on the third stop
+        const julia = {...frame, kernel: CPU_KERNEL.JULIA, innerStops: [0, 0, 0, 0.1, 0.1, 0.1, 0.2, 0.4, 0.6, 1, 1, 1, 1, 1, 1]};
+        shadePixel(julia, 0, 2, out, 0);
+        expect(Array.from(out.slice(0, 3))).toEqual([51, 102, 153]);
+    });
+
+    test('progressive passes end with every pixel rendered at full resolution', () => {
+        const frame = mandelbrotFrame({width: 37, height: 21});
+        const {orbit, length} = orbitFor(frame);
+        const tiles = [{x: 0, y: 0, width: 32, height: 21}, {x: 32, y: 0, width: 5, height: 21}];
+
+        const progressive = {data: new Uint8Array(37 * 21 * 4), stride: 37, originX: 0, originY: 0};
+        for (const step of PASS_STEPS) {
+            for (const tile of tiles) renderTile(frame, orbit, length, tile, step, progressive);
+        }
+
+        // Every pixel rendered directly
+        const direct = new Uint8Array(37 * 21 * 4);
+        for (let py = 0; py < 21; py++) {
+            for (let px = 0; px < 37; px++) {
+                const sx = (px + 0.5 - 37 / 2) / 21;
+                const sy = (21 / 2 - py - 0.5) / 21;
+                const it = iteratePixel(frame, orbit, length, frame.zoom * sx, frame.zoom * sy);
+                shadePixel(frame, it, getEscapeR2(), direct, (py * 37 + px) * 4);
+            }
+        }
+        expect(progressive.data).toEqual(direct);
+    });
+
+    test('renders tiles into tile-local buffers', () => {
+        const frame = mandelbrotFrame();
+        const {orbit, length} = orbitFor(frame);
+        const tile = {x: 8, y: 16, width: 16, height: 8};
+
+        const full = {data: new Uint8Array(40 * 30 * 4), stride: 40, originX: 0, originY: 0};
+        const local = {data: new Uint8Array(16 * 8 * 4), stride: 16, originX: 8, originY: 16};
+        for (const step of PASS_STEPS) {
+            renderTile(frame, orbit, length, tile, step, full);
+            renderTile(frame, orbit, length, tile, step, local);
+        }
+
+        for (let row = 0; row < 8; row++) {
+            const from = ((16 + row) * 40 + 8) * 4;
+            expect(local.data.slice(row * 64, (row + 1) * 64)).toEqual(full.data.slice(from, from + 64));
+        }
+    });
+});
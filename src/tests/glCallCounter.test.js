@@ -0,0 +1,68 @@
+// __tests__/glCallCounter.test.js
+import {createCountingContext, getGLCallStats, unwrapGL} from '../renderers/glCallCounter';
+
+function createGL() {
+    return {
+        TEXTURE0: 0x84C0,
+        TEXTURE_2D: 0x0DE1,
+        RGBA: 0x1908,
+        FLOAT: 0x1406,
+        useProgram: jest.fn(),
+        getUniformLocation: jest.fn((program, name) => ({name})),
+        uniform1f: jest.fn(),
+        uniform3fv: jest.fn(),
+        activeTexture: jest.fn(),
+        bindTexture: jest.fn(),
+        texImage2D: jest.fn(),
+        drawArrays: jest.fn(),
+    };
+}
+
+describe('GL call counting context', () => {
+    test('forwards calls to the real context and counts them per frame', () => {
+        const raw = createGL();
+        const gl = createCountingContext(raw);
+        const stats = getGLCallStats(gl);
+
+        expect(gl.TEXTURE_2D).toBe(raw.TEXTURE_2D);
+        expect(unwrapGL(gl)).toBe(raw);
+
+        gl.drawArrays(5, 0, 4);
+        gl.drawArrays(5, 0, 4);
+        expect(raw.drawArrays).toHaveBeenCalledTimes(2);
+
+        stats.endFrame();
+        expect(stats.lastFrame.total).toBe(2);
+        expect(stats.lastFrame.calls.drawArrays).toBe(2);
+        expect(stats.current.total).toBe(0);
+    });
+
+    test('flags redundant uniforms, binds and same-size texture re-uploads', () => {
+        const gl = createCountingContext(createGL());
+        const stats = getGLCallStats(gl);
+        const program = {};
+        const tex = {};
+
+        gl.useProgram(program);
+        gl.useProgram(program);
+
+        const loc = gl.getUniformLocation(program, 'u_phase');
+        gl.uniform3fv(loc, new Float32Array([1, 2, 3]));
+        gl.uniform3fv(loc, new Float32Array([1, 2, 3]));
+        gl.uniform3fv(loc, new Float32Array([1, 2, 4]));
+
+        gl.activeTexture(gl.TEXTURE0);
+        gl.bindTexture(gl.TEXTURE_2D, tex);
+        gl.bindTexture(gl.TEXTURE_2D, tex);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, 64, 1, 0, gl.RGBA, gl.FLOAT, null);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, 64, 1, 0, gl.RGBA, gl.FLOAT, null);
+        stats.endFrame();
+
+        const f = stats.lastFrame;
+        expect(f.redundantUniforms).toBe(1);
+        expect(f.redundantByUniform).toEqual({u_phase: 1});
+        // useProgram, activeTexture (TEXTURE0 is the initial unit) and bindTexture
+        expect(f.redundantBinds).toBe(3);
+        expect(f.textureReuploads).toBe(1);
+    });
+});
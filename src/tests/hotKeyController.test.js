@@ -135,6 +135,19 @@ describe('HotKeyController', () => {
         expect(ui.captureScreenshot).toHaveBeenCalled();
     });
     // -----------------------------------------------------------------------------------------------------------------
+    test('"Shift+C" opens the poster export dialog', async () => {
+        document.dispatchEvent(charPressedEvent('c', true));
+        await Promise.resolve();
+        expect(ui.showPosterDialog).toHaveBeenCalled();
+        expect(ui.captureScreenshot).not.toHaveBeenCalled();
+    });
+    // -----------------------------------------------------------------------------------------------------------------
+    test('"Shift+V" opens the video export dialog', async () => {
+        document.dispatchEvent(charPressedEvent('v', true));
+        await Promise.resolve();
+        expect(ui.showVideoDialog).toHaveBeenCalled();
+    });
+    // -----------------------------------------------------------------------------------------------------------------
     test('"Shift+P" triggers palette cycling', async () => {
         document.dispatchEvent(charPressedEvent('p', true));
         await Promise.resolve();
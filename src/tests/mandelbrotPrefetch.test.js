@@ -0,0 +1,39 @@
+// __tests__/mandelbrotPrefetch.test.js
+import MandelbrotRenderer from '../renderers/mandelbrotRenderer';
+
+/** Renderer without a GL context: only the fields the prefetch path reads */
+function createRenderer() {
+    const renderer = Object.create(MandelbrotRenderer.prototype);
+    Object.assign(renderer, {
+        MAX_ITER: 500,
+        REF_SEARCH_GRID: 7,
+        REF_SEARCH_RADIUS: 0.5,
+        DEFAULT_ZOOM: 3.0,
+        extraIterations: 0,
+        prefetchToken: 0,
+        currentShader: 'perturbation',
+        prefetched: null,
+    });
+    return renderer;
+}
+
+describe('MandelbrotRenderer prefetch', () => {
+    test('prefetches a saved deep preset whose pan is decimal strings', async () => {
+        const pan = ['-0.7436438870371587', '0.1318259043091895'];
+        const zoom = 1e-6;
+
+        const fromStrings = createRenderer();
+        await fromStrings.prefetchView({pan, zoom});
+        const p = fromStrings.prefetched;
+
+        expect(p.pan).toEqual([Number(pan[0]), Number(pan[1])]);
+        expect(typeof p.refPan[0]).toBe('number');
+        expect(typeof p.refPan[1]).toBe('number');
+        expect(p.orbitData.every(Number.isFinite)).toBe(true);
+
+        const fromNumbers = createRenderer();
+        await fromNumbers.prefetchView({pan: pan.map(Number), zoom});
+        expect(p.refPan).toEqual(fromNumbers.prefetched.refPan);
+        expect(p.orbitData).toEqual(fromNumbers.prefetched.orbitData);
+    });
+});
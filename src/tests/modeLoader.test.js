@@ -0,0 +1,37 @@
+// __tests__/modeLoader.test.js
+import {getLoadedMode, getRendererMode, loadMode} from '../renderers/modeLoader';
+import {FRACTAL_TYPE} from '../global/constants';
+
+jest.mock('../renderers/mandelbrotRenderer', () => ({__esModule: true, default: class MandelbrotRenderer {}}));
+jest.mock('../renderers/expMapZoom', () => ({ExpMapZoom: class ExpMapZoom {}}));
+jest.mock('../renderers/juliaPreviewRenderer', () => ({JuliaPreviewRenderer: class JuliaPreviewRenderer {}}));
+jest.mock('../renderers/juliaRenderer', () => ({JuliaRenderer: class JuliaRenderer {}}));
+
+describe('ModeLoader', () => {
+    test('loads a mode once and keeps its modules', async () => {
+        expect(getLoadedMode(FRACTAL_TYPE.MANDELBROT)).toBeNull();
+
+        const first = loadMode(FRACTAL_TYPE.MANDELBROT);
+        expect(loadMode(FRACTAL_TYPE.MANDELBROT)).toBe(first);
+
+        const modules = await first;
+        expect(modules.Renderer.name).toBe('MandelbrotRenderer');
+        expect(modules.extras.ExpMapZoom.name).toBe('ExpMapZoom');
+        expect(modules.extras.JuliaPreviewRenderer.name).toBe('JuliaPreviewRenderer');
+        expect(getLoadedMode(FRACTAL_TYPE.MANDELBROT)).toBe(modules);
+    });
+
+    test('identifies the mode of a renderer among the loaded modes', async () => {
+        const {Renderer: JuliaRenderer} = await loadMode(FRACTAL_TYPE.JULIA);
+        const {Renderer: MandelbrotRenderer} = await loadMode(FRACTAL_TYPE.MANDELBROT);
+
+        expect(getRendererMode(new JuliaRenderer())).toBe(FRACTAL_TYPE.JULIA);
+        expect(getRendererMode(new MandelbrotRenderer())).toBe(FRACTAL_TYPE.MANDELBROT);
+        expect(getRendererMode({})).toBeNull();
+    });
+
+    test('rejects unknown modes', async () => {
+        await expect(loadMode(42)).rejects.toThrow('Unknown fractal mode');
+        expect(getLoadedMode(42)).toBeNull();
+    });
+});
@@ -136,6 +136,38 @@ describe('MouseEventHandlers', () => {
         jest.runAllTimers();
         expect(fractalApp.zoom).not.toBe(before);
     });
+    // -----------------------------------------------------------------------------------------------------------------
+    test('should integrate coalesced pointer samples and commit once per frame', () => {
+        canvas.dispatchEvent(mouseLeftDownEvent(100, 100));
+
+        // Pointer event carrying three sub-frame samples, followed by its compatibility mousemove
+        const pointerMove = new Event('pointermove');
+        Object.assign(pointerMove, {
+            isPrimary: true,
+            pointerType: 'mouse',
+            buttons: 1,
+            clientX: 160,
+            clientY: 100,
+            getCoalescedEvents: () => [
+                {clientX: 120, clientY: 100},
+                {clientX: 140, clientY: 100},
+                {clientX: 160, clientY: 100}
+            ],
+            getPredictedEvents: () => []
+        });
+        canvas.dispatchEvent(pointerMove);
+        canvas.dispatchEvent(mouseLeftMoveEvent(160, 100));
+        canvas.dispatchEvent(mouseLeftMoveEvent(170, 100));
+
+        expect(fractalApp.draw).not.toHaveBeenCalled();
+        jest.advanceTimersByTime(20);
+
+        expect(fractalApp.draw).toHaveBeenCalledTimes(1);
+        expect(fractalApp.screenToViewVector).toHaveBeenCalledWith(120, 100);
+        // Dragging right by 70 px moves the view left by 70/800 of the view width (mock mapping)
+        const movedX = (fractalApp.panDD.x.hi + 0.5) + fractalApp.panDD.x.lo;
+        expect(movedX).toBeCloseTo(-(70 / 800) * fractalApp.zoom, 28);
+    });
 });
 
 describe('Deep Zoom Panning Precision', () => {
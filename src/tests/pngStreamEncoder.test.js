@@ -0,0 +1,85 @@
+// __tests__/pngStreamEncoder.test.js
+import {crc32, PNGStreamEncoder} from '../global/pngStreamEncoder';
+
+const zlib = require('zlib');
+const {CompressionStream} = require('stream/web');
+
+const bytes = (s) => Uint8Array.from(s, c => c.charCodeAt(0));
+
+/** Splits a PNG into chunks and verifies every CRC */
+function parseChunks(png) {
+    const view = new DataView(png.buffer, png.byteOffset, png.byteLength);
+    const chunks = [];
+    let o = 8;
+    while (o < png.length) {
+        const length = view.getUint32(o);
+        const type = String.fromCharCode(...png.subarray(o + 4, o + 8));
+        const data = png.subarray(o + 8, o + 8 + length);
+        expect(view.getUint32(o + 8 + length)).toBe(crc32(png.subarray(o + 4, o + 8 + length)));
+        chunks.push({type, data});
+        o += 12 + length;
+    }
+    return chunks;
+}
+
+async function encode(width, height, rgb, bandRows) {
+    const parts = [];
+    const encoder = new PNGStreamEncoder(width, height, {
+        write: (b) => {
+            parts.push(Uint8Array.from(b));
+        },
+        close: jest.fn(),
+    }, {text: {Software: 'test'}, createCompressor: () => new CompressionStream('deflate')});
+
+    await encoder.start();
+    for (let y = 0; y < height; y += bandRows) {
+        const rows = Math.min(bandRows, height - y);
+        await encoder.writeRows(rgb.subarray(y * width * 3, (y + rows) * width * 3), rows);
+    }
+    await encoder.finish();
+    return Buffer.concat(parts);
+}
+
+describe('PNGStreamEncoder', () => {
+    test('crc32 matches the reference check value', () => {
+        expect(crc32(bytes('123456789'))).toBe(0xCBF43926);
+    });
+
+    test('streams bands into a valid PNG that decodes to the input', async () => {
+        const width = 37, height = 23;
+        const rgb = new Uint8Array(width * height * 3).map((_, i) => (i * 7 + (i >> 5)) & 0xFF);
+
+        const png = await encode(width, height, rgb, 10);
+        expect(Array.from(png.subarray(0, 8))).toEqual([0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A]);
+
+        const chunks = parseChunks(png);
+        expect(chunks.map(c => c.type)).toEqual(['IHDR', 'tEXt', 'IDAT', 'IEND']);
+
+        const ihdr = Buffer.from(chunks[0].data);
+        expect(ihdr.readUInt32BE(0)).toBe(width);
+        expect(ihdr.readUInt32BE(4)).toBe(height);
+
+        // Undo the Sub filter and compare
+        const raw = zlib.inflateSync(Buffer.concat(chunks.filter(c => c.type === 'IDAT').map(c => c.data)));
+        const stride = width * 3;
+        expect(raw.length).toBe(height * (stride + 1));
+        const decoded = new Uint8Array(width * height * 3);
+        for (let r = 0; r < height; r++) {
+            expect(raw[r * (stride + 1)]).toBe(1);
+            for (let i = 0; i < stride; i++) {
+                const left = i >= 3 ? decoded[r * stride + i - 3] : 0;
+                decoded[r * stride + i] = (raw[r * (stride + 1) + 1 + i] + left) & 0xFF;
+            }
+        }
+        expect(decoded).toEqual(rgb);
+    });
+
+    test('refuses to finish an incomplete image', async () => {
+        const encoder = new PNGStreamEncoder(4, 4, {write: jest.fn(), close: jest.fn()},
+            {createCompressor: () => new CompressionStream('deflate')});
+        await encoder.start();
+        await encoder.writeRows(new Uint8Array(4 * 3 * 2), 2);
+        await expect(encoder.finish()).rejects.toThrow('2 of 4 rows');
+        await encoder.abort();
+    });
+});
@@ -0,0 +1,112 @@
+// __tests__/profiler.test.js
+import {profiler} from '../global/profiler';
+
+/** Minimal EXT_disjoint_timer_query stand-in; results become available when `ready` is flipped */
+function createTimerGL() {
+    const queries = [];
+    const ext = {
+        TIME_ELAPSED_EXT: 0x88BF,
+        QUERY_RESULT_EXT: 0x8866,
+        QUERY_RESULT_AVAILABLE_EXT: 0x8867,
+        GPU_DISJOINT_EXT: 0x8FBB,
+        createQueryEXT: jest.fn(() => {
+            const q = {ready: false, ns: 0};
+            queries.push(q);
+            return q;
+        }),
+        deleteQueryEXT: jest.fn(),
+        beginQueryEXT: jest.fn(),
+        endQueryEXT: jest.fn(),
+        getQueryObjectEXT: jest.fn((q, pname) => pname === ext.QUERY_RESULT_AVAILABLE_EXT ? q.ready : q.ns),
+    };
+    const gl = {
+        getExtension: jest.fn(name => name === 'EXT_disjoint_timer_query' ? ext : null),
+        getParameter: jest.fn(() => false),
+    };
+    return {gl, ext, queries};
+}
+
+describe('Profiler', () => {
+    afterEach(() => {
+        profiler.disable();
+        profiler.reset();
+        profiler.onGpuSample = null;
+    });
+
+    test('is a no-op until enabled', () => {
+        profiler.begin('orbit');
+        profiler.end();
+        expect(profiler.summary()).toEqual([]);
+    });
+
+    test('records nested stages and computes percentiles', () => {
+        profiler.enable(null);
+        const now = jest.spyOn(performance, 'now');
+
+        for (let i = 1; i <= 100; i++) {
+            now.mockReturnValueOnce(0).mockReturnValueOnce(1).mockReturnValueOnce(1 + i).mockReturnValueOnce(100 + i);
+            profiler.begin('frame');
+            profiler.begin('orbit');
+            profiler.end();
+            profiler.end();
+        }
+        now.mockRestore();
+
+        const orbit = profiler.summary().find(r => r.name === 'orbit');
+        expect(orbit.count).toBe(100);
+        expect(orbit.p50).toBe(50);
+        expect(orbit.p95).toBe(95);
+        expect(orbit.max).toBe(100);
+        expect(orbit.histogram.reduce((a, b) => a + b, 0)).toBe(100);
+    });
+
+    test('keeps one GPU query per draw in flight and resolves them in order', () => {
+        const {gl, ext, queries} = createTimerGL();
+        const samples = [];
+        profiler.enable(gl);
+        profiler.onGpuSample = ms => samples.push(ms);
+
+        for (let i = 0; i < 3; i++) {
+            profiler.beginGpu();
+            profiler.endGpu();
+        }
+        expect(ext.beginQueryEXT).toHaveBeenCalledTimes(3);
+        expect(queries).toHaveLength(3);
+
+        queries[0].ready = true;
+        queries[0].ns = 2e6;
+        queries[1].ns = 3e6; // not ready: blocks the later query
+        queries[2].ready = true;
+        queries[2].ns = 4e6;
+        expect(profiler.pollGpu()).toBe(1);
+        expect(samples).toEqual([2]);
+
+        queries[1].ready = true;
+        expect(profiler.pollGpu()).toBe(2);
+        expect(samples).toEqual([2, 3, 4]);
+
+        // Resolved slots are reused instead of allocating new queries
+        profiler.beginGpu();
+        profiler.endGpu();
+        expect(queries).toHaveLength(4);
+        for (let i = 0; i < 8; i++) {
+            profiler.beginGpu();
+            profiler.endGpu();
+        }
+        expect(queries).toHaveLength(8);
+        expect(profiler.gpuDropped).toBeGreaterThan(0);
+    });
+
+    test('exports Trace Event Format JSON', () => {
+        profiler.enable(null);
+        profiler.begin('reference');
+        profiler.end();
+
+        const trace = profiler.toChromeTrace();
+        const events = trace.traceEvents.filter(e => e.ph === 'X');
+        expect(events).toHaveLength(1);
+        expect(events[0]).toEqual(expect.objectContaining({name: 'reference', cat: 'cpu', pid: 1, tid: 1}));
+        expect(events[0].dur).toBeGreaterThanOrEqual(1);
+        expect(() => JSON.stringify(trace)).not.toThrow();
+    });
+});
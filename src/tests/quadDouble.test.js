@@ -0,0 +1,140 @@
+// __tests__/quadDouble.test.js
+
+import {
+    coordinateToNumber,
+    formatCoordinate,
+    isCoordinate,
+    parseCoordinate,
+    qdAdd,
+    qdAddScaled,
+    qdCopy,
+    qdFrom,
+    qdMake,
+    qdParse,
+    qdSubDDInto,
+    qdSubInto,
+    qdToDD,
+    qdToString,
+    qdValue
+} from "../global/quadDouble";
+
+const DEEP_X = '-0.7436438870371587047521915061147739214567890123456789';
+
+describe('QuadDouble', () => {
+    describe('qdParse / qdToString', () => {
+        test('round-trips a 52-digit coordinate', () => {
+            const q = qdParse(DEEP_X);
+            expect(q[0]).toBe(-0.7436438870371587);
+            expect(qdToString(q, 52)).toBe(DEEP_X);
+        });
+
+        test('parses exponents and formats small values', () => {
+            const q = qdParse('1.25e-40');
+            expect(q[0]).toBe(1.25e-40);
+            expect(qdToString(q, 10)).toBe('0.000000000000000000000000000000000000000125');
+        });
+
+        test('formats plain doubles exactly', () => {
+            expect(qdToString(qdMake(-2), 5)).toBe('-2');
+            expect(qdToString(qdMake(0.1), 30)).toBe('0.100000000000000005551115123126');
+            expect(qdToString(qdMake(0), 10)).toBe('0');
+        });
+
+        test('rejects non-decimal text', () => {
+            expect(qdParse('abc')).toBeNull();
+            expect(qdParse('.')).toBeNull();
+        });
+    });
+
+    describe('qdAdd', () => {
+        test('keeps steps far below the double-double resolution', () => {
+            const q = qdMake(-0.5);
+            for (let i = 0; i < 1000; i++) qdAdd(q, 1e-40);
+            expect(qdToString(q, 40)).toBe('-0.4999999999999999999999999999999999999');
+            expect(qdValue(q)).toBe(-0.5);
+        });
+
+        test('single-limb fast path matches two-sum', () => {
+            const q = qdMake(1);
+            qdAdd(q, 1e-17);
+            expect(q[0]).toBe(1);
+            expect(q[1]).toBe(1e-17);
+            expect(q[2]).toBe(0);
+        });
+    });
+
+    describe('qdSubInto / qdSubDDInto', () => {
+        test('difference of two deep coordinates is exact', () => {
+            const a = qdParse(DEEP_X);
+            const b = qdParse(DEEP_X.slice(0, -6) + '000000');
+            const d = qdSubInto(a, b, qdMake());
+            expect(Math.abs(d[0] + 4.56789e-47)).toBeLessThan(1e-60);
+        });
+
+        test('delta to a double-double reference keeps sub-1e-32 offsets', () => {
+            const q = qdMake(-0.5);
+            qdAdd(q, 1e-37);
+            const out = new Float64Array(2);
+            qdSubDDInto(q, {hi: -0.5, lo: 0}, out);
+            expect(Math.abs(out[0] - 1e-37)).toBeLessThan(1e-50);
+        });
+
+        test('shallow values take the double-double path', () => {
+            const q = qdMake(0.25, 1e-20);
+            const out = new Float64Array(2);
+            qdSubDDInto(q, {hi: 0.25, lo: 0}, out);
+            expect(out[0]).toBe(1e-20);
+        });
+    });
+
+    describe('qdAddScaled', () => {
+        test('interpolates halfway between deep endpoints', () => {
+            const start = qdParse(DEEP_X);
+            const target = qdCopy(qdMake(), start);
+            qdAdd(target, 2e-45);
+            const delta = qdSubInto(target, start, qdMake());
+
+            const mid = qdAddScaled(qdCopy(qdMake(), start), delta, 0.5);
+            const offset = qdSubInto(mid, start, qdMake());
+            expect(Math.abs(offset[0] - 1e-45)).toBeLessThan(1e-58);
+        });
+    });
+
+    describe('qdToDD', () => {
+        test('writes the leading double-double', () => {
+            const dd = qdToDD(qdParse(DEEP_X), {hi: 0, lo: 0});
+            expect(dd.hi).toBe(-0.7436438870371587);
+            expect(Math.abs(dd.lo)).toBeLessThan(1e-16);
+        });
+    });
+
+    describe('coordinates', () => {
+        test('parseCoordinate keeps numbers for double-sized input and strings beyond', () => {
+            expect(parseCoordinate('-0.50000000000000000')).toBe(-0.5);
+            expect(parseCoordinate('1.5e-3')).toBe(0.0015);
+            expect(parseCoordinate(DEEP_X)).toBe(DEEP_X);
+            expect(parseCoordinate('x')).toBeNaN();
+        });
+
+        test('isCoordinate accepts finite numbers and decimal strings', () => {
+            expect(isCoordinate(0.5)).toBe(true);
+            expect(isCoordinate('-1e-40')).toBe(true);
+            expect(isCoordinate(NaN)).toBe(false);
+            expect(isCoordinate('1,5')).toBe(false);
+        });
+
+        test('formatCoordinate stays numeric for shallow views', () => {
+            const q = qdParse(DEEP_X);
+            expect(formatCoordinate(q, 1e-5)).toBe(-0.7436438870371587);
+            expect(typeof formatCoordinate(q, 1e-40)).toBe('string');
+            expect(formatCoordinate(qdMake(0.25), 1e-40)).toBe(0.25);
+        });
+
+        test('qdFrom and coordinateToNumber accept every coordinate form', () => {
+            expect(qdFrom(qdMake(), DEEP_X)[0]).toBe(-0.7436438870371587);
+            expect(qdFrom(qdMake(), 0.5)[0]).toBe(0.5);
+            expect(coordinateToNumber(DEEP_X)).toBe(-0.7436438870371587);
+            expect(coordinateToNumber(qdMake(3))).toBe(3);
+        });
+    });
+});
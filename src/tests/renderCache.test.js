@@ -0,0 +1,35 @@
+// __tests__/renderCache.test.js
+import {cacheGet, cachePut, stableStringify, viewStateKey} from '../global/renderCache';
+
+describe('RenderCache', () => {
+    const view = {mode: 'mandelbrot', pan: [-0.743643887037151, 0.13182590420533], zoom: 1.5e-10, shader: 'series'};
+
+    test('serializes equal states equally regardless of key order', () => {
+        expect(stableStringify({b: 1, a: {d: [1, 2], c: null}})).toBe('{"a":{"c":null,"d":[1,2]},"b":1}');
+        expect(stableStringify({a: 1, skipped: undefined})).toBe(stableStringify({a: 1}));
+        expect(stableStringify(new Float32Array([0.5, 2]))).toBe('[0.5,2]');
+    });
+
+    test('derives stable keys from the full view state', () => {
+        const key = viewStateKey('orbit', view);
+        expect(key).toMatch(/^orbit:[0-9a-z]+\.[0-9a-z]+$/);
+        expect(viewStateKey('orbit', {shader: 'series', zoom: 1.5e-10, pan: [...view.pan], mode: 'mandelbrot'})).toBe(key);
+        expect(viewStateKey('tile', view)).not.toBe(key);
+    });
+
+    test('distinguishes views differing in the last bit of a coordinate', () => {
+        const key = viewStateKey('orbit', view);
+        const nudged = {...view, pan: [view.pan[0] + Number.EPSILON * 0.5, view.pan[1]]};
+        expect(nudged.pan[0]).not.toBe(view.pan[0]);
+        expect(viewStateKey('orbit', nudged)).not.toBe(key);
+
+        // Double-double low parts count too
+        const dd = {x: {hi: 0.25, lo: 1e-20}};
+        expect(viewStateKey('orbit', dd)).not.toBe(viewStateKey('orbit', {x: {hi: 0.25, lo: 2e-20}}));
+    });
+
+    test('misses without persistent storage', async () => {
+        await expect(cachePut('orbit:x', 'orbit', {a: 1}, 8)).resolves.toBeUndefined();
+        await expect(cacheGet('orbit:x')).resolves.toBeNull();
+    });
+});
@@ -0,0 +1,48 @@
+// __tests__/telemetry.test.js
+import {chunksToCSV, percentile, presetKey, summarizeChunks} from '../global/telemetry';
+
+const chunk = (presetId, frameMs, gpuMs) => ({
+    key: presetKey('Mandelbrot', presetId),
+    mode: 'Mandelbrot',
+    presetId,
+    zoomDepth: 3,
+    ts: 0,
+    frameMs,
+    gpuMs,
+    iterations: frameMs.map(() => 500),
+    renderScale: frameMs.map(() => 1),
+    adaptive: true,
+    extraIterations: -100,
+});
+
+describe('Telemetry analysis', () => {
+    test('percentile uses nearest rank', () => {
+        const sorted = Array.from({length: 100}, (_, i) => i + 1);
+        expect(percentile(sorted, 50)).toBe(50);
+        expect(percentile(sorted, 99)).toBe(99);
+        expect(percentile([], 50)).toBeNaN();
+    });
+
+    test('summarizes chunks per preset and skips missing GPU samples', () => {
+        const stats = summarizeChunks([
+            chunk('Seahorse', [10, 30], [5, null]),
+            chunk('Seahorse', [20], [7]),
+            chunk(null, [40], [null]),
+        ]);
+
+        const seahorse = stats.get(presetKey('Mandelbrot', 'Seahorse'));
+        expect(seahorse.count).toBe(3);
+        expect(seahorse.frame).toEqual([20, 30, 30]);
+        expect(seahorse.gpu).toEqual([5, 7, 7]);
+
+        const free = stats.get(presetKey('Mandelbrot', null));
+        expect(free.gpu.every(Number.isNaN)).toBe(true);
+    });
+
+    test('exports one CSV row per frame', () => {
+        const csv = chunksToCSV([chunk('Seahorse', [10, 30], [5, null])]).split('\n');
+        expect(csv).toHaveLength(3);
+        expect(csv[0]).toBe('timestamp,mode,preset,zoomDepth,frameMs,gpuMs,iterations,renderScale,extraIterations');
+        expect(csv[2]).toContain('"Seahorse",3,30.000,,500,1.000,-100');
+    });
+});
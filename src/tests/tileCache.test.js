@@ -0,0 +1,62 @@
+// __tests__/tileCache.test.js
+import {fractalToClip, TILE_SIZE, tileLevel, TileLRU, visibleTileRange} from '../renderers/tileCache';
+
+describe('TileCache', () => {
+    const view = {pan: [0.5, 14], zoom: 4, rotation: 0, width: 1600, height: 1024};
+
+    test('picks the level whose texels match the screen pixels', () => {
+        // 1024 px over 4 units = 256 px per unit = one 256-texel tile per unit
+        expect(tileLevel(4, 1024)).toBe(0);
+        expect(tileLevel(1, 1024)).toBe(2);
+        expect(tileLevel(64, 1024)).toBe(-4);
+        // Texel density stays within a factor of sqrt(2) of the pixel density
+        const zoom = 0.37;
+        const texelsPerPixel = (TILE_SIZE / 2 ** -tileLevel(zoom, 1024)) / (1024 / zoom);
+        expect(texelsPerPixel).toBeGreaterThan(Math.SQRT1_2 - 1e-9);
+        expect(texelsPerPixel).toBeLessThan(Math.SQRT2 + 1e-9);
+    });
+
+    test('maps the view corners to the clip space corners', () => {
+        expect(fractalToClip(view, 0.5, 14)).toEqual([0, 0]);
+        const [x, y] = fractalToClip(view, 0.5 + 0.5 * 4 * 1600 / 1024, 14 + 2);
+        expect(x).toBeCloseTo(1, 12);
+        expect(y).toBeCloseTo(1, 12);
+
+        // Rotated views map their own corners back to the screen corners
+        const rotated = {...view, rotation: 0.7};
+        const u = 0.5 * 1600 / 1024, v = 0.5;
+        const cx = 0.5 + (u * Math.cos(0.7) - v * Math.sin(0.7)) * 4;
+        const cy = 14 + (u * Math.sin(0.7) + v * Math.cos(0.7)) * 4;
+        const [rx, ry] = fractalToClip(rotated, cx, cy);
+        expect(rx).toBeCloseTo(1, 12);
+        expect(ry).toBeCloseTo(1, 12);
+    });
+
+    test('covers the view with the tiles it overlaps', () => {
+        // x spans 0.5 +- 3.125, y spans 14.25 +- 2 at one unit per tile
+        const shifted = {...view, pan: [0.5, 14.25]};
+        expect(visibleTileRange(shifted, 0)).toEqual({x0: -3, x1: 3, y0: 12, y1: 16});
+        expect(visibleTileRange(shifted, -1)).toEqual({x0: -2, x1: 1, y0: 6, y1: 8});
+    });
+
+    test('evicts the least recently used tile, never one used by the current frame', () => {
+        const lru = new TileLRU(3);
+        expect(lru.allocate('a', 1).slot).toBe(0);
+        expect(lru.allocate('b', 1).slot).toBe(1);
+        expect(lru.allocate('c', 2).slot).toBe(2);
+
+        expect(lru.get('a', 2).slot).toBe(0); // b is now the oldest
+        expect(lru.allocate('d', 3).slot).toBe(1);
+        expect(lru.get('b', 3)).toBeNull();
+        expect(lru.size).toBe(3);
+
+        lru.get('c', 4);
+        lru.get('a', 4);
+        lru.get('d', 4);
+        expect(lru.allocate('e', 4)).toBeNull();
+
+        lru.clear();
+        expect(lru.size).toBe(0);
+        expect(lru.allocate('f', 5).slot).toBe(0);
+    });
+});
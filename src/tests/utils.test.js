@@ -7,22 +7,33 @@ import {
     compareComplex,
     comparePalettes,
     ddAdd,
+    ddAddDD,
     ddMake,
     ddSet,
+    ddSubDD,
+    ddSubDDInto,
     ddValue,
     easeInOut,
     easeInOutCubic,
     easeInOutQuint,
     expandComplexToString,
+    fillTexels,
     getAnimationDuration,
     hexToRGBArray,
     hsbToRgb,
     hslToRgb,
+    interpolateZoom,
+    isSameZoom,
     lerp,
     normalizeRotation,
     quickTwoSum,
     rgbToHsl,
-    twoSum
+    scaleByPowerOfTwo,
+    splitFloatInto,
+    splitScaledDDInto,
+    splitZoomInto,
+    twoSum,
+    ZOOM_EXPONENT_THRESHOLD
 } from "../global/utils";
 
 
@@ -320,5 +331,149 @@ describe('Utils', () => {
                 expect(dd.hi).toBe(startValue);
             });
         });
+
+        describe('ddSubDD / ddAddDD', () => {
+            test('keeps the sub-ulp difference of two DD numbers', () => {
+                const a = ddMake(-0.5, 1e-20);
+                const b = ddMake(-0.5, -2e-20);
+                const d = ddSubDD(a, b);
+                expect(Math.abs(d.hi + d.lo - 3e-20)).toBeLessThan(1e-33);
+            });
+
+            test('does not mutate its arguments', () => {
+                const a = ddMake(1, 1e-17);
+                const b = ddMake(2, 0);
+                ddAddDD(a, b);
+                expect(a).toEqual({hi: 1, lo: 1e-17});
+                expect(b).toEqual({hi: 2, lo: 0});
+            });
+        });
+
+        describe('ddSubDDInto', () => {
+            test('writes the same result as ddSubDD into the given slots', () => {
+                const a = ddMake(-0.743643887037151, 1.3e-17);
+                const b = ddMake(-0.743643887, -4e-18);
+                const out = new Float64Array(4);
+                const expected = ddSubDD(a, b);
+
+                expect(ddSubDDInto(a, b, out, 2)).toBe(out);
+                expect(out[0]).toBe(0);
+                expect(out[2]).toBe(expected.hi);
+                expect(out[3]).toBe(expected.lo);
+            });
+        });
+
+        describe('splitFloatInto', () => {
+            test('stores a float32 high part and the float32 residual', () => {
+                const value = -0.743643887037151;
+                const out = new Float32Array(2);
+                splitFloatInto(value, out);
+
+                expect(out[0]).toBe(Math.fround(value));
+                expect(out[1]).toBe(Math.fround(value - Math.fround(value)));
+                // Two float32 parts carry ~48 bits of the value
+                expect(Math.abs(out[0] + out[1] - value)).toBeLessThan(1e-14);
+            });
+
+            test('writes at the given offset only', () => {
+                const out = new Float32Array(4).fill(7);
+                splitFloatInto(0.5, out, 2);
+                expect(Array.from(out)).toEqual([7, 7, 0.5, 0]);
+            });
+        });
+
+        describe('fillTexels', () => {
+            test('repeats the source texel up to the end index', () => {
+                const data = new Float32Array(4 * 7);
+                data.set([1, 2, 3, 4], 8);
+                fillTexels(data, 8, 24);
+
+                for (let k = 2; k < 6; k++) {
+                    expect(Array.from(data.subarray(k * 4, k * 4 + 4))).toEqual([1, 2, 3, 4]);
+                }
+                expect(Array.from(data.subarray(24))).toEqual([0, 0, 0, 0]);
+                expect(Array.from(data.subarray(0, 8))).toEqual([0, 0, 0, 0, 0, 0, 0, 0]);
+            });
+        });
+    });
+
+    describe('Extended-range zoom', () => {
+        describe('scaleByPowerOfTwo', () => {
+            test('scales exactly where the power itself would overflow', () => {
+                expect(scaleByPowerOfTwo(3, -2)).toBe(0.75);
+                expect(scaleByPowerOfTwo(2 ** -1074, 1074)).toBe(1);
+                expect(scaleByPowerOfTwo(1, -1074)).toBe(Number.MIN_VALUE);
+            });
+        });
+
+        describe('splitZoomInto', () => {
+            test('keeps exponent 0 above the threshold', () => {
+                const out = new Float64Array(3);
+                expect(splitZoomInto(0.5, out)).toBe(0);
+                expect(out[0] + out[1]).toBe(0.5);
+                expect(out[2]).toBe(0);
+            });
+
+            test('splits deep zooms into a [1, 2) mantissa and an exponent', () => {
+                for (const zoom of [2 ** (ZOOM_EXPONENT_THRESHOLD - 1), 3.7e-40, 1e-80, 1e-200, 2 ** -1000]) {
+                    const out = new Float64Array(3);
+                    const exp = splitZoomInto(zoom, out);
+                    const mantissa = out[0] + out[1];
+
+                    expect(out[2]).toBe(exp);
+                    expect(mantissa).toBeGreaterThanOrEqual(1);
+                    expect(mantissa).toBeLessThan(2);
+                    // Both parts are float32 values
+                    expect(Math.fround(out[0])).toBe(out[0]);
+                    expect(Math.abs(scaleByPowerOfTwo(mantissa, exp) / zoom - 1)).toBeLessThan(1e-14);
+                }
+            });
+
+            test('writes at the given offset', () => {
+                const out = new Float64Array(6).fill(7);
+                expect(splitZoomInto(2 ** -100, out, 3)).toBe(-100);
+                expect(Array.from(out)).toEqual([7, 7, 7, 1, 0, -100]);
+            });
+        });
+
+        describe('splitScaledDDInto', () => {
+            test('scales a double-double into a float32 pair keeping ~48 bits', () => {
+                const hi = -0.743643887037151e-90;
+                const lo = 1.2345e-108;
+                const out = new Float32Array(2);
+                splitScaledDDInto(hi, lo, 300, out);
+
+                const expected = scaleByPowerOfTwo(hi, 300) + scaleByPowerOfTwo(lo, 300);
+                expect(Math.abs((out[0] + out[1]) / expected - 1)).toBeLessThan(1e-14);
+            });
+
+            test('may overwrite its own input slots', () => {
+                const d = new Float64Array([0.1, 1e-18]);
+                splitScaledDDInto(d[0], d[1], -3, d, 0);
+                expect(d[0]).toBe(Math.fround(0.1 / 8));
+                expect(Math.abs(d[0] + d[1] - (0.1 + 1e-18) / 8)).toBeLessThan(1e-17);
+            });
+        });
+
+        describe('interpolateZoom', () => {
+            test('interpolates geometrically between the endpoints', () => {
+                expect(interpolateZoom(4, 1, 0)).toBeCloseTo(4, 12);
+                expect(interpolateZoom(4, 1, 0.5)).toBeCloseTo(2, 12);
+                expect(interpolateZoom(4, 1e-300, 1)).toBe(1e-300);
+            });
+
+            test('stays finite across the whole double range', () => {
+                const zoom = interpolateZoom(40, 1e-300, 0.5);
+                expect(Math.abs(Math.log10(zoom) - Math.log10(Math.sqrt(40) * 1e-150))).toBeLessThan(1e-9);
+            });
+        });
+
+        describe('isSameZoom', () => {
+            test('compares relatively at any depth', () => {
+                expect(isSameZoom(1e-25, 1e-30)).toBe(false);
+                expect(isSameZoom(1e-30, 1e-30 * (1 + 1e-15))).toBe(true);
+                expect(isSameZoom(3, 3.5)).toBe(false);
+            });
+        });
     });
 });
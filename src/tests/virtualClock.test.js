@@ -0,0 +1,56 @@
+// __tests__/virtualClock.test.js
+import {
+    advanceVirtualClock,
+    installVirtualClock,
+    real,
+    uninstallVirtualClock
+} from '../global/virtualClock';
+
+const wait = (ms) => new Promise(resolve => real.setTimeout(resolve, ms));
+
+describe('VirtualClock', () => {
+    afterEach(() => uninstallVirtualClock());
+
+    test('fires timers only as virtual time advances', async () => {
+        installVirtualClock();
+        const fired = [];
+        setTimeout(() => fired.push('timeout'), 30);
+        const interval = setInterval(() => fired.push('interval'), 20);
+
+        await advanceVirtualClock(25);
+        expect(fired).toEqual(['interval']);
+        await advanceVirtualClock(25);
+        expect(fired).toEqual(['interval', 'timeout', 'interval']);
+        clearInterval(interval);
+        await advanceVirtualClock(100);
+        expect(fired).toHaveLength(3);
+    });
+
+    test('timers moved onto the real clock can still be cleared by their virtual ids', async () => {
+        installVirtualClock();
+        let intervalRuns = 0;
+        let timeoutRuns = 0;
+        const interval = setInterval(() => intervalRuns++, 5);
+        const timeout = setTimeout(() => timeoutRuns++, 5);
+        uninstallVirtualClock();
+
+        clearInterval(interval);
+        clearTimeout(timeout);
+        await wait(40);
+        expect(intervalRuns).toBe(0);
+        expect(timeoutRuns).toBe(0);
+    });
+
+    test('a stale virtual id never clears an unrelated real timer', async () => {
+        installVirtualClock();
+        const stale = setTimeout(() => {}, 1);
+        await advanceVirtualClock(5);
+        uninstallVirtualClock();
+
+        let runs = 0;
+        setTimeout(() => runs++, 5);
+        clearTimeout(stale);
+        await wait(30);
+        expect(runs).toBe(1);
+    });
+});
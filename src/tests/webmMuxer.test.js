@@ -0,0 +1,99 @@
+// __tests__/webmMuxer.test.js
+import {vint, WebMMuxer} from '../global/webmMuxer';
+
+/** Reads an EBML variable-length integer; returns {value, length} (value -1 = unknown size) */
+function readVint(bytes, o) {
+    let length = 1;
+    while (!(bytes[o] & (0x80 >> (length - 1)))) length++;
+    let value = bytes[o] & (0xFF >> length);
+    let unknown = value === (0xFF >> length);
+    for (let i = 1; i < length; i++) {
+        value = value * 256 + bytes[o + i];
+        unknown = unknown && bytes[o + i] === 0xFF;
+    }
+    return {value: unknown ? -1 : value, length};
+}
+
+/** Reads an element ID (kept with its marker bits) */
+function readId(bytes, o) {
+    const {length} = readVint(bytes, o);
+    let id = 0;
+    for (let i = 0; i < length; i++) id = id * 256 + bytes[o + i];
+    return {id, length};
+}
+
+/** Lists the top-level (or segment-level) elements in a byte range */
+function elements(bytes, start, end) {
+    const out = [];
+    let o = start;
+    while (o < end) {
+        const id = readId(bytes, o);
+        const size = readVint(bytes, o + id.length);
+        const dataStart = o + id.length + size.length;
+        const dataEnd = size.value < 0 ? end : dataStart + size.value;
+        out.push({id: id.id, dataStart, dataEnd});
+        o = dataEnd;
+    }
+    return out;
+}
+
+const chunk = (type, timestampMs, payload) => ({
+    type,
+    timestamp: timestampMs * 1000,
+    byteLength: payload.length,
+    copyTo: (dst) => dst.set(payload),
+});
+
+describe('WebMMuxer', () => {
+    test('vint uses the shortest encoding and never the all-ones (unknown) pattern', () => {
+        expect(vint(0)).toEqual([0x80]);
+        expect(vint(126)).toEqual([0xFE]);
+        expect(vint(127)).toEqual([0x40, 0x7F]);
+        expect(vint(300)).toEqual([0x41, 0x2C]);
+        expect(readVint(vint(123456789), 0).value).toBe(123456789);
+    });
+
+    test('writes header, one cluster per keyframe and relative block timecodes', async () => {
+        const parts = [];
+        const sink = {write: (b) => parts.push(Uint8Array.from(b)), close: jest.fn()};
+        const muxer = new WebMMuxer(sink, {width: 320, height: 180, codecId: 'V_VP9', frameRate: 30});
+
+        await muxer.addChunk(chunk('key', 0, [1, 2, 3]));
+        await muxer.addChunk(chunk('delta', 33, [4]));
+        await muxer.addChunk(chunk('key', 2000, [5, 6]));
+        await muxer.addChunk(chunk('delta', 2033, [7]));
+        await muxer.finish();
+        expect(sink.close).toHaveBeenCalled();
+
+        const bytes = Buffer.concat(parts);
+        const top = elements(bytes, 0, bytes.length);
+        expect(top.map(e => e.id)).toEqual([0x1A45DFA3, 0x18538067]);
+        expect(bytes.subarray(top[0].dataStart, top[0].dataEnd).includes(Buffer.from('webm'))).toBe(true);
+
+        const segment = elements(bytes, top[1].dataStart, top[1].dataEnd);
+        expect(segment.map(e => e.id)).toEqual([0x1549A966, 0x1654AE6B, 0x1F43B675, 0x1F43B675]);
+
+        const clusters = segment.slice(2).map(cluster => {
+            const children = elements(bytes, cluster.dataStart, cluster.dataEnd);
+            expect(children[0].id).toBe(0xE7);
+            const timecode = bytes.readUIntBE(children[0].dataStart, children[0].dataEnd - children[0].dataStart);
+            const blocks = children.slice(1).map(block => {
+                expect(block.id).toBe(0xA3);
+                const data = bytes.subarray(block.dataStart, block.dataEnd);
+                return {track: data[0], time: (data[1] << 8) | data[2], key: !!(data[3] & 0x80), payload: [...data.subarray(4)]};
+            });
+            return {timecode, blocks};
+        });
+
+        expect(clusters).toEqual([
+            {timecode: 0, blocks: [
+                {track: 0x81, time: 0, key: true, payload: [1, 2, 3]},
+                {track: 0x81, time: 33, key: false, payload: [4]},
+            ]},
+            {timecode: 2000, blocks: [
+                {track: 0x81, time: 0, key: true, payload: [5, 6]},
+                {track: 0x81, time: 33, key: false, payload: [7]},
+            ]},
+        ]);
+    });
+});
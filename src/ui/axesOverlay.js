@@ -1,29 +1,41 @@
 /**
  * @module AxesOverlay
- * @description Renders coordinate axes grid overlay for Riemann mode
+ * @description Renders coordinate axes grid overlay for Riemann mode. Grid lines and labels live in the
+ * renderer's WebGL context (see GLOverlayLayer) and are rebuilt only when the tick spacing changes or the
+ * view leaves the prebuilt area; plain pans and rotations just move the geometry through view uniforms.
  * @author Radim Brnka
  * @copyright Synaptory Fractal Traveler, 2025-2026
  * @license MIT
  */
 
 import {log} from '../global/constants';
+import {getOverlayLayer, pushLine} from './glOverlayLayer';
+import {profiler} from '../global/profiler';
 
-let canvas = null;
-let ctx = null;
 let visible = false;
 let renderer = null;
 
+/** @type {GLOverlayLayer|null} */
+let layer = null;
+let lineBatch = null;
+let glyphBatch = null;
+/** View area the current geometry covers, null when a rebuild is needed */
+let built = null;
+
+/** Prebuilt area as a multiple of the visible half-diagonal */
+const BUILD_MARGIN = 3;
+
+const GRID_COLOR = [1, 1, 1, 0.12];
+const AXIS_COLOR = [1, 1, 1, 0.6];
+const LABEL_COLOR = [1, 1, 1, 0.7];
+const ORIGIN_LABEL_COLOR = [1, 1, 1, 0.8];
+
 /**
  * Initializes the axes overlay
- * @param {HTMLCanvasElement} canvasElement
  * @param {Object} fractalRenderer
  */
-export function init(canvasElement, fractalRenderer) {
-    canvas = canvasElement;
-    renderer = fractalRenderer;
-    if (canvas) {
-        ctx = canvas.getContext('2d');
-    }
+export function init(fractalRenderer) {
+    setRenderer(fractalRenderer);
 }
 
 /**
@@ -31,30 +43,30 @@ export function init(canvasElement, fractalRenderer) {
  * @param {Object} fractalRenderer
  */
 export function setRenderer(fractalRenderer) {
+    if (layer && renderer !== fractalRenderer) {
+        layer.deleteBatch(lineBatch);
+        layer.deleteBatch(glyphBatch);
+        lineBatch = glyphBatch = null;
+    }
     renderer = fractalRenderer;
+    layer = getOverlayLayer(renderer);
+    built = null;
 }
 
 /**
  * Shows the axes overlay
  */
 export function show() {
-    if (!canvas || !ctx) return;
+    if (!layer || !renderer) return;
 
-    canvas.width = window.innerWidth;
-    canvas.height = window.innerHeight;
-    canvas.classList.remove('axes-hidden');
     visible = true;
-
-    draw();
+    renderer.draw();
 }
 
 /**
- * Hides the axes overlay
+ * Hides the axes overlay. The grid disappears with the next frame.
  */
 export function hide() {
-    if (canvas) {
-        canvas.classList.add('axes-hidden');
-    }
     visible = false;
 }
 
@@ -65,6 +77,7 @@ export function hide() {
 export function toggle() {
     if (visible) {
         hide();
+        renderer?.draw();
     } else {
         show();
     }
@@ -73,7 +86,7 @@ export function toggle() {
 }
 
 /**
- * Updates the overlay (redraws if visible)
+ * Updates the overlay. Called after each fractal draw; draws into the same frame.
  */
 export function update() {
     if (!visible) return;
@@ -81,13 +94,10 @@ export function update() {
 }
 
 /**
- * Resizes the canvas and redraws
+ * Handles canvas resize. The aspect ratio may have changed, so the covered area is rebuilt.
  */
 export function resize() {
-    if (!visible || !canvas) return;
-    canvas.width = window.innerWidth;
-    canvas.height = window.innerHeight;
-    draw();
+    built = null;
 }
 
 /**
@@ -134,101 +144,83 @@ function formatAxisNumber(n) {
 }
 
 /**
- * Draws the coordinate axes with numbers
+ * Rebuilds grid lines and labels around the current pan for the given tick spacing.
+ * @param {number} tickSpacing
+ * @param {number} radius - Half-diagonal of the visible area in fractal units
  */
-function draw() {
-    if (!ctx || !canvas || !renderer) return;
-
-    const width = canvas.width;
-    const height = canvas.height;
-    const centerX = width / 2;
-    const centerY = height / 2;
-
-    ctx.clearRect(0, 0, width, height);
-
+function build(tickSpacing, radius) {
     const pan = renderer.pan;
-    const zoom = renderer.zoom;
-
-    // Calculate visible range
-    const aspect = width / height;
-    const halfWidth = zoom * aspect / 2;
-    const halfHeight = zoom / 2;
-    const left = pan[0] - halfWidth;
-    const right = pan[0] + halfWidth;
-    const top = pan[1] + halfHeight;
-    const bottom = pan[1] - halfHeight;
-
-    const tickSpacing = getTickSpacing(zoom);
-    const scale = height / zoom;
-
-    // Calculate main axis positions
-    const realAxisY = centerY - (0 - pan[1]) * scale;
-    const imagAxisX = centerX + (0 - pan[0]) * scale;
+    const extent = radius * BUILD_MARGIN;
+    const left = pan[0] - extent;
+    const right = pan[0] + extent;
+    const bottom = pan[1] - extent;
+    const top = pan[1] + extent;
 
-    // Clamp label positions
-    const labelPadding = 20;
-    const realAxisLabelY = Math.max(labelPadding, Math.min(height - labelPadding, realAxisY));
-    const imagAxisLabelX = Math.max(labelPadding + 30, Math.min(width - labelPadding - 30, imagAxisX));
-
-    // Grid lines style
-    ctx.strokeStyle = 'rgba(255, 255, 255, 0.12)';
-    ctx.lineWidth = 1;
-    ctx.font = '14px monospace';
-    ctx.fillStyle = 'rgba(255, 255, 255, 0.7)';
+    const lines = [];
+    const labels = [];
 
     // Vertical grid lines
-    ctx.textAlign = 'center';
-    ctx.textBaseline = 'top';
     const startX = Math.ceil(left / tickSpacing) * tickSpacing;
-    for (let x = startX; x <= right; x += tickSpacing) {
-        const screenX = centerX + (x - pan[0]) * scale;
-        ctx.beginPath();
-        ctx.moveTo(screenX, 0);
-        ctx.lineTo(screenX, height);
-        ctx.stroke();
-
+    for (let i = 0, x = startX; x <= right; x = startX + (++i) * tickSpacing) {
+        pushLine(lines, x, bottom, x, top, GRID_COLOR, 1);
         if (Math.abs(x) > tickSpacing * 0.1) {
-            const label = formatAxisNumber(x);
-            ctx.fillText(label, screenX, realAxisLabelY + 5);
+            labels.push({
+                x, y: 0, text: formatAxisNumber(x), size: 14, color: LABEL_COLOR,
+                dy: 5, align: 'center', baseline: 'top', clampY: 20
+            });
         }
     }
 
     // Horizontal grid lines
-    ctx.textAlign = 'left';
-    ctx.textBaseline = 'middle';
     const startY = Math.ceil(bottom / tickSpacing) * tickSpacing;
-    for (let y = startY; y <= top; y += tickSpacing) {
-        const screenY = centerY - (y - pan[1]) * scale;
-        ctx.beginPath();
-        ctx.moveTo(0, screenY);
-        ctx.lineTo(width, screenY);
-        ctx.stroke();
-
+    for (let i = 0, y = startY; y <= top; y = startY + (++i) * tickSpacing) {
+        pushLine(lines, left, y, right, y, GRID_COLOR, 1);
         if (Math.abs(y) > tickSpacing * 0.1) {
-            const label = formatAxisNumber(y) + 'i';
-            ctx.fillText(label, imagAxisLabelX + 5, screenY);
+            labels.push({
+                x: 0, y, text: formatAxisNumber(y) + 'i', size: 14, color: LABEL_COLOR,
+                dx: 5, align: 'left', baseline: 'middle', clampX: 50
+            });
         }
     }
 
     // Main axes
-    ctx.strokeStyle = 'rgba(255, 255, 255, 0.6)';
-    ctx.lineWidth = 2;
+    pushLine(lines, left, 0, right, 0, AXIS_COLOR, 2);
+    pushLine(lines, 0, bottom, 0, top, AXIS_COLOR, 2);
 
-    // Real axis
-    ctx.beginPath();
-    ctx.moveTo(0, realAxisY);
-    ctx.lineTo(width, realAxisY);
-    ctx.stroke();
+    // Origin label
+    labels.push({x: 0, y: 0, text: '0', size: 14, color: ORIGIN_LABEL_COLOR, dx: 5, dy: 5, baseline: 'top'});
 
-    // Imaginary axis
-    ctx.beginPath();
-    ctx.moveTo(imagAxisX, 0);
-    ctx.lineTo(imagAxisX, height);
-    ctx.stroke();
+    if (!lineBatch) lineBatch = layer.createLineBatch();
+    if (!glyphBatch) glyphBatch = layer.createGlyphBatch();
+    layer.setLines(lineBatch, lines, pan);
+    layer.setLabels(glyphBatch, labels, pan);
 
-    // Origin label
-    ctx.fillStyle = 'rgba(255, 255, 255, 0.8)';
-    ctx.textAlign = 'left';
-    ctx.textBaseline = 'top';
-    ctx.fillText('0', imagAxisX + 5, realAxisY + 5);
+    built = {tickSpacing, left, right, bottom, top};
+}
+
+/**
+ * Draws the coordinate axes with numbers into the current frame
+ */
+function draw() {
+    if (!layer || !renderer?.canvas) return;
+
+    const pan = renderer.pan;
+    const zoom = renderer.zoom;
+    const aspect = renderer.canvas.width / renderer.canvas.height;
+    const radius = zoom * 0.5 * Math.hypot(aspect, 1);
+    const tickSpacing = getTickSpacing(zoom);
+
+    const covered = built && built.tickSpacing === tickSpacing &&
+        pan[0] - radius >= built.left && pan[0] + radius <= built.right &&
+        pan[1] - radius >= built.bottom && pan[1] + radius <= built.top;
+
+    if (!covered) {
+        profiler.begin('axes.build');
+        build(tickSpacing, radius);
+        profiler.end();
+    }
+
+    profiler.begin('axes');
+    layer.draw(renderer, lineBatch, glyphBatch);
+    profiler.end();
 }
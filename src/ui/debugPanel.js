@@ -7,6 +7,9 @@ import {
     LOG_LEVEL
 } from "../global/constants";
 import {getFractalMode, isAnimationActive, isJuliaMode, isRiemannMode, isRosslerMode} from "./ui";
+import {profiler} from "../global/profiler";
+import {getGLCallStats, unwrapGL} from "../renderers/glCallCounter";
+import {exportTelemetry, getPresetStats, getTelemetryContext, isTelemetryEnabled} from "../global/telemetry";
 
 /**
  * Debug Panel
@@ -24,7 +27,8 @@ export class DebugPanel {
     constructor(canvas, fractalApp) {
         this.canvas = canvas;
         this.fractalApp = fractalApp;
-        this.gl = fractalApp?.gl;
+        // Own queries go to the unwrapped context so they don't show up in the GL call counters
+        this.gl = unwrapGL(fractalApp?.gl);
 
         this.debugInfo = document.getElementById(this.panelSelector);
         if (!this.debugInfo) {
@@ -45,6 +49,11 @@ export class DebugPanel {
         }
 
         this.debugInfo.addEventListener("auxclick", (event) => {
+            if (event.button === 1 && event.shiftKey) {
+                // Shift + middle-click: export stored telemetry (CSV + JSON)
+                void exportTelemetry();
+                return;
+            }
             if (event.button === 1) {
                 console.group('> DEBUG PANEL DUMP');
                 log(this.debugInfo.innerText, this.constructor.name, LOG_LEVEL.DEBUG);
@@ -57,14 +66,14 @@ export class DebugPanel {
                 }, function (err) {
                     log('Debug dump not copied to clipboard! ' + err.toString(), "", LOG_LEVEL.ERROR);
                 });
+
+                this.exportTrace();
             }
         });
 
-        // ---- Extensions / GPU info (cached) ----
-        this.extTimer =
-            this.gl?.getExtension("EXT_disjoint_timer_query") ||
-            this.gl?.getExtension("EXT_disjoint_timer_query_webgl2") ||
-            null;
+        // ---- Profiler (stage timing + GPU timer query ring) ----
+        profiler.enable(this.gl);
+        profiler.onGpuSample = this._onGpuSample;
 
         // Renderer info (optional, blocked in some browsers unless allowed)
         this.extRendererInfo =
@@ -104,15 +113,11 @@ export class DebugPanel {
             panelCpuMsSmoothed: NaN,
 
             // GPU timing via timer query (requires beginGpuTimer/endGpuTimer around draw)
-            gpuSupported: !!this.extTimer,
+            gpuSupported: profiler.gpuSupported,
             gpuMs: NaN,
             gpuMsSmoothed: NaN,
             gpuDisjoint: false,
             gpuLastUpdateTs: 0,  // timestamp of last GPU measurement
-
-            // Timer query bookkeeping
-            queryInFlight: null,
-            pendingQueries: [],
         };
 
         // Toggle visibility on creation
@@ -124,7 +129,11 @@ export class DebugPanel {
 
     setRenderer(renderer) {
         this.fractalApp = renderer || null;
-        this.gl = renderer?.gl || null;
+        this.gl = unwrapGL(renderer?.gl);
+        if (this.gl) {
+            profiler.setGL(this.gl);
+            this.perf.gpuSupported = profiler.gpuSupported;
+        }
     }
 
     _initGpuInfo() {
@@ -160,61 +169,47 @@ export class DebugPanel {
         }
     }
 
-    // ---- GPU timer query helpers ----
+    // ---- GPU timer query helpers (ring buffer lives in the profiler, every draw gets a query) ----
     beginGpuTimer() {
-        if (!this.extTimer || !this.gl) return;
-        if (this.perf.queryInFlight) return; // keep it simple: one in flight
-
         // Track draw calls for render FPS
         this.perf.drawCount++;
-
-        // EXT_disjoint_timer_query is async; begin/end must bracket the draw call
-        const q = this.extTimer.createQueryEXT();
-        this.extTimer.beginQueryEXT(this.extTimer.TIME_ELAPSED_EXT, q);
-        this.perf.queryInFlight = q;
+        profiler.beginGpu();
     }
 
     endGpuTimer() {
-        if (!this.extTimer || !this.gl) return;
-        if (!this.perf.queryInFlight) return;
-
-        this.extTimer.endQueryEXT(this.extTimer.TIME_ELAPSED_EXT);
-        this.perf.pendingQueries.push(this.perf.queryInFlight);
-        this.perf.queryInFlight = null;
+        profiler.endGpu();
     }
 
     pollGpuTimers() {
-        if (!this.extTimer || !this.gl) return;
-
-        // disjoint means the result is unreliable (clock reset / driver event)
-        const disjoint = this.gl.getParameter(this.extTimer.GPU_DISJOINT_EXT);
-        this.perf.gpuDisjoint = !!disjoint;
-
-        if (this.perf.pendingQueries.length === 0) return;
-
-        // Read the oldest query only (avoid stalls)
-        const q = this.perf.pendingQueries[0];
-        const available = this.extTimer.getQueryObjectEXT(
-            q,
-            this.extTimer.QUERY_RESULT_AVAILABLE_EXT
-        );
-        if (!available) return;
-
-        const ns = this.extTimer.getQueryObjectEXT(q, this.extTimer.QUERY_RESULT_EXT);
-        this.extTimer.deleteQueryEXT(q);
-        this.perf.pendingQueries.shift();
-
-        if (!this.perf.gpuDisjoint) {
-            const ms = ns / 1e6;
-            this.perf.gpuMs = ms;
-            this.perf.gpuMsSmoothed = this.smooth(this.perf.gpuMsSmoothed, ms, 0.15);
-            this.perf.gpuLastUpdateTs = performance.now();
-        } else {
+        profiler.pollGpu();
+        this.perf.gpuDisjoint = profiler.gpuDisjoint;
+        if (this.perf.gpuDisjoint) {
             this.perf.gpuMs = NaN;
             // keep previous smoothed value; disjoint is a transient condition
         }
     }
 
+    _onGpuSample = (ms) => {
+        this.perf.gpuMs = ms;
+        this.perf.gpuMsSmoothed = this.smooth(this.perf.gpuMsSmoothed, ms, 0.15);
+        this.perf.gpuLastUpdateTs = performance.now();
+    }
+
+    /** Downloads the recorded profiler trace as chrome://tracing compatible JSON. */
+    exportTrace() {
+        const trace = profiler.toChromeTrace();
+        const blob = new Blob([JSON.stringify(trace)], {type: 'application/json'});
+        const url = URL.createObjectURL(blob);
+
+        const link = document.createElement('a');
+        link.setAttribute('download', `fractal-trace-${Date.now()}.json`);
+        link.setAttribute('href', url);
+        link.click();
+        setTimeout(() => URL.revokeObjectURL(url), 0);
+
+        log(`Profiler trace exported (${trace.traceEvents.length} events).`, this.constructor.name, LOG_LEVEL.DEBUG);
+    }
+
     smooth(prev, next, alpha) {
         if (!Number.isFinite(next)) return prev;
         if (!Number.isFinite(prev)) return next;
@@ -229,6 +224,9 @@ export class DebugPanel {
         // Poll GPU timers first (results arrive later)
         this.pollGpuTimers();
 
+        // Close the GL call counting frame (debug FULL builds only)
+        getGLCallStats(this.fractalApp.gl)?.endFrame();
+
         // rAF timing (debug panel update rate)
         const dt = ts - this.perf.lastRafTs;
         this.perf.lastRafTs = ts;
@@ -453,6 +451,9 @@ export class DebugPanel {
             <span class="dbg-title">renderFPS</span>=<span class="${levelClass(fpsLevel)}">${esc(this.perf.renderFps.toFixed(1))}</span> <span class="dbg-dim">(rAF=${esc(this.perf.fps.toFixed(0))})</span><br/>
             <span class="dbg-title">GPU</span>=<span class="${levelClass(gpuLevel)}">${this._renderGpuTime(gpuSmooth)}</span> <span class="dbg-dim">${esc(gpuHint)}</span><br/>
             ${this._renderAdaptiveQuality()}<br/>
+            ${this._renderTelemetry()}
+            ${this._renderGLCalls()}
+            ${this._renderStages()}
             `;
 
         requestAnimationFrame(this.update);
@@ -503,6 +504,78 @@ export class DebugPanel {
         return `<span class="dbg-title">adaptQ</span>: <span class="${qualityClass}">${extraIters > 0 ? '+' : ''}${extraIters}</span> <span class="dbg-dim">[${adaptiveMin}..+${maxExtra}]</span> <span class="dbg-dim">(${qualityPct}%)</span> <span class="${stateClass}">[${state}]</span> <span class="dbg-dim">[${minFps}&larr;${targetFps} FPS]</span>`;
     }
 
+    /**
+     * Renders the stored per-preset percentiles of the current telemetry context.
+     * @returns {string} HTML string for telemetry status
+     */
+    _renderTelemetry() {
+        if (!isTelemetryEnabled()) {
+            return `<span class="dbg-title">telemetry</span>: <span class="dbg-dim">OFF (Shift+L to record)</span><br/>`;
+        }
+
+        const ctx = getTelemetryContext();
+        const stats = getPresetStats(ctx.mode, ctx.presetId);
+        const fmt = (v) => Number.isFinite(v) ? v.toFixed(1) : 'n/a';
+        const summary = stats
+            ? `frame ${stats.frame.map(fmt).join('/')} gpu ${stats.gpu.map(fmt).join('/')} ms <span class="dbg-dim">(p50/p95/p99, n=${esc(stats.count)})</span>`
+            : '<span class="dbg-dim">no history yet</span>';
+
+        return `<span class="dbg-title">telemetry</span>: <span class="dbg-ok">REC</span> ` +
+            `<span class="dbg-dim">${esc(ctx.mode)}/${esc(ctx.presetId ?? '-')}</span> ${summary} ` +
+            `<span class="dbg-dim">(Shift+middle-click to export)</span><br/>`;
+    }
+
+    /**
+     * Renders per-frame GL call totals and redundant state changes from the counting context.
+     * @returns {string} HTML string, empty when the context is not instrumented
+     */
+    _renderGLCalls() {
+        const stats = getGLCallStats(this.fractalApp.gl);
+        if (!stats) return '';
+
+        const f = stats.lastFrame;
+        const redundant = f.redundantUniforms + f.redundantBinds;
+        const redundantClass = redundant > 0 ? 'dbg-warn' : 'dbg-ok';
+        const top = stats.topCalls().map(([name, n]) => `${esc(name)}:${esc(n)}`).join(' ');
+        const worstUniforms = Object.entries(f.redundantByUniform)
+            .sort((a, b) => b[1] - a[1]).slice(0, 4)
+            .map(([name, n]) => `${esc(name)}×${esc(n)}`).join(' ');
+
+        return `<br/><span class="dbg-title">———— GL calls / frame ————</span><br/>` +
+            `<span class="dbg-title">total</span>=${esc(f.total)} ` +
+            `<span class="dbg-title">redundant</span>=<span class="${redundantClass}">${esc(redundant)}</span> ` +
+            `<span class="dbg-dim">(uniform=${esc(f.redundantUniforms)}, bind=${esc(f.redundantBinds)})</span> ` +
+            `<span class="dbg-title">texReupload</span>=<span class="${f.textureReuploads > 0 ? 'dbg-warn' : 'dbg-ok'}">${esc(f.textureReuploads)}</span><br/>` +
+            `<span class="dbg-dim">${top}</span><br/>` +
+            (worstUniforms ? `<span class="dbg-dim">same-value uniforms: ${worstUniforms}</span><br/>` : '');
+    }
+
+    /**
+     * Renders the per-stage profiler table (p50/p95/p99 over the last samples) with a log2 histogram sparkline.
+     * @returns {string} HTML string for stage timings
+     */
+    _renderStages() {
+        const rows = profiler.summary();
+        if (rows.length === 0) return '';
+
+        const bars = '▁▂▃▄▅▆▇█';
+        const fmt = (ms) => Number.isFinite(ms) ? ms.toFixed(2) : 'n/a';
+
+        let html = `<br/><span class="dbg-title">———— Stages (ms p50/p95/p99) ————</span><br/>`;
+        for (const row of rows) {
+            const peak = Math.max(1, ...row.histogram);
+            const spark = row.histogram.map(c => c === 0 ? '·' : bars[Math.min(7, Math.floor((c / peak) * 7))]).join('');
+            const level = row.p95 > 16 ? 'dbg-bad' : row.p95 > 8 ? 'dbg-warn' : 'dbg-ok';
+            html += `<span class="dbg-title">${esc(row.name.padEnd(10, ' ')).replace(/ /g, '&nbsp;')}</span>` +
+                `<span class="${level}">${esc(fmt(row.p50))}/${esc(fmt(row.p95))}/${esc(fmt(row.p99))}</span> ` +
+                `<span class="dbg-dim">${spark} n=${esc(row.count)}</span><br/>`;
+        }
+        if (profiler.gpuDropped > 0) {
+            html += `<span class="dbg-dim">gpu queries dropped: ${esc(profiler.gpuDropped)}</span><br/>`;
+        }
+        return html;
+    }
+
     /**
      * Renders GPU time with staleness indicator.
      * @param {number} gpuSmooth - Smoothed GPU time in ms
@@ -0,0 +1,107 @@
+/**
+ * @module FrameCache
+ * @author Radim Brnka
+ * @description Finished frames of views reached from presets or shared links, kept in the persistent render cache.
+ * When the app boots into such a view again (a reloaded kiosk, a re-opened link), the stored frame is shown over the
+ * canvas while the renderer compiles its shaders and travels in, then fades out.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {cacheGet, cachePut, getStoredKeys, isRenderCacheAvailable, viewStateKey} from "../global/renderCache";
+import {FRACTAL_TYPE, log} from "../global/constants";
+
+/** Encoding of stored frames */
+const FRAME_TYPE = 'image/webp';
+const FRAME_QUALITY = 0.9;
+/** Fade-out of a shown frame (ms), matches the #cachedFrame transition */
+const FRAME_FADE = 600;
+
+/** @type {Set<string>} Frames encoded this session (the view does not change under the same key) */
+const storedThisSession = new Set();
+
+/**
+ * Key of the frame of a view. Numbers go through the same 17-digit form the URL uses, so a view read back from the
+ * URL matches the view it was written from.
+ * @param {{mode: number, pan: number[], zoom: number, rotation: number, c?: number[]|null, paletteId?: string|null}} view
+ * @returns {string}
+ */
+function frameKey(view) {
+    const n = value => Number(Number(value).toPrecision(17));
+    return viewStateKey('frame', {
+        mode: view.mode,
+        pan: view.pan.map(n),
+        zoom: n(view.zoom),
+        rotation: n(view.rotation ?? 0),
+        c: view.mode === FRACTAL_TYPE.JULIA && view.c ? view.c.map(n) : null,
+        paletteId: view.paletteId ?? null,
+        width: window.innerWidth,
+        height: window.innerHeight
+    });
+}
+
+/**
+ * Stores the frame of the view the renderer currently shows, once per session.
+ * @param {FractalRenderer} fractalApp
+ * @param {number} mode
+ * @param {string|null} paletteId
+ */
+export function storeViewFrame(fractalApp, mode, paletteId) {
+    if (!isRenderCacheAvailable() || !fractalApp?.canvas) return;
+
+    const key = frameKey({mode, pan: fractalApp.pan, zoom: fractalApp.zoom, rotation: fractalApp.rotation, c: fractalApp.c, paletteId});
+    if (storedThisSession.has(key)) return;
+    storedThisSession.add(key);
+
+    // The drawing buffer is only readable in the task that drew it
+    fractalApp.draw();
+    const copy = document.createElement('canvas');
+    copy.width = fractalApp.canvas.width;
+    copy.height = fractalApp.canvas.height;
+    const ctx = copy.getContext('2d');
+    if (!ctx) return;
+    ctx.drawImage(fractalApp.canvas, 0, 0);
+
+    copy.toBlob(blob => {
+        if (blob) cachePut(key, 'frame', blob, blob.size);
+    }, FRAME_TYPE, FRAME_QUALITY);
+}
+
+/**
+ * Shows the stored frame of a view over the canvas, if there is one. Resolves once it is painted, so work that
+ * blocks the main thread afterwards (shader compilation) happens with the frame on screen.
+ * @param {{mode: number, pan: number[], zoom: number, rotation: number, c?: number[]|null, paletteId?: string|null}} view
+ * @returns {Promise<function(): void>} Fades the frame out again (no-op if none was shown)
+ */
+export async function showCachedFrame(view) {
+    const noop = () => {
+    };
+    const img = document.getElementById('cachedFrame');
+    if (!img || !isRenderCacheAvailable()) return noop;
+
+    const key = frameKey(view);
+    if (!(await getStoredKeys('frame')).has(key)) return noop;
+    const blob = await cacheGet(key);
+    if (!blob) return noop;
+
+    const url = URL.createObjectURL(blob);
+    img.src = url;
+    try {
+        await img.decode();
+    } catch (e) {
+        URL.revokeObjectURL(url);
+        return noop;
+    }
+    img.classList.add('visible');
+    await new Promise(resolve => requestAnimationFrame(() => setTimeout(resolve)));
+    log('Showing stored frame.', 'FrameCache');
+
+    return () => {
+        img.classList.add('fading');
+        setTimeout(() => {
+            img.classList.remove('visible', 'fading');
+            img.removeAttribute('src');
+            URL.revokeObjectURL(url);
+        }, FRAME_FADE);
+    };
+}
@@ -0,0 +1,503 @@
+/**
+ * @module GLOverlayLayer
+ * @author Radim Brnka
+ * @description Overlay layer drawn inside the fractal renderer's WebGL context, right after the fractal quad.
+ * Overlays hand over line segments and text labels in fractal space once; the layer uploads them into
+ * static buffers and every subsequent frame only updates the pan/zoom/rotation uniforms. Lines are
+ * expanded into quads on the GPU (instanced where ANGLE_instanced_arrays exists), labels are textured
+ * quads sampled from a glyph atlas rasterized once per context.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log} from '../global/constants';
+import lineVertexSource from '../shaders/overlayLine.vert';
+import lineFragmentSource from '../shaders/overlayLine.frag';
+import glyphVertexSource from '../shaders/overlayGlyph.vert';
+import glyphFragmentSource from '../shaders/overlayGlyph.frag';
+
+/** Floats per line instance: p0.xy, p1.xy, rgba, width */
+const LINE_STRIDE = 9;
+/** Floats per expanded line vertex (no instancing): corner.xy + instance data */
+const LINE_EXPANDED_STRIDE = 2 + LINE_STRIDE;
+/** Floats per glyph vertex: anchor.xy, offset.xy, uv, rgba, flags */
+const GLYPH_STRIDE = 14;
+
+/** Two triangles covering the segment quad, as (along, across) corners */
+const LINE_CORNERS = [0, -1, 1, -1, 0, 1, 0, 1, 1, -1, 1, 1];
+
+const ATLAS_FONT_PX = 32;
+const ATLAS_WIDTH = 512;
+const ATLAS_HEIGHT = 256;
+const ATLAS_EXTRA_CHARS = 'ζ½';
+/** Ascent as a fraction of the font size, used for the alphabetic baseline */
+const ASCENT = 0.8;
+
+/** @type {WeakMap<Object, GLOverlayLayer>} */
+const layers = new WeakMap();
+
+/**
+ * Returns the overlay layer bound to the renderer's GL context, creating it on first use.
+ * @param {Object} renderer - Fractal renderer owning the WebGL context
+ * @returns {GLOverlayLayer|null} null if the renderer has no usable context
+ */
+export function getOverlayLayer(renderer) {
+    if (!renderer?.gl) return null;
+
+    let layer = layers.get(renderer);
+    if (!layer || layer.gl !== renderer.gl) {
+        layer = new GLOverlayLayer(renderer.gl);
+        if (!layer.init()) return null;
+        layers.set(renderer, layer);
+    }
+    return layer;
+}
+
+/**
+ * Appends a line segment to a plain array in the layout expected by {@link GLOverlayLayer#setLines}.
+ * @param {number[]} out
+ * @param {number} x0
+ * @param {number} y0
+ * @param {number} x1
+ * @param {number} y1
+ * @param {number[]} color - [r, g, b, a] in 0..1
+ * @param {number} width - CSS pixels
+ */
+export function pushLine(out, x0, y0, x1, y1, color, width) {
+    out.push(x0, y0, x1, y1, color[0], color[1], color[2], color[3], width);
+}
+
+/**
+ * Appends a polyline to a segment array, breaking it wherever two consecutive points are non-finite
+ * or further apart than breakDistance.
+ * @param {number[]} out
+ * @param {number[]} points - Flat [x0, y0, x1, y1, ...]
+ * @param {number} breakDistance
+ * @param {number[]} color
+ * @param {number} width
+ */
+export function pushPolyline(out, points, breakDistance, color, width) {
+    for (let i = 2; i < points.length; i += 2) {
+        const x0 = points[i - 2], y0 = points[i - 1];
+        const x1 = points[i], y1 = points[i + 1];
+        if (!Number.isFinite(x0 + y0 + x1 + y1)) continue;
+        if (Math.hypot(x1 - x0, y1 - y0) > breakDistance) continue;
+        pushLine(out, x0, y0, x1, y1, color, width);
+    }
+}
+
+export class GLOverlayLayer {
+
+    /**
+     * @param {WebGLRenderingContext} gl
+     */
+    constructor(gl) {
+        this.gl = gl;
+        /** @type {ANGLE_instanced_arrays|null} */
+        this.instancing = null;
+
+        this.lineProgram = null;
+        this.glyphProgram = null;
+        this.cornerBuffer = null;
+        this.atlasTexture = null;
+        /** @type {Map<string, {u0: number, v0: number, u1: number, v1: number, advance: number}>} */
+        this.glyphs = new Map();
+        this.lineHeight = ATLAS_FONT_PX;
+    }
+
+    /**
+     * Compiles the programs and builds the glyph atlas.
+     * @returns {boolean} false if the layer cannot be used in this context
+     */
+    init() {
+        const gl = this.gl;
+
+        this.lineProgram = this._createProgram(lineVertexSource, lineFragmentSource, [
+            'a_corner', 'a_segment', 'a_color', 'a_width'
+        ]);
+        this.glyphProgram = this._createProgram(glyphVertexSource, glyphFragmentSource, [
+            'a_anchor', 'a_offset', 'a_uv', 'a_color', 'a_flags'
+        ]);
+        if (!this.lineProgram || !this.glyphProgram) return false;
+
+        this.instancing = gl.getExtension('ANGLE_instanced_arrays');
+        if (this.instancing) {
+            this.cornerBuffer = gl.createBuffer();
+            gl.bindBuffer(gl.ARRAY_BUFFER, this.cornerBuffer);
+            gl.bufferData(gl.ARRAY_BUFFER, new Float32Array(LINE_CORNERS), gl.STATIC_DRAW);
+        }
+
+        this._buildAtlas();
+
+        log(`Initialized (instancing: ${!!this.instancing}, atlas: ${this.glyphs.size} glyphs).`, 'GLOverlayLayer');
+        return true;
+    }
+
+    /**
+     * @returns {{buffer: WebGLBuffer, count: number, origin: number[]}}
+     */
+    createLineBatch() {
+        return {buffer: this.gl.createBuffer(), count: 0, origin: [0, 0]};
+    }
+
+    /**
+     * @returns {{buffer: WebGLBuffer, count: number, origin: number[]}}
+     */
+    createGlyphBatch() {
+        return {buffer: this.gl.createBuffer(), count: 0, origin: [0, 0]};
+    }
+
+    /**
+     * Uploads line segments into a batch. Coordinates are absolute fractal coordinates; they are stored
+     * relative to the origin so float32 keeps full precision around it.
+     * @param {Object} batch - From {@link createLineBatch}
+     * @param {number[]} segments - Built with {@link pushLine}
+     * @param {number[]} origin - Usually the pan at build time
+     */
+    setLines(batch, segments, origin) {
+        const gl = this.gl;
+        const count = Math.floor(segments.length / LINE_STRIDE);
+        const [ox, oy] = origin;
+
+        let data;
+        if (this.instancing) {
+            data = new Float32Array(count * LINE_STRIDE);
+            for (let i = 0; i < count; i++) {
+                const s = i * LINE_STRIDE;
+                data[s] = segments[s] - ox;
+                data[s + 1] = segments[s + 1] - oy;
+                data[s + 2] = segments[s + 2] - ox;
+                data[s + 3] = segments[s + 3] - oy;
+                for (let k = 4; k < LINE_STRIDE; k++) data[s + k] = segments[s + k];
+            }
+        } else {
+            data = new Float32Array(count * 6 * LINE_EXPANDED_STRIDE);
+            let d = 0;
+            for (let i = 0; i < count; i++) {
+                const s = i * LINE_STRIDE;
+                for (let c = 0; c < 6; c++) {
+                    data[d++] = LINE_CORNERS[c * 2];
+                    data[d++] = LINE_CORNERS[c * 2 + 1];
+                    data[d++] = segments[s] - ox;
+                    data[d++] = segments[s + 1] - oy;
+                    data[d++] = segments[s + 2] - ox;
+                    data[d++] = segments[s + 3] - oy;
+                    for (let k = 4; k < LINE_STRIDE; k++) data[d++] = segments[s + k];
+                }
+            }
+        }
+
+        gl.bindBuffer(gl.ARRAY_BUFFER, batch.buffer);
+        gl.bufferData(gl.ARRAY_BUFFER, data, gl.STATIC_DRAW);
+        batch.count = count;
+        batch.origin = [ox, oy];
+    }
+
+    /**
+     * Lays out labels into glyph quads and uploads them into a batch.
+     *
+     * Label fields: x, y (anchor), text, size (CSS px), color [r,g,b,a], and optionally
+     * dx, dy (CSS px offset, y down), align ('left'|'center'), baseline ('top'|'middle'|'alphabetic'),
+     * screen (anchor is CSS px from the bottom-left corner), clampX / clampY (edge padding to clamp
+     * the anchor to), cull (hide the label when its anchor is closer to an edge than this).
+     *
+     * @param {Object} batch - From {@link createGlyphBatch}
+     * @param {Array<Object>} labels
+     * @param {number[]} origin
+     */
+    setLabels(batch, labels, origin) {
+        const gl = this.gl;
+        const [ox, oy] = origin;
+        if (this.glyphs.size === 0) {
+            batch.count = 0;
+            return;
+        }
+
+        let glyphCount = 0;
+        for (const label of labels) glyphCount += label.text.length;
+
+        const data = new Float32Array(glyphCount * 6 * GLYPH_STRIDE);
+        let d = 0;
+        let quads = 0;
+
+        for (const label of labels) {
+            const scale = label.size / ATLAS_FONT_PX;
+            const glyphs = Array.from(label.text, ch => this.glyphs.get(ch) || this.glyphs.get('?'));
+            const textWidth = glyphs.reduce((sum, g) => sum + g.advance * scale, 0);
+            const h = this.lineHeight * scale;
+
+            let penX = (label.dx || 0) - (label.align === 'center' ? textWidth / 2 : 0);
+            let top = label.dy || 0;
+            if (label.baseline === 'middle') top -= h / 2;
+            else if (label.baseline === 'alphabetic') top -= label.size * ASCENT;
+
+            const ax = label.screen ? label.x : label.x - ox;
+            const ay = label.screen ? label.y : label.y - oy;
+            const flags = [label.screen ? 1 : 0, label.clampX || 0, label.clampY || 0, label.cull || 0];
+            const color = label.color;
+
+            for (const g of glyphs) {
+                const w = g.advance * scale;
+                const corners = [
+                    [penX, top, g.u0, g.v0], [penX + w, top, g.u1, g.v0], [penX, top + h, g.u0, g.v1],
+                    [penX, top + h, g.u0, g.v1], [penX + w, top, g.u1, g.v0], [penX + w, top + h, g.u1, g.v1]
+                ];
+                for (const [cx, cy, u, v] of corners) {
+                    data[d++] = ax;
+                    data[d++] = ay;
+                    data[d++] = cx;
+                    data[d++] = cy;
+                    data[d++] = u;
+                    data[d++] = v;
+                    data[d++] = color[0];
+                    data[d++] = color[1];
+                    data[d++] = color[2];
+                    data[d++] = color[3];
+                    data[d++] = flags[0];
+                    data[d++] = flags[1];
+                    data[d++] = flags[2];
+                    data[d++] = flags[3];
+                }
+                penX += w;
+                quads++;
+            }
+        }
+
+        gl.bindBuffer(gl.ARRAY_BUFFER, batch.buffer);
+        gl.bufferData(gl.ARRAY_BUFFER, data, gl.STATIC_DRAW);
+        batch.count = quads;
+        batch.origin = [ox, oy];
+    }
+
+    /**
+     * Draws batches over the current frame of the renderer, then restores the renderer's GL state.
+     * Must be called after the fractal quad was drawn (e.g. from onDrawCallback).
+     * @param {Object} renderer
+     * @param {Object|null} lineBatch
+     * @param {Object|null} glyphBatch
+     */
+    draw(renderer, lineBatch, glyphBatch) {
+        const gl = this.gl;
+        if (!renderer?.canvas) return;
+
+        const width = renderer.canvas.width;
+        const height = renderer.canvas.height;
+        const pixelRatio = width / (renderer.canvas.clientWidth || width);
+
+        gl.enable(gl.BLEND);
+        gl.blendFunc(gl.SRC_ALPHA, gl.ONE_MINUS_SRC_ALPHA);
+
+        if (lineBatch?.count) {
+            this._useProgram(this.lineProgram, renderer, lineBatch.origin, width, height, pixelRatio);
+            this._drawLines(lineBatch);
+        }
+        if (glyphBatch?.count) {
+            this._useProgram(this.glyphProgram, renderer, glyphBatch.origin, width, height, pixelRatio);
+            this._drawGlyphs(glyphBatch);
+        }
+
+        gl.disable(gl.BLEND);
+        renderer.bindFullscreenQuad();
+    }
+
+    /**
+     * Releases a batch buffer.
+     * @param {Object|null} batch
+     */
+    deleteBatch(batch) {
+        if (batch?.buffer) this.gl.deleteBuffer(batch.buffer);
+    }
+
+    // region > Internals ----------------------------------------------------------------------------------------------
+
+    /**
+     * @param {string} vsSource
+     * @param {string} fsSource
+     * @param {string[]} attributes
+     * @returns {{program: WebGLProgram, attribs: Object<string, number>, uniforms: Object<string, WebGLUniformLocation>}|null}
+     * @private
+     */
+    _createProgram(vsSource, fsSource, attributes) {
+        const gl = this.gl;
+        const compile = (source, type) => {
+            const shader = gl.createShader(type);
+            gl.shaderSource(shader, source);
+            gl.compileShader(shader);
+            if (!gl.getShaderParameter(shader, gl.COMPILE_STATUS)) {
+                console.error(gl.getShaderInfoLog(shader));
+                gl.deleteShader(shader);
+                return null;
+            }
+            return shader;
+        };
+
+        const vs = compile(vsSource, gl.VERTEX_SHADER);
+        const fs = compile(fsSource, gl.FRAGMENT_SHADER);
+        if (!vs || !fs) return null;
+
+        const program = gl.createProgram();
+        gl.attachShader(program, vs);
+        gl.attachShader(program, fs);
+        gl.linkProgram(program);
+        if (!gl.getProgramParameter(program, gl.LINK_STATUS)) {
+            console.error(gl.getProgramInfoLog(program));
+            return null;
+        }
+
+        const attribs = {};
+        for (const name of attributes) attribs[name] = gl.getAttribLocation(program, name);
+
+        const uniforms = {};
+        for (const name of ['u_resolution', 'u_offset', 'u_zoom', 'u_rotation', 'u_pixelRatio', 'u_atlas']) {
+            uniforms[name] = gl.getUniformLocation(program, name);
+        }
+
+        return {program, attribs, uniforms};
+    }
+
+    /**
+     * Activates a program and uploads the view transform. The offset is computed in float64 so the
+     * float32 geometry stays precise around the batch origin.
+     * @private
+     */
+    _useProgram(p, renderer, origin, width, height, pixelRatio) {
+        const gl = this.gl;
+        gl.useProgram(p.program);
+        gl.uniform2f(p.uniforms.u_resolution, width, height);
+        gl.uniform2f(p.uniforms.u_offset, origin[0] - renderer.pan[0], origin[1] - renderer.pan[1]);
+        gl.uniform1f(p.uniforms.u_zoom, renderer.zoom);
+        gl.uniform1f(p.uniforms.u_rotation, renderer.rotation || 0);
+        gl.uniform1f(p.uniforms.u_pixelRatio, pixelRatio);
+    }
+
+    /** @private */
+    _drawLines(batch) {
+        const gl = this.gl;
+        const {attribs} = this.lineProgram;
+        const F = Float32Array.BYTES_PER_ELEMENT;
+
+        if (this.instancing) {
+            const ext = this.instancing;
+
+            gl.bindBuffer(gl.ARRAY_BUFFER, this.cornerBuffer);
+            gl.enableVertexAttribArray(attribs.a_corner);
+            gl.vertexAttribPointer(attribs.a_corner, 2, gl.FLOAT, false, 0, 0);
+
+            gl.bindBuffer(gl.ARRAY_BUFFER, batch.buffer);
+            this._pointer(attribs.a_segment, 4, LINE_STRIDE * F, 0);
+            this._pointer(attribs.a_color, 4, LINE_STRIDE * F, 4 * F);
+            this._pointer(attribs.a_width, 1, LINE_STRIDE * F, 8 * F);
+            ext.vertexAttribDivisorANGLE(attribs.a_segment, 1);
+            ext.vertexAttribDivisorANGLE(attribs.a_color, 1);
+            ext.vertexAttribDivisorANGLE(attribs.a_width, 1);
+
+            ext.drawArraysInstancedANGLE(gl.TRIANGLES, 0, 6, batch.count);
+
+            // Divisors are global attribute state; leave them clean for the fractal quad
+            ext.vertexAttribDivisorANGLE(attribs.a_segment, 0);
+            ext.vertexAttribDivisorANGLE(attribs.a_color, 0);
+            ext.vertexAttribDivisorANGLE(attribs.a_width, 0);
+        } else {
+            const stride = LINE_EXPANDED_STRIDE * F;
+            gl.bindBuffer(gl.ARRAY_BUFFER, batch.buffer);
+            this._pointer(attribs.a_corner, 2, stride, 0);
+            this._pointer(attribs.a_segment, 4, stride, 2 * F);
+            this._pointer(attribs.a_color, 4, stride, 6 * F);
+            this._pointer(attribs.a_width, 1, stride, 10 * F);
+
+            gl.drawArrays(gl.TRIANGLES, 0, batch.count * 6);
+        }
+
+        this._disable(attribs);
+    }
+
+    /** @private */
+    _drawGlyphs(batch) {
+        const gl = this.gl;
+        const {attribs, uniforms} = this.glyphProgram;
+        const stride = GLYPH_STRIDE * Float32Array.BYTES_PER_ELEMENT;
+        const F = Float32Array.BYTES_PER_ELEMENT;
+
+        gl.activeTexture(gl.TEXTURE2);
+        gl.bindTexture(gl.TEXTURE_2D, this.atlasTexture);
+        gl.uniform1i(uniforms.u_atlas, 2);
+
+        gl.bindBuffer(gl.ARRAY_BUFFER, batch.buffer);
+        this._pointer(attribs.a_anchor, 2, stride, 0);
+        this._pointer(attribs.a_offset, 2, stride, 2 * F);
+        this._pointer(attribs.a_uv, 2, stride, 4 * F);
+        this._pointer(attribs.a_color, 4, stride, 6 * F);
+        this._pointer(attribs.a_flags, 4, stride, 10 * F);
+
+        gl.drawArrays(gl.TRIANGLES, 0, batch.count * 6);
+
+        this._disable(attribs);
+        gl.activeTexture(gl.TEXTURE0);
+    }
+
+    /** @private */
+    _pointer(loc, size, stride, offset) {
+        if (loc < 0) return;
+        this.gl.enableVertexAttribArray(loc);
+        this.gl.vertexAttribPointer(loc, size, this.gl.FLOAT, false, stride, offset);
+    }
+
+    /** @private */
+    _disable(attribs) {
+        for (const loc of Object.values(attribs)) {
+            if (loc >= 0) this.gl.disableVertexAttribArray(loc);
+        }
+    }
+
+    /**
+     * Rasterizes printable ASCII plus the few symbols the overlays use into an alpha texture.
+     * @private
+     */
+    _buildAtlas() {
+        const gl = this.gl;
+        const canvas = document.createElement('canvas');
+        canvas.width = ATLAS_WIDTH;
+        canvas.height = ATLAS_HEIGHT;
+        const ctx = canvas.getContext('2d');
+        if (!ctx) return;
+
+        ctx.font = `${ATLAS_FONT_PX}px monospace`;
+        ctx.textBaseline = 'top';
+        ctx.fillStyle = '#fff';
+
+        const chars = [];
+        for (let c = 32; c < 127; c++) chars.push(String.fromCharCode(c));
+        chars.push(...ATLAS_EXTRA_CHARS);
+
+        const cellH = Math.ceil(ATLAS_FONT_PX * 1.25);
+        let x = 0, y = 0;
+        for (const ch of chars) {
+            const advance = Math.ceil(ctx.measureText(ch).width);
+            if (x + advance + 2 > ATLAS_WIDTH) {
+                x = 0;
+                y += cellH;
+            }
+            ctx.fillText(ch, x + 1, y + 1);
+            this.glyphs.set(ch, {
+                u0: (x + 1) / ATLAS_WIDTH,
+                v0: (y + 1) / ATLAS_HEIGHT,
+                u1: (x + 1 + advance) / ATLAS_WIDTH,
+                v1: (y + 1 + cellH - 2) / ATLAS_HEIGHT,
+                advance
+            });
+            x += advance + 2;
+        }
+        this.lineHeight = cellH - 2;
+
+        this.atlasTexture = gl.createTexture();
+        gl.bindTexture(gl.TEXTURE_2D, this.atlasTexture);
+        gl.pixelStorei(gl.UNPACK_FLIP_Y_WEBGL, false);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, gl.RGBA, gl.UNSIGNED_BYTE, canvas);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.LINEAR);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+    }
+
+    // endregion--------------------------------------------------------------------------------------------------------
+}
@@ -24,8 +24,10 @@ import {
     reset,
     resetAppState,
     showEditCoordsDialog,
+    showPosterDialog,
     showQuickInfo,
     showSaveViewDialog,
+    showVideoDialog,
     startJuliaDive,
     switchFractalMode,
     switchFractalTypeWithPersistence,
@@ -56,7 +58,7 @@ import {
     log,
     ROTATION_DIRECTION
 } from "../global/constants";
-import {JuliaRenderer} from "../renderers/juliaRenderer";
+import {isTelemetryEnabled, setTelemetryEnabled} from "../global/telemetry";
 
 //region CONSTANTS > ---------------------------------------------------------------------------------------------------
 /**
@@ -205,8 +207,17 @@ async function onKeyDown(event) {
             handled = true;
             break;
 
-        case 'KeyL': // DEBUG BAR toggle
-            toggleDebugMode();
+        case 'KeyL': // DEBUG BAR toggle / Toggle local telemetry recording (Shift)
+            if (event.shiftKey) {
+                setTelemetryEnabled(!isTelemetryEnabled());
+                showQuickInfo(
+                    `Telemetry: ${isTelemetryEnabled() ? 'ON' : 'OFF'}`,
+                    isTelemetryEnabled() ? 'Recording frame times locally (IndexedDB)' : 'Recording stopped',
+                    fractalApp.PALETTES?.[fractalApp.currentPaletteIndex ?? 0]?.keyColor
+                );
+            } else {
+                toggleDebugMode();
+            }
             handled = true;
             break;
 
@@ -279,9 +290,11 @@ async function onKeyDown(event) {
             handled = true;
             break;
 
-        case 'KeyC': // Copy info / Capture screenshot
+        case 'KeyC': // Copy info / Poster export / Capture screenshot
             if (event.ctrlKey) {
                 copyInfoToClipboard();
+            } else if (event.shiftKey) {
+                await showPosterDialog();
             } else {
                 captureScreenshot();
             }
@@ -295,7 +308,8 @@ async function onKeyDown(event) {
 
         case 'KeyB': // Julia legacy renderer toggle / Riemann precision toggle
             if (isJuliaMode() && DEBUG_MODE === DEBUG_LEVEL.FULL) {
-                JuliaRenderer.FF_LEGACY_JULIA_RENDERER = !JuliaRenderer.FF_LEGACY_JULIA_RENDERER
+                // The Julia renderer class lives in the lazily loaded Julia chunk
+                fractalApp.constructor.FF_LEGACY_JULIA_RENDERER = !fractalApp.constructor.FF_LEGACY_JULIA_RENDERER
                 await switchFractalMode(FRACTAL_TYPE.JULIA);
             } else if (isRiemannMode()) {
                 toggleDoublePrecision();
@@ -344,8 +358,12 @@ async function onKeyDown(event) {
             break;
 
 
-        case 'KeyV': // Cycle to next view/preset
-            await cycleToNextPreset();
+        case 'KeyV': // Cycle to next view/preset / Video export (Shift)
+            if (event.shiftKey) {
+                await showVideoDialog();
+            } else {
+                await cycleToNextPreset();
+            }
             handled = true;
             break;
 
@@ -6,8 +6,8 @@
  * @license MIT
  */
 
-import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE} from "../global/constants";
-import {JuliaPreviewRenderer} from "../renderers/juliaPreviewRenderer";
+import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, FRACTAL_TYPE} from "../global/constants";
+import {getLoadedMode} from "../renderers/modeLoader";
 
 /** @type {HTMLCanvasElement} */
 let floatingCanvas = null;
@@ -63,6 +63,8 @@ export function showJuliaPreview(screenX, screenY, cx, cy) {
 
     // Create renderer on first show
     if (!previewRenderer) {
+        // The preview renderer ships with the Mandelbrot chunk, the only mode showing it
+        const {JuliaPreviewRenderer} = getLoadedMode(FRACTAL_TYPE.MANDELBROT).extras;
         previewRenderer = new JuliaPreviewRenderer(floatingCanvas);
         // Use lower iteration count for responsiveness
         previewRenderer.MAX_ITER = 500;
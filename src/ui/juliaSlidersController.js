@@ -9,7 +9,6 @@
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE} from "../global/constants";
 import {isJuliaMode, resetPresetAndDiveButtonStates, updateInfo} from "./ui";
 import {clearURLParams} from "../global/utils";
-import {JuliaRenderer} from "../renderers/juliaRenderer";
 
 /**
  * Throttle limit in milliseconds.
@@ -38,7 +37,7 @@ let fractalApp;
  * @param {FractalRenderer} app
  */
 export function initJuliaSliders(app) {
-    if (!(app instanceof JuliaRenderer)) {
+    if (!isJuliaMode()) {
         console.error(`%c initJuliaSliders: %c Can only attach to JuliaRenderer, not ${app}!`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
         return;
     }
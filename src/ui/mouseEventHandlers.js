@@ -6,7 +6,7 @@
  * @license MIT
  */
 
-import {normalizeRotation, updateURLParams} from '../global/utils.js';
+import {updateURLParams} from '../global/utils.js';
 import {
     getCurrentPaletteId,
     hideViewInfo,
@@ -14,11 +14,26 @@ import {
     isMandelbrotMode,
     isRiemannMode,
     isRosslerMode,
-    resetAppState,
-    updateInfo
+    resetAppState
 } from './ui.js';
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, DEBUG_MODE, EASE_TYPE, FRACTAL_TYPE} from "../global/constants";
 import {hideJuliaPreview, initJuliaPreview, showJuliaPreview, updateJuliaPreview} from "./juliaPreview";
+import {
+    cancelPointerFrame,
+    clampPanDelta,
+    flushPointerFrame,
+    getPredictedPointerSample,
+    initPointerInput,
+    queueDrag,
+    queuePredictionLead,
+    queueRotation,
+    queueZoom,
+    resetPointerSamples,
+    setPointerFrameTask,
+    takePointerSamples
+} from "./pointerInput";
+
+export {clampPanDelta, MAX_PAN_DISTANCE} from "./pointerInput";
 
 /** How long should we wait before distinguish between double click and two single clicks. */
 const DOUBLE_CLICK_THRESHOLD = 300;
@@ -26,8 +41,6 @@ const DOUBLE_CLICK_THRESHOLD = 300;
 const DRAG_THRESHOLD = 5;
 const ZOOM_STEP = 0.05; // double-click zoom in/out
 const ROTATION_SENSITIVITY = 0.01;
-/** Default maximum distance from origin to prevent panning out of view */
-export const MAX_PAN_DISTANCE = 3.5; // Fractals are contained within ~radius 2, allow some margin
 
 /** Long press zoom configuration */
 const LONG_PRESS_THRESHOLD = 400; // ms before zoom starts
@@ -61,14 +74,12 @@ let wasRotated = false;
 // Long press zoom state (left button - zoom in)
 let longPressTimeout = null;
 let longPressZoomActive = false;
-let longPressZoomRAF = null;
 let longPressAnchorX = 0;
 let longPressAnchorY = 0;
 
 // Long press zoom state (right button - zoom out)
 let rightLongPressTimeout = null;
 let rightLongPressZoomActive = false;
-let rightLongPressZoomRAF = null;
 let rightLongPressAnchorX = 0;
 let rightLongPressAnchorY = 0;
 
@@ -81,47 +92,9 @@ let isMiddleButtonHeld = false;
 
 // Cached rect (avoid layout thrash / inconsistencies during drag)
 let dragRectLeft = 0;
-
-/**
- * Clamps pan delta to ensure resulting pan stays within bounds
- * @param {Array<number>} currentPan - Current pan [x, y]
- * @param {Array<number>} deltaPan - Proposed delta [dx, dy]
- * @returns {Array<number>} - Clamped delta [dx, dy]
- */
-export function clampPanDelta(currentPan, deltaPan) {
-    const newPanX = currentPan[0] + deltaPan[0];
-    const newPanY = currentPan[1] + deltaPan[1];
-    const distance = Math.sqrt(newPanX * newPanX + newPanY * newPanY);
-
-    // Use renderer's MAX_PAN_DISTANCE if available, otherwise use default
-    const maxPan = fractalApp?.MAX_PAN_DISTANCE ?? MAX_PAN_DISTANCE;
-
-    // If within bounds, return unchanged
-    if (distance <= maxPan) {
-        return deltaPan;
-    }
-
-    // Clamp to max distance by scaling back the new position
-    const scale = maxPan / distance;
-    const clampedPanX = newPanX * scale;
-    const clampedPanY = newPanY * scale;
-
-    // Return the delta that would achieve the clamped position
-    const clampedDeltaX = clampedPanX - currentPan[0];
-    const clampedDeltaY = clampedPanY - currentPan[1];
-
-    console.log(`%c clampPanDelta: %c Pan would exceed bounds (distance: ${distance.toFixed(2)} > ${maxPan}). Clamping to [${clampedDeltaX.toFixed(4)}, ${clampedDeltaY.toFixed(4)}]`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
-
-    return [clampedDeltaX, clampedDeltaY];
-}
 let dragRectTop = 0;
 let hasDragRect = false;
 
-// Wheel RAF aggregation
-let wheelAccum = 0;
-let wheelAnchorX = 0;
-let wheelAnchorY = 0;
-let wheelRAF = null;
 // Cached rect for wheel zoom (avoid sub-pixel jitter from repeated getBoundingClientRect calls)
 let wheelRectLeft = 0;
 let wheelRectTop = 0;
@@ -147,6 +120,7 @@ export function initMouseHandlers(app) {
     fractalApp = app;
     canvas = app.canvas;
     canvas.addEventListener("contextmenu", (e) => e.preventDefault());
+    initPointerInput(app);
     initJuliaPreview();
     registerMouseEventHandlers();
 }
@@ -186,6 +160,7 @@ export function unregisterMouseEventHandlers() {
     canvas.removeEventListener('mousemove', handleMouseMoveEvent);
     canvas.removeEventListener('mouseup', handleMouseUpEvent);
     canvas.removeEventListener('mouseleave', handleMouseLeaveEvent);
+    cancelPointerFrame();
 
     mouseHandlersRegistered = false;
     console.warn(`%c unregisterMouseEventHandlers: %c Event handlers unregistered`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
@@ -205,26 +180,20 @@ function startLongPressZoomIn() {
     // Hide preset overlay on interaction (no longer accurate)
     hideViewInfo();
 
-    function zoomLoop() {
-        if (!longPressZoomActive || !fractalApp) return;
-
-        const targetZoom = fractalApp.zoom * LONG_PRESS_ZOOM_IN_FACTOR;
+    // Runs inside the shared per-frame commit, together with any drag motion
+    setPointerFrameTask('longPressZoomIn', () => {
+        if (!longPressZoomActive || !fractalApp) return false;
 
-        if (targetZoom > fractalApp.MAX_ZOOM) {
-            // Use anchor-preserving zoom
-            fractalApp.setZoomKeepingAnchor(targetZoom, longPressAnchorX, longPressAnchorY);
-            markOrbitDirtySafe();
-            fractalApp.draw();
-            updateInfo(true);
-
-            longPressZoomRAF = requestAnimationFrame(zoomLoop);
-        } else {
-            // Reached max zoom, stop
-            stopLongPressZoomIn();
+        if (fractalApp.zoom * LONG_PRESS_ZOOM_IN_FACTOR > fractalApp.MAX_ZOOM) {
+            // Anchor-preserving zoom
+            queueZoom(LONG_PRESS_ZOOM_IN_FACTOR, longPressAnchorX, longPressAnchorY);
+            return true;
         }
-    }
 
-    longPressZoomRAF = requestAnimationFrame(zoomLoop);
+        // Reached max zoom, stop
+        stopLongPressZoomIn();
+        return false;
+    });
     fractalApp.noteInteraction(160);
 }
 
@@ -236,10 +205,7 @@ function stopLongPressZoomIn() {
         clearTimeout(longPressTimeout);
         longPressTimeout = null;
     }
-    if (longPressZoomRAF) {
-        cancelAnimationFrame(longPressZoomRAF);
-        longPressZoomRAF = null;
-    }
+    setPointerFrameTask('longPressZoomIn', null);
     if (longPressZoomActive) {
         longPressZoomActive = false;
         canvas.style.cursor = 'crosshair';
@@ -259,26 +225,20 @@ function startLongPressZoomOut() {
     // Hide preset overlay on interaction (no longer accurate)
     hideViewInfo();
 
-    function zoomLoop() {
-        if (!rightLongPressZoomActive || !fractalApp) return;
+    // Runs inside the shared per-frame commit, together with any drag motion
+    setPointerFrameTask('longPressZoomOut', () => {
+        if (!rightLongPressZoomActive || !fractalApp) return false;
 
-        const targetZoom = fractalApp.zoom * LONG_PRESS_ZOOM_OUT_FACTOR;
-
-        if (targetZoom < fractalApp.MIN_ZOOM) {
-            // Use anchor-preserving zoom
-            fractalApp.setZoomKeepingAnchor(targetZoom, rightLongPressAnchorX, rightLongPressAnchorY);
-            markOrbitDirtySafe();
-            fractalApp.draw();
-            updateInfo(true);
-
-            rightLongPressZoomRAF = requestAnimationFrame(zoomLoop);
-        } else {
-            // Reached min zoom, stop
-            stopLongPressZoomOut();
+        if (fractalApp.zoom * LONG_PRESS_ZOOM_OUT_FACTOR < fractalApp.MIN_ZOOM) {
+            // Anchor-preserving zoom
+            queueZoom(LONG_PRESS_ZOOM_OUT_FACTOR, rightLongPressAnchorX, rightLongPressAnchorY);
+            return true;
         }
-    }
 
-    rightLongPressZoomRAF = requestAnimationFrame(zoomLoop);
+        // Reached min zoom, stop
+        stopLongPressZoomOut();
+        return false;
+    });
     fractalApp.noteInteraction(160);
 }
 
@@ -290,10 +250,7 @@ function stopLongPressZoomOut() {
         clearTimeout(rightLongPressTimeout);
         rightLongPressTimeout = null;
     }
-    if (rightLongPressZoomRAF) {
-        cancelAnimationFrame(rightLongPressZoomRAF);
-        rightLongPressZoomRAF = null;
-    }
+    setPointerFrameTask('longPressZoomOut', null);
     if (rightLongPressZoomActive) {
         rightLongPressZoomActive = false;
         canvas.style.cursor = 'crosshair';
@@ -301,40 +258,6 @@ function stopLongPressZoomOut() {
     }
 }
 
-/**
- * Apply accumulated wheel delta once per RAF.
- * This reduces "bursty wheel" micro-jitter and keeps anchor math consistent.
- */
-function flushWheelZoom() {
-    wheelRAF = null;
-
-    if (!fractalApp) return;
-    if (!Number.isFinite(fractalApp.zoom)) return;
-
-    // Use cached rect to avoid sub-pixel jitter from repeated getBoundingClientRect calls
-    const mouseX = wheelAnchorX - wheelRectLeft; // CSS px
-    const mouseY = wheelAnchorY - wheelRectTop;  // CSS px
-
-    // Apply accumulated delta
-    const zoomFactor = Math.pow(WHEEL_ZOOM_BASE, wheelAccum / WHEEL_DELTA_UNIT);
-    const targetZoom = fractalApp.zoom * zoomFactor;
-
-    // reset accumulator early (avoid re-entrance issues)
-    wheelAccum = 0;
-
-    if (targetZoom < fractalApp.MAX_ZOOM || targetZoom > fractalApp.MIN_ZOOM) return;
-
-    // Stable deep-zoom anchor math (no before/after subtraction)
-    // Keeps the fractal point under cursor fixed while changing zoom.
-    fractalApp.setZoomKeepingAnchor(targetZoom, mouseX, mouseY);
-
-    // orbit rebuild request for perturbation renderers (deferred by renderer logic)
-    markOrbitDirtySafe();
-
-    updateInfo(true);
-    fractalApp.draw();
-}
-
 function handleWheel(event) {
     event.preventDefault();
 
@@ -349,13 +272,11 @@ function handleWheel(event) {
         hasWheelRect = true;
     }
 
-    // Aggregate wheel delta and apply once per frame.
-    wheelAccum += event.deltaY;
-    wheelAnchorX = event.clientX;
-    wheelAnchorY = event.clientY;
-
-    if (!wheelRAF) {
-        wheelRAF = requestAnimationFrame(flushWheelZoom);
+    // Aggregate wheel delta and apply once per frame. Uses the cached rect to avoid sub-pixel jitter;
+    // the anchor math keeps the fractal point under the cursor fixed while changing zoom.
+    if (Number.isFinite(fractalApp.zoom)) {
+        queueZoom(Math.pow(WHEEL_ZOOM_BASE, event.deltaY / WHEEL_DELTA_UNIT),
+            event.clientX - wheelRectLeft, event.clientY - wheelRectTop);
     }
 
     if (wheelResetTimeout) clearTimeout(wheelResetTimeout);
@@ -370,6 +291,7 @@ function handleWheel(event) {
 function handleMouseDown(event) {
     if (event.button === 0) {
         isDragging = false;
+        resetPointerSamples('mouse');
         mouseDownX = event.clientX;
         mouseDownY = event.clientY;
         lastX = event.clientX;
@@ -469,36 +391,15 @@ function handleMouseMove(event) {
                 top = rect.top;
             }
 
-            // Stable deep-zoom pan delta:
-            // pan += zoom * (vLast - vNow)
-            const lastRelX = lastX - left;
-            const lastRelY = lastY - top;
-            const nowRelX = event.clientX - left;
-            const nowRelY = event.clientY - top;
-
-            const [vLastX, vLastY] = fractalApp.screenToViewVector(lastRelX, lastRelY);
-            const [vNowX,  vNowY ] = fractalApp.screenToViewVector(nowRelX, nowRelY);
-
-            if (Number.isFinite(fractalApp.zoom)) {
-                let deltaX = (vLastX - vNowX) * fractalApp.zoom;
-                let deltaY = (vLastY - vNowY) * fractalApp.zoom;
-
-                // Clamp to prevent dragging out of view
-                [deltaX, deltaY] = clampPanDelta(fractalApp.pan, [deltaX, deltaY]);
-
-                fractalApp.addPan(deltaX, deltaY);
-                // Mark orbit dirty (deferred rebuild)
-                markOrbitDirtySafe();
-
-                fractalApp.noteInteraction(160);
-            }
+            // Stable deep-zoom pan delta, integrated over all coalesced samples:
+            // pan += zoom * (vLast - vNow), committed once per frame
+            const points = takePointerSamples('mouse', event.clientX, event.clientY);
+            queueDrag(left, top, lastX, lastY, points);
+            queuePredictionLead(left, top, [event.clientX, event.clientY], getPredictedPointerSample('mouse'));
 
             // Update last mouse coordinates.
             lastX = event.clientX;
             lastY = event.clientY;
-
-            fractalApp.draw();
-            updateInfo(true);
         }
     }
 
@@ -527,13 +428,11 @@ function handleMouseMove(event) {
             event.preventDefault();
             const deltaX = event.clientX - startX;
 
-            fractalApp.rotation = normalizeRotation(fractalApp.rotation + deltaX * ROTATION_SENSITIVITY);
-            fractalApp.draw();
+            queueRotation(deltaX * ROTATION_SENSITIVITY);
 
             startX = event.clientX; // Update starting point for smooth rotation
             wasRotated = true;
             canvas.style.cursor = 'grabbing'; // Use a grabbing cursor for rotation
-            updateInfo();
         }
     }
 
@@ -638,7 +537,7 @@ function handleMouseUp(event) {
 
                         const cx = isJuliaMode() ? fractalApp.c[0] : null;
                         const cy = isJuliaMode() ? fractalApp.c[1] : null;
-                        updateURLParams(currentMode, fractalApp.pan[0], fractalApp.pan[1], fractalApp.zoom, fractalApp.rotation, cx, cy, getCurrentPaletteId());
+                        updateURLParams(currentMode, ...fractalApp.getPanCoordinates(), fractalApp.zoom, fractalApp.rotation, cx, cy, getCurrentPaletteId());
                     });
 
                     navigator.clipboard.writeText(window.location.href).then(
@@ -650,6 +549,8 @@ function handleMouseUp(event) {
                 }, DOUBLE_CLICK_THRESHOLD);
             }
         } else {
+            // Land exactly where the pointer was released (drops the prediction lead)
+            flushPointerFrame();
             resetAppState();
             isDragging = false;
 
@@ -662,6 +563,7 @@ function handleMouseUp(event) {
     if (event.button === 2) { // Right mouse button released
         if (isRightDragging) {
             isRightDragging = false;
+            flushPointerFrame();
 
             if (DEBUG_MODE) console.log(`%c handleMouseUp: %c Single Right Click: Doing nothing.`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
 
@@ -709,6 +611,9 @@ function handleMouseLeave() {
     stopLongPressZoomIn();
     stopLongPressZoomOut();
 
+    // Moves stop arriving outside the canvas: land the drag where the pointer left, without the prediction lead
+    if (isDragging || isRightDragging) flushPointerFrame();
+
     // Hide Julia preview if mouse leaves canvas while middle button is held
     if (isMiddleButtonHeld) {
         isMiddleButtonHeld = false;
@@ -0,0 +1,404 @@
+/**
+ * @module PointerInput
+ * @author Radim Brnka
+ * @description Shared motion pipeline for mouse and touch interaction. Pointer Events are sampled with
+ * getCoalescedEvents() so the full sub-frame path is integrated, getPredictedEvents() provides a one-frame
+ * lead while a pointer is down, and all view changes (pan in double-double, anchored zoom, rotation)
+ * are accumulated and committed to the renderer once per animation frame. The gesture handlers
+ * (mouseEventHandlers, touchEventHandlers) decide *what* a movement means; this module decides *when*
+ * it reaches the renderer.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {ddAdd, ddMake, normalizeRotation} from '../global/utils.js';
+import {updateInfo} from './ui.js';
+import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE} from "../global/constants";
+
+/** Upper bound of buffered samples per pointer (a gesture handler normally takes them every event) */
+const MAX_BUFFERED_SAMPLES = 256;
+
+/** Default maximum distance from origin to prevent panning out of view */
+export const MAX_PAN_DISTANCE = 3.5; // Fractals are contained within ~radius 2, allow some margin
+
+let canvas;
+let fractalApp;
+
+/** Global variable to track registration */
+let pointerInputRegistered = false;
+
+let handlePointerMoveEvent;
+let handlePointerEndEvent;
+
+/**
+ * Samples per primary pointer type ('mouse' | 'pen' | 'touch') recorded since the gesture handler last took them.
+ * @type {Map<string, {points: Array<number[]>, predicted: number[]|null}>}
+ */
+const samples = new Map();
+
+// Pending frame state
+const pendingPanX = ddMake();
+const pendingPanY = ddMake();
+let pendingZoomFactor = 1;
+let pendingZoomAnchorX = 0;
+let pendingZoomAnchorY = 0;
+let pendingRotation = 0;
+let hasPending = false;
+
+/** Prediction lead currently applied to the pan, and the lead wanted for the next frame */
+let appliedLeadX = 0, appliedLeadY = 0;
+let targetLeadX = 0, targetLeadY = 0;
+
+/** Per-frame tasks (e.g. long-press zoom); return false to stop */
+const frameTasks = new Map();
+
+let frameRAF = null;
+
+/**
+ * Initialization and registering of the pointer listeners.
+ * @param {FractalRenderer} app
+ */
+export function initPointerInput(app) {
+    if (pointerInputRegistered && canvas !== app.canvas) unregisterPointerInput();
+    if (fractalApp !== app) cancelPointerFrame();
+
+    fractalApp = app;
+    canvas = app.canvas;
+    registerPointerInput();
+}
+
+/** Registers pointer listeners (sampling only, gestures are handled elsewhere). */
+export function registerPointerInput() {
+    if (pointerInputRegistered || !canvas) return;
+
+    handlePointerMoveEvent = (event) => handlePointerMove(event);
+    handlePointerEndEvent = (event) => handlePointerEnd(event);
+
+    canvas.addEventListener('pointermove', handlePointerMoveEvent, {passive: true});
+    canvas.addEventListener('pointerup', handlePointerEndEvent, {passive: true});
+    canvas.addEventListener('pointercancel', handlePointerEndEvent, {passive: true});
+
+    pointerInputRegistered = true;
+    console.log(`%c registerPointerInput: %c Pointer sampling registered`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
+}
+
+/** Unregisters pointer listeners and drops any pending frame. */
+export function unregisterPointerInput() {
+    if (!pointerInputRegistered) return;
+
+    canvas.removeEventListener('pointermove', handlePointerMoveEvent);
+    canvas.removeEventListener('pointerup', handlePointerEndEvent);
+    canvas.removeEventListener('pointercancel', handlePointerEndEvent);
+
+    cancelPointerFrame();
+    samples.clear();
+    pointerInputRegistered = false;
+}
+
+/**
+ * Clamps pan delta to ensure resulting pan stays within bounds
+ * @param {Array<number>} currentPan - Current pan [x, y]
+ * @param {Array<number>} deltaPan - Proposed delta [dx, dy]
+ * @returns {Array<number>} - Clamped delta [dx, dy]
+ */
+export function clampPanDelta(currentPan, deltaPan) {
+    const newPanX = currentPan[0] + deltaPan[0];
+    const newPanY = currentPan[1] + deltaPan[1];
+    const distance = Math.sqrt(newPanX * newPanX + newPanY * newPanY);
+
+    // Use renderer's MAX_PAN_DISTANCE if available, otherwise use default
+    const maxPan = fractalApp?.MAX_PAN_DISTANCE ?? MAX_PAN_DISTANCE;
+
+    // If within bounds, return unchanged
+    if (distance <= maxPan) {
+        return deltaPan;
+    }
+
+    // Clamp to max distance by scaling back the new position
+    const scale = maxPan / distance;
+    const clampedPanX = newPanX * scale;
+    const clampedPanY = newPanY * scale;
+
+    // Return the delta that would achieve the clamped position
+    const clampedDeltaX = clampedPanX - currentPan[0];
+    const clampedDeltaY = clampedPanY - currentPan[1];
+
+    console.log(`%c clampPanDelta: %c Pan would exceed bounds (distance: ${distance.toFixed(2)} > ${maxPan}). Clamping to [${clampedDeltaX.toFixed(4)}, ${clampedDeltaY.toFixed(4)}]`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
+
+    return [clampedDeltaX, clampedDeltaY];
+}
+
+// region > SAMPLING ---------------------------------------------------------------------------------------------------
+
+function handlePointerMove(event) {
+    // Only pressed pointers are interesting; hover moves of a mouse are not gestures
+    if (!event.isPrimary || event.buttons === 0) return;
+
+    let entry = samples.get(event.pointerType);
+    if (!entry) {
+        entry = {points: [], predicted: null};
+        samples.set(event.pointerType, entry);
+    }
+
+    const coalesced = typeof event.getCoalescedEvents === 'function' ? event.getCoalescedEvents() : null;
+    if (coalesced && coalesced.length) {
+        for (const e of coalesced) entry.points.push([e.clientX, e.clientY]);
+    } else {
+        entry.points.push([event.clientX, event.clientY]);
+    }
+    if (entry.points.length > MAX_BUFFERED_SAMPLES) entry.points.splice(0, entry.points.length - MAX_BUFFERED_SAMPLES);
+
+    const predicted = typeof event.getPredictedEvents === 'function' ? event.getPredictedEvents() : null;
+    entry.predicted = predicted && predicted.length
+        ? [predicted[predicted.length - 1].clientX, predicted[predicted.length - 1].clientY]
+        : null;
+}
+
+function handlePointerEnd(event) {
+    if (event.isPrimary) samples.delete(event.pointerType);
+}
+
+/**
+ * Drops buffered samples of a pointer type, called when a gesture starts.
+ * @param {string} pointerType
+ */
+export function resetPointerSamples(pointerType) {
+    samples.delete(pointerType);
+    if (pointerType === 'mouse') samples.delete('pen');
+}
+
+/**
+ * Returns the positions (client px) the primary pointer of the given type went through since the last call,
+ * always ending at the position of the compatibility event being handled.
+ * Falls back to just that position where Pointer Events are not available.
+ *
+ * @param {string} pointerType - 'mouse' or 'touch'
+ * @param {number} clientX - Position of the mouse/touch event being handled
+ * @param {number} clientY
+ * @returns {Array<number[]>}
+ */
+export function takePointerSamples(pointerType, clientX, clientY) {
+    const entry = samples.get(pointerType) || (pointerType === 'mouse' ? samples.get('pen') : null);
+    const points = entry ? entry.points.splice(0) : [];
+
+    const last = points[points.length - 1];
+    if (!last || last[0] !== clientX || last[1] !== clientY) points.push([clientX, clientY]);
+
+    return points;
+}
+
+/**
+ * @param {string} pointerType
+ * @returns {number[]|null} Predicted client position of the primary pointer at the next frame, if the browser provides it
+ */
+export function getPredictedPointerSample(pointerType) {
+    const entry = samples.get(pointerType) || (pointerType === 'mouse' ? samples.get('pen') : null);
+    return entry?.predicted || null;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > FRAME ACCUMULATION -----------------------------------------------------------------------------------------
+
+/**
+ * Screen-space drag to pan delta: pan += zoom * (vPrev - vNow), integrated sample by sample in double-double.
+ *
+ * @param {number} left - Canvas rect origin (client px)
+ * @param {number} top
+ * @param {number} fromX - Last integrated position (client px)
+ * @param {number} fromY
+ * @param {Array<number[]>} points - From {@link takePointerSamples}
+ */
+export function queueDrag(left, top, fromX, fromY, points) {
+    if (!fractalApp || !Number.isFinite(fractalApp.zoom)) return;
+
+    const zoom = fractalApp.zoom;
+    let [vPrevX, vPrevY] = fractalApp.screenToViewVector(fromX - left, fromY - top);
+
+    for (const [x, y] of points) {
+        const [vX, vY] = fractalApp.screenToViewVector(x - left, y - top);
+        ddAdd(pendingPanX, (vPrevX - vX) * zoom);
+        ddAdd(pendingPanY, (vPrevY - vY) * zoom);
+        vPrevX = vX;
+        vPrevY = vY;
+    }
+
+    markPending();
+}
+
+/**
+ * Sets the extra pan that moves the view to where the pointer is predicted to be at the next vsync.
+ * It is display-only: each commit replaces the previous lead, and {@link flushPointerFrame} removes it.
+ *
+ * @param {number} left - Canvas rect origin (client px)
+ * @param {number} top
+ * @param {number[]} current - Last real position (client px)
+ * @param {number[]|null} predicted - Predicted position (client px)
+ */
+export function queuePredictionLead(left, top, current, predicted) {
+    if (!fractalApp || !predicted) {
+        targetLeadX = targetLeadY = 0;
+        return;
+    }
+
+    const [vX, vY] = fractalApp.screenToViewVector(current[0] - left, current[1] - top);
+    const [vPX, vPY] = fractalApp.screenToViewVector(predicted[0] - left, predicted[1] - top);
+    targetLeadX = (vX - vPX) * fractalApp.zoom;
+    targetLeadY = (vY - vPY) * fractalApp.zoom;
+    markPending();
+}
+
+/**
+ * Queues a plain pan delta (fractal units).
+ * @param {number} dx
+ * @param {number} dy
+ */
+export function queuePan(dx, dy) {
+    ddAdd(pendingPanX, dx);
+    ddAdd(pendingPanY, dy);
+    markPending();
+}
+
+/**
+ * Queues a multiplicative zoom change, keeping the fractal point under the anchor fixed.
+ * @param {number} factor - New zoom = zoom * factor
+ * @param {number} anchorX - Canvas-relative CSS px
+ * @param {number} anchorY
+ */
+export function queueZoom(factor, anchorX, anchorY) {
+    pendingZoomFactor *= factor;
+    pendingZoomAnchorX = anchorX;
+    pendingZoomAnchorY = anchorY;
+    markPending();
+}
+
+/**
+ * Queues a rotation change (radians).
+ * @param {number} delta
+ */
+export function queueRotation(delta) {
+    pendingRotation += delta;
+    markPending();
+}
+
+/**
+ * Runs a task at the start of every frame until it returns false or is removed.
+ * Used for continuous input (long-press zoom) so it shares the single per-frame commit.
+ * @param {string} key
+ * @param {function(): boolean|null} task - null removes the task
+ */
+export function setPointerFrameTask(key, task) {
+    if (task) {
+        frameTasks.set(key, task);
+        scheduleFrame();
+    } else {
+        frameTasks.delete(key);
+    }
+}
+
+/**
+ * Commits anything pending right away (without prediction lead), e.g. on gesture end before the settle draw.
+ */
+export function flushPointerFrame() {
+    if (frameRAF) {
+        cancelAnimationFrame(frameRAF);
+        frameRAF = null;
+    }
+    targetLeadX = targetLeadY = 0;
+    if (hasPending || appliedLeadX || appliedLeadY) commit();
+}
+
+/**
+ * Drops pending changes and stops the frame loop. A prediction lead already in the pan is taken back out, so it
+ * does not stay baked into the view (or into the next renderer's pan once the app changes).
+ */
+export function cancelPointerFrame() {
+    if (frameRAF) {
+        cancelAnimationFrame(frameRAF);
+        frameRAF = null;
+    }
+    frameTasks.clear();
+    resetPending();
+
+    if ((appliedLeadX || appliedLeadY) && fractalApp) fractalApp.addPan(-appliedLeadX, -appliedLeadY);
+    appliedLeadX = appliedLeadY = 0;
+    targetLeadX = targetLeadY = 0;
+}
+
+function markPending() {
+    hasPending = true;
+    scheduleFrame();
+}
+
+function scheduleFrame() {
+    if (!frameRAF) frameRAF = requestAnimationFrame(onFrame);
+}
+
+function onFrame() {
+    frameRAF = null;
+
+    for (const [key, task] of frameTasks) {
+        if (task() === false) frameTasks.delete(key);
+    }
+
+    if (hasPending) commit();
+    if (frameTasks.size) scheduleFrame();
+}
+
+function resetPending() {
+    pendingPanX.hi = pendingPanX.lo = 0;
+    pendingPanY.hi = pendingPanY.lo = 0;
+    pendingZoomFactor = 1;
+    pendingRotation = 0;
+    hasPending = false;
+}
+
+/**
+ * Applies the accumulated frame state to the renderer and draws once.
+ */
+function commit() {
+    if (!fractalApp) {
+        resetPending();
+        return;
+    }
+
+    // Swap the previous prediction lead for the new one along with the real motion
+    let panHiX = pendingPanX.hi + (targetLeadX - appliedLeadX);
+    let panHiY = pendingPanY.hi + (targetLeadY - appliedLeadY);
+    let panLoX = pendingPanX.lo;
+    let panLoY = pendingPanY.lo;
+    let leadX = targetLeadX;
+    let leadY = targetLeadY;
+
+    if (panHiX !== 0 || panHiY !== 0 || panLoX !== 0 || panLoY !== 0) {
+        const [clampedX, clampedY] = clampPanDelta(fractalApp.pan, [panHiX, panHiY]);
+        if (clampedX !== panHiX || clampedY !== panHiY) {
+            // Clamped at the boundary: the low-order part is meaningless there, and the lead cannot be told apart
+            // from the real motion any more, so none is recorded (taking it back later would pull the view inwards)
+            panLoX = panLoY = 0;
+            leadX = leadY = 0;
+        }
+        fractalApp.addPan(clampedX, clampedY);
+        if (panLoX !== 0 || panLoY !== 0) fractalApp.addPan(panLoX, panLoY);
+    }
+    appliedLeadX = leadX;
+    appliedLeadY = leadY;
+
+    if (pendingZoomFactor !== 1 && Number.isFinite(fractalApp.zoom)) {
+        let targetZoom = fractalApp.zoom * pendingZoomFactor;
+        targetZoom = Math.min(fractalApp.MIN_ZOOM, Math.max(fractalApp.MAX_ZOOM, targetZoom));
+        fractalApp.setZoomKeepingAnchor(targetZoom, pendingZoomAnchorX, pendingZoomAnchorY);
+    }
+
+    if (pendingRotation !== 0) {
+        fractalApp.rotation = normalizeRotation(fractalApp.rotation + pendingRotation);
+    }
+
+    resetPending();
+
+    if (typeof fractalApp.markOrbitDirty === "function") fractalApp.markOrbitDirty();
+    fractalApp.noteInteraction(160);
+    fractalApp.draw();
+    updateInfo(true);
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
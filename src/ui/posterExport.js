@@ -0,0 +1,463 @@
+/**
+ * @module PosterExport
+ * @author Radim Brnka
+ * @description High-resolution poster export. Renders the current view at an arbitrary size (e.g. 16K x 16K) tile by
+ * tile into an offscreen framebuffer, optionally supersampled with jittered sub-pixel offsets, and streams each band
+ * of tiles into a PNG encoder so the full image never sits in memory. The view is frozen during the export, so
+ * perturbation renderers share one reference orbit for all tiles.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {APP, log, LOG_LEVEL} from '../global/constants';
+import {PNGStreamEncoder} from '../global/pngStreamEncoder';
+import {getFilename, getWatermarkLines} from './screenshotController';
+
+/** Tile edge in output pixels (clamped to the GL limits) */
+const DEFAULT_TILE_SIZE = 512;
+/** Largest accepted poster edge */
+export const MAX_POSTER_SIZE = 32768;
+/** Largest supersampling grid (n x n samples per pixel) */
+export const MAX_SUPERSAMPLE = 4;
+/** Texture unit the tile texture is created on (0 = orbit, 1 = series coefficients, 2 = overlay atlas) */
+const SCRATCH_TEXTURE_UNIT = 3;
+
+// region > TILING -----------------------------------------------------------------------------------------------------
+
+/**
+ * Splits the poster into horizontal bands of tiles, top to bottom (PNG row order).
+ * @param {number} width
+ * @param {number} height
+ * @param {number} tileSize
+ * @returns {Array<{y: number, h: number, tiles: Array<{x: number, w: number}>}>}
+ */
+export function planTiles(width, height, tileSize) {
+    const bands = [];
+    for (let y = 0; y < height; y += tileSize) {
+        const tiles = [];
+        for (let x = 0; x < width; x += tileSize) tiles.push({x, w: Math.min(tileSize, width - x)});
+        bands.push({y, h: Math.min(tileSize, height - y), tiles});
+    }
+    return bands;
+}
+
+/**
+ * Sub-pixel sample offsets of an n x n stratified grid, centred on the pixel.
+ * @param {number} n
+ * @returns {Array<[number, number]>}
+ */
+export function jitterOffsets(n) {
+    const offsets = [];
+    for (let j = 0; j < n; j++) {
+        for (let i = 0; i < n; i++) offsets.push([(i + 0.5) / n - 0.5, (j + 0.5) / n - 0.5]);
+    }
+    return offsets;
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > SINKS ------------------------------------------------------------------------------------------------------
+
+/**
+ * Wraps a FileSystemWritableFileStream as a byte sink.
+ * @param {FileSystemFileHandle} handle
+ * @returns {Promise<ByteSink>}
+ */
+export async function createHandleSink(handle) {
+    const stream = await handle.createWritable();
+    return {
+        write: (bytes) => stream.write(bytes),
+        close: () => stream.close(),
+        abort: () => stream.abort(),
+    };
+}
+
+/**
+ * Opens the output file. Uses the File System Access API when available (bytes go straight to disk); otherwise
+ * collects the compressed chunks as Blob parts and downloads them at the end. Must be called from a user gesture.
+ * @param {string} filename
+ * @param {string} [mimeType]
+ * @param {string} [description] File type shown by the save picker
+ * @returns {Promise<ByteSink>}
+ */
+export async function createFileSink(filename, mimeType = 'image/png', description = 'PNG image') {
+    if (typeof window.showSaveFilePicker === 'function') {
+        const extension = filename.slice(filename.lastIndexOf('.'));
+        const handle = await window.showSaveFilePicker({
+            suggestedName: filename,
+            types: [{description, accept: {[mimeType]: [extension]}}]
+        });
+        return createHandleSink(handle);
+    }
+
+    let parts = [];
+    return {
+        write: (bytes) => {
+            parts.push(bytes);
+        },
+        close: () => {
+            const url = URL.createObjectURL(new Blob(parts, {type: mimeType}));
+            parts = [];
+            const link = document.createElement('a');
+            link.setAttribute('download', filename);
+            link.setAttribute('href', url);
+            link.click();
+            setTimeout(() => URL.revokeObjectURL(url), 0);
+        },
+        abort: () => {
+            parts = [];
+        },
+    };
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > RENDERING --------------------------------------------------------------------------------------------------
+
+/**
+ * Offscreen RGBA8 framebuffer one tile large. Renders regions of a virtual frame of the current view and resolves
+ * them (averaging supersampled passes, flipping rows to top-down) into caller-owned RGB or RGBA buffers.
+ */
+export class TileTarget {
+
+    /**
+     * @param {FractalRenderer|{gl: WebGLRenderingContext, drawTile: Function}} fractalApp Anything drawing tiles
+     * through FractalRenderer.drawTile()'s interface
+     * @param {number} [tileSize] Requested tile edge, clamped to the GL limits
+     */
+    constructor(fractalApp, tileSize = DEFAULT_TILE_SIZE) {
+        this.app = fractalApp;
+        const gl = this.gl = fractalApp.gl;
+
+        const viewportMax = gl.getParameter(gl.MAX_VIEWPORT_DIMS);
+        this.tileSize = Math.max(16, Math.min(
+            tileSize,
+            gl.getParameter(gl.MAX_TEXTURE_SIZE) || DEFAULT_TILE_SIZE,
+            viewportMax?.[0] || DEFAULT_TILE_SIZE,
+            viewportMax?.[1] || DEFAULT_TILE_SIZE
+        ));
+
+        // Create on a spare unit so the renderer's own textures (orbit, coefficients) stay bound where it expects them
+        this.texture = gl.createTexture();
+        gl.activeTexture(gl.TEXTURE0 + SCRATCH_TEXTURE_UNIT);
+        gl.bindTexture(gl.TEXTURE_2D, this.texture);
+        gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, this.tileSize, this.tileSize, 0, gl.RGBA, gl.UNSIGNED_BYTE, null);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.NEAREST);
+        gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.NEAREST);
+        this.framebuffer = gl.createFramebuffer();
+        gl.bindFramebuffer(gl.FRAMEBUFFER, this.framebuffer);
+        gl.framebufferTexture2D(gl.FRAMEBUFFER, gl.COLOR_ATTACHMENT0, gl.TEXTURE_2D, this.texture, 0);
+        /** @type {boolean} False when the context cannot render into RGBA8 textures */
+        this.complete = gl.checkFramebufferStatus(gl.FRAMEBUFFER) === gl.FRAMEBUFFER_COMPLETE;
+        gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+        gl.activeTexture(gl.TEXTURE0);
+
+        this.pixels = new Uint8Array(this.tileSize * this.tileSize * 4);
+        /** @type {Uint32Array|null} Supersampling sums, allocated on first use */
+        this.accum = null;
+    }
+
+    /**
+     * Renders one tile and writes it into an output buffer.
+     * @param {number} x Tile left edge in frame pixels
+     * @param {number} y Tile top edge in frame pixels (top-down)
+     * @param {number} w
+     * @param {number} h
+     * @param {number} width Full frame width
+     * @param {number} height Full frame height
+     * @param {Array<[number, number]>} offsets Sub-pixel sample offsets (see jitterOffsets)
+     * @param {Uint8Array} out Output rows, outWidth pixels each
+     * @param {number} outWidth
+     * @param {number} outY Output row receiving the tile's top row
+     * @param {number} [channels] 3 (RGB) or 4 (RGBA, alpha forced opaque)
+     */
+    renderTile(x, y, w, h, width, height, offsets, out, outWidth, outY, channels = 3) {
+        const gl = this.gl;
+        const pixels = this.pixels;
+        const samples = offsets.length;
+        // GL rows run bottom-up; the tile's lowest row sits this far above the frame's bottom edge
+        const glY = height - y - h;
+
+        let accum = null;
+        if (samples > 1) {
+            accum = this.accum ||= new Uint32Array(this.tileSize * this.tileSize * 3);
+            accum.fill(0, 0, w * h * 3);
+        }
+
+        gl.bindFramebuffer(gl.FRAMEBUFFER, this.framebuffer);
+        for (const [jx, jy] of offsets) {
+            this.app.drawTile(x + jx, glY + jy, w, h, width, height);
+            gl.readPixels(0, 0, w, h, gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+            if (accum) {
+                for (let p = 0, q = 0; p < w * h * 4; p += 4, q += 3) {
+                    accum[q] += pixels[p];
+                    accum[q + 1] += pixels[p + 1];
+                    accum[q + 2] += pixels[p + 2];
+                }
+            }
+        }
+        gl.bindFramebuffer(gl.FRAMEBUFFER, null);
+
+        const half = samples >> 1;
+        for (let r = 0; r < h; r++) {
+            const src = (h - 1 - r) * w;
+            const dst = ((outY + r) * outWidth + x) * channels;
+            for (let i = 0; i < w; i++) {
+                const o = dst + i * channels;
+                if (accum) {
+                    const a = (src + i) * 3;
+                    out[o] = (accum[a] + half) / samples;
+                    out[o + 1] = (accum[a + 1] + half) / samples;
+                    out[o + 2] = (accum[a + 2] + half) / samples;
+                } else {
+                    const p = (src + i) * 4;
+                    out[o] = pixels[p];
+                    out[o + 1] = pixels[p + 1];
+                    out[o + 2] = pixels[p + 2];
+                }
+                if (channels === 4) out[o + 3] = 255;
+            }
+        }
+    }
+
+    /**
+     * Renders a whole frame into an output buffer (top-down rows).
+     * @param {number} width
+     * @param {number} height
+     * @param {Array<[number, number]>} offsets
+     * @param {Uint8Array} out width * height * channels bytes
+     * @param {number} [channels] 3 (RGB) or 4 (RGBA)
+     */
+    renderFrame(width, height, offsets, out, channels = 4) {
+        for (const {y, h, tiles} of planTiles(width, height, this.tileSize)) {
+            for (const {x, w} of tiles) this.renderTile(x, y, w, h, width, height, offsets, out, width, y, channels);
+        }
+    }
+
+    dispose() {
+        this.gl.bindFramebuffer(this.gl.FRAMEBUFFER, null);
+        this.gl.deleteFramebuffer(this.framebuffer);
+        this.gl.deleteTexture(this.texture);
+    }
+}
+
+/**
+ * Renders the current view as a PNG poster.
+ * @param {FractalRenderer} fractalApp
+ * @param {Object} options
+ * @param {number} options.width
+ * @param {number} options.height
+ * @param {ByteSink} options.sink
+ * @param {number} [options.supersample] Samples per pixel edge (1 = off)
+ * @param {number} [options.tileSize]
+ * @param {Object<string, string>} [options.text] PNG tEXt metadata
+ * @param {function(number): void} [options.onProgress] Called with 0..1 after each tile
+ * @param {AbortSignal} [options.signal]
+ * @returns {Promise<void>} Rejects with an AbortError when cancelled
+ */
+export async function renderPoster(fractalApp, options) {
+    const {width, height, sink, supersample = 1, text, onProgress, signal} = options;
+
+    const target = new TileTarget(fractalApp, options.tileSize);
+    const bands = planTiles(width, height, target.tileSize);
+    const offsets = jitterOffsets(supersample);
+    const totalTiles = bands.length * bands[0].tiles.length;
+    const band = new Uint8Array(width * target.tileSize * 3);
+    const encoder = new PNGStreamEncoder(width, height, sink, {text});
+
+    // Adaptive quality may have lowered iterations for the live view; a poster is not frame-time bound
+    const extraIterations = fractalApp.extraIterations;
+    fractalApp.extraIterations = Math.max(0, extraIterations);
+
+    let done = 0;
+    try {
+        if (!target.complete) throw new Error('Offscreen framebuffer is not supported.');
+
+        // Settle the view (reference orbit etc.) once; tiles only shift fragments
+        fractalApp.draw();
+        await encoder.start();
+
+        for (const {y, h, tiles} of bands) {
+            for (const {x, w} of tiles) {
+                if (signal?.aborted) throw new DOMException('Poster export cancelled.', 'AbortError');
+
+                target.renderTile(x, y, w, h, width, height, offsets, band, width, 0);
+
+                onProgress?.(++done / totalTiles);
+                // Let the UI repaint the progress and react to Cancel
+                await new Promise(resolve => setTimeout(resolve, 0));
+            }
+
+            await encoder.writeRows(band, h);
+        }
+
+        await encoder.finish();
+    } catch (e) {
+        await encoder.abort();
+        throw e;
+    } finally {
+        target.dispose();
+        fractalApp.extraIterations = extraIterations;
+        fractalApp.invalidateUniformCache();
+        fractalApp.draw();
+    }
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > DIALOG -----------------------------------------------------------------------------------------------------
+
+let dialog = null;
+let widthInput = null;
+let heightInput = null;
+let supersampleSelect = null;
+let progressBar = null;
+let statusLine = null;
+let startBtn = null;
+let cancelBtn = null;
+
+/** @type {FractalRenderer|null} */
+let app = null;
+/** @type {AbortController|null} Set while an export runs */
+let running = null;
+
+/** @returns {number} Canvas aspect ratio (width / height) */
+const aspect = () => (app?.canvas?.width || 16) / (app?.canvas?.height || 9);
+
+function parseSize(input) {
+    const value = Math.round(Number(input.value));
+    const valid = Number.isFinite(value) && value >= 16 && value <= MAX_POSTER_SIZE;
+    input.classList.toggle('invalid', !valid);
+    return valid ? value : null;
+}
+
+function validate() {
+    const widthOk = parseSize(widthInput) !== null;
+    const heightOk = parseSize(heightInput) !== null;
+    startBtn.disabled = !widthOk || !heightOk || !!running;
+    return widthOk && heightOk;
+}
+
+function setRunning(controller) {
+    running = controller;
+    widthInput.disabled = heightInput.disabled = supersampleSelect.disabled = !!controller;
+    startBtn.disabled = !!controller;
+    progressBar.style.display = controller ? '' : 'none';
+}
+
+function hide() {
+    if (running) return;
+    dialog.classList.remove('show');
+}
+
+async function start() {
+    if (running || !validate() || !app) return;
+
+    const width = parseSize(widthInput);
+    const height = parseSize(heightInput);
+    const supersample = Math.min(MAX_SUPERSAMPLE, Math.max(1, Number(supersampleSelect.value) || 1));
+    const controller = new AbortController();
+
+    let sink;
+    try {
+        sink = await createFileSink(getFilename('png'));
+    } catch (e) {
+        // Save picker dismissed
+        return;
+    }
+
+    const {line1, line2} = getWatermarkLines(app);
+    setRunning(controller);
+    progressBar.value = 0;
+    statusLine.textContent = `Rendering ${width} × ${height}...`;
+    const t0 = performance.now();
+
+    try {
+        await renderPoster(app, {
+            width, height, supersample, sink,
+            signal: controller.signal,
+            text: {Software: `${line1} ${APP.version}`, Description: line2},
+            onProgress: (p) => {
+                progressBar.value = p;
+                statusLine.textContent = `Rendering ${width} × ${height}: ${Math.floor(p * 100)} %`;
+            },
+        });
+        log(`Poster ${width}x${height} (${supersample}x${supersample}) exported in ${((performance.now() - t0) / 1000).toFixed(1)} s.`, 'PosterExport');
+        statusLine.textContent = '';
+        setRunning(null);
+        hide();
+    } catch (e) {
+        setRunning(null);
+        if (e?.name === 'AbortError') {
+            statusLine.textContent = 'Export cancelled.';
+        } else {
+            log(`Poster export failed: ${e?.message || e}`, 'PosterExport', LOG_LEVEL.ERROR);
+            statusLine.textContent = `Export failed: ${e?.message || e}`;
+        }
+    }
+}
+
+/**
+ * Shows the poster export dialog for the given renderer.
+ * @param {FractalRenderer} fractalApp
+ */
+export function showPosterDialog(fractalApp) {
+    if (!dialog) return;
+    app = fractalApp;
+
+    if (!running) {
+        const w = Number(widthInput.value) || 7680;
+        widthInput.value = String(w);
+        heightInput.value = String(Math.round(w / aspect()));
+        statusLine.textContent = '';
+        validate();
+    }
+    dialog.classList.add('show');
+}
+
+/**
+ * Initializes the poster export dialog events.
+ */
+export function initPosterDialog() {
+    dialog = document.getElementById('posterDialog');
+    if (!dialog) return;
+
+    widthInput = document.getElementById('posterWidth');
+    heightInput = document.getElementById('posterHeight');
+    supersampleSelect = document.getElementById('posterSupersample');
+    progressBar = document.getElementById('posterProgress');
+    statusLine = document.getElementById('posterStatus');
+    startBtn = document.getElementById('posterStart');
+    cancelBtn = document.getElementById('posterCancel');
+
+    progressBar.style.display = 'none';
+
+    // Width follows the canvas aspect ratio; height can be overridden afterwards
+    widthInput.addEventListener('input', () => {
+        const w = parseSize(widthInput);
+        if (w !== null) heightInput.value = String(Math.round(w / aspect()));
+        validate();
+    });
+    heightInput.addEventListener('input', validate);
+
+    for (const input of [widthInput, heightInput]) {
+        input.addEventListener('keydown', (e) => {
+            e.stopPropagation(); // Prevent hotkeys from firing
+            if (e.key === 'Enter') void start();
+            else if (e.key === 'Escape') hide();
+        });
+    }
+
+    startBtn.addEventListener('click', () => void start());
+
+    // Cancel aborts a running export, otherwise closes the dialog
+    cancelBtn.addEventListener('click', () => {
+        if (running) running.abort();
+        else hide();
+    });
+
+    dialog.addEventListener('click', (e) => {
+        if (e.target === dialog) hide();
+    });
+
+    log('Initialized.', 'initPosterDialog');
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
@@ -180,10 +180,8 @@ export function init(riemannRenderer, closeOtherDropdowns) {
     }
 
     // Initialize overlays
-    const axesCanvas = document.getElementById('axesCanvas');
-    const zetaPathCanvas = document.getElementById('zetaPathCanvas');
-    axesOverlay.init(axesCanvas, renderer);
-    zetaPathOverlay.init(zetaPathCanvas, renderer);
+    axesOverlay.init(renderer);
+    zetaPathOverlay.init(renderer);
 
     // Set up draw callback for overlay updates
     renderer.onDrawCallback = () => {
@@ -6,19 +6,19 @@
  * @license MIT
  */
 
-import {JuliaRenderer} from "../renderers/juliaRenderer";
 import {APP, CONSOLE_GROUP_STYLE, SCREENSHOT_JPEG_COMPRESSION_QUALITY} from "../global/constants";
 import {expandComplexToString} from "../global/utils";
 import {getFractalMode} from "./ui";
 
 /**
  * Generates filename based on current timestamp
+ * @param {string} [extension]
  * @return {string}
  */
-function getFilename() {
+export function getFilename(extension = 'jpg') {
     const now = new Date();
     const pad = (n) => String(n).padStart(2, '0');
-    return `fractal-${now.getFullYear()}-${pad(now.getMonth() + 1)}-${pad(now.getDate())}_${pad(now.getHours())}-${pad(now.getMinutes())}-${pad(now.getSeconds())}.jpg`;
+    return `fractal-${now.getFullYear()}-${pad(now.getMonth() + 1)}-${pad(now.getDate())}_${pad(now.getHours())}-${pad(now.getMinutes())}-${pad(now.getSeconds())}.${extension}`;
 }
 
 /** Fractal mode display names for watermark (keys match getFractalMode() output) */
@@ -34,12 +34,12 @@ const WATERMARK_FRACTAL_NAMES = {
  * @param {FractalRenderer} fractalApp
  * @return {{line1: string, line2: string}}
  */
-function getWatermarkLines(fractalApp) {
+export function getWatermarkLines(fractalApp) {
     const modeKey = getFractalMode();
     const fractalType = WATERMARK_FRACTAL_NAMES[modeKey] || modeKey;
     const line1 = APP.defaultName;
     const line2 = `${fractalType}: p=${expandComplexToString(fractalApp.pan.slice(), 6)}, zoom=${fractalApp.zoom.toExponential(2)}` +
-        `${(fractalApp instanceof JuliaRenderer) ? `, c=${expandComplexToString(fractalApp.c)}` : ``}`;
+        `${modeKey === 'JULIA' ? `, c=${expandComplexToString(fractalApp.c)}` : ``}`;
     return {line1, line2};
 }
 
@@ -6,18 +6,30 @@
  * @license MIT
  */
 
-import {normalizeRotation, updateURLParams} from '../global/utils.js';
+import {updateURLParams} from '../global/utils.js';
 import {
     getCurrentPaletteId,
     hideViewInfo,
     isJuliaMode,
     isRiemannMode,
     isRosslerMode,
-    resetAppState,
-    updateInfo
+    resetAppState
 } from './ui.js';
 import {CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE, FRACTAL_TYPE} from "../global/constants";
-import {clampPanDelta} from "./mouseEventHandlers";
+import {
+    cancelPointerFrame,
+    clampPanDelta,
+    flushPointerFrame,
+    getPredictedPointerSample,
+    initPointerInput,
+    queueDrag,
+    queuePredictionLead,
+    queueRotation,
+    queueZoom,
+    resetPointerSamples,
+    setPointerFrameTask,
+    takePointerSamples
+} from "./pointerInput";
 
 /** How long should we wait before distinguish between double tap and two single taps. */
 const DOUBLE_TAP_THRESHOLD = 300;
@@ -63,7 +75,6 @@ let lastPinchCenterY = null;
 // Long press zoom state
 let longPressTimeout = null;
 let longPressZoomActive = false;
-let longPressZoomRAF = null;
 let longPressAnchorX = 0;
 let longPressAnchorY = 0;
 
@@ -92,6 +103,7 @@ export function initTouchHandlers(app) {
     fractalApp = app;
     canvas = app.canvas;
     canvas.addEventListener('contextmenu', (e) => e.preventDefault());
+    initPointerInput(app);
 
     registerTouchEventHandlers();
 }
@@ -129,6 +141,7 @@ export function unregisterTouchEventHandlers() {
     canvas.removeEventListener('touchstart', handleTouchStartEvent, {passive: false});
     canvas.removeEventListener('touchmove', handleTouchMoveEvent, {passive: false});
     canvas.removeEventListener('touchend', handleTouchEndEvent, {passive: false});
+    cancelPointerFrame();
 
     touchHandlersRegistered = false;
     console.warn(`%c unregisterTouchEventHandlers: %c Event handlers unregistered`, CONSOLE_GROUP_STYLE, CONSOLE_MESSAGE_STYLE);
@@ -147,26 +160,20 @@ function startLongPressZoomIn() {
     // Hide preset overlay on interaction (no longer accurate)
     hideViewInfo();
 
-    function zoomLoop() {
-        if (!longPressZoomActive || !fractalApp) return;
-
-        const targetZoom = fractalApp.zoom * LONG_PRESS_ZOOM_IN_FACTOR;
+    // Runs inside the shared per-frame commit, together with any drag motion
+    setPointerFrameTask('touchLongPressZoomIn', () => {
+        if (!longPressZoomActive || !fractalApp) return false;
 
-        if (targetZoom > fractalApp.MAX_ZOOM) {
-            // Use anchor-preserving zoom
-            fractalApp.setZoomKeepingAnchor(targetZoom, longPressAnchorX, longPressAnchorY);
-            markOrbitDirtySafe();
-            fractalApp.draw();
-            updateInfo(true);
-
-            longPressZoomRAF = requestAnimationFrame(zoomLoop);
-        } else {
-            // Reached max zoom, stop
-            stopLongPressZoomIn();
+        if (fractalApp.zoom * LONG_PRESS_ZOOM_IN_FACTOR > fractalApp.MAX_ZOOM) {
+            // Anchor-preserving zoom
+            queueZoom(LONG_PRESS_ZOOM_IN_FACTOR, longPressAnchorX, longPressAnchorY);
+            return true;
         }
-    }
 
-    longPressZoomRAF = requestAnimationFrame(zoomLoop);
+        // Reached max zoom, stop
+        stopLongPressZoomIn();
+        return false;
+    });
     fractalApp.noteInteraction(160);
 }
 
@@ -178,10 +185,7 @@ function stopLongPressZoomIn() {
         clearTimeout(longPressTimeout);
         longPressTimeout = null;
     }
-    if (longPressZoomRAF) {
-        cancelAnimationFrame(longPressZoomRAF);
-        longPressZoomRAF = null;
-    }
+    setPointerFrameTask('touchLongPressZoomIn', null);
     if (longPressZoomActive) {
         longPressZoomActive = false;
         resetAppState();
@@ -201,6 +205,7 @@ function handleTouchStart(event) {
         pinchStartAngle = null;
 
         const touch = event.touches[0];
+        resetPointerSamples('touch');
         touchDownX = touch.clientX;
         touchDownY = touch.clientY;
         lastTouchX = touch.clientX;
@@ -316,33 +321,14 @@ function handleTouchMove(event) {
                 top = rect.top;
             }
 
-            // Stable deep-zoom pan delta:
-            // pan += zoom * (vLast - vNow)
-            const lastRelX = lastTouchX - left;
-            const lastRelY = lastTouchY - top;
-            const nowRelX = touch.clientX - left;
-            const nowRelY = touch.clientY - top;
-
-            const [vLastX, vLastY] = fractalApp.screenToViewVector(lastRelX, lastRelY);
-            const [vNowX,  vNowY ] = fractalApp.screenToViewVector(nowRelX, nowRelY);
-
-            if (Number.isFinite(fractalApp.zoom)) {
-                let deltaX = (vLastX - vNowX) * fractalApp.zoom;
-                let deltaY = (vLastY - vNowY) * fractalApp.zoom;
-
-                // Clamp to prevent dragging out of view
-                [deltaX, deltaY] = clampPanDelta(fractalApp.pan, [deltaX, deltaY]);
-
-                fractalApp.addPan(deltaX, deltaY);
-                markOrbitDirtySafe();
-                fractalApp.noteInteraction(160);
-            }
+            // Stable deep-zoom pan delta, integrated over all coalesced samples:
+            // pan += zoom * (vLast - vNow), committed once per frame
+            const points = takePointerSamples('touch', touch.clientX, touch.clientY);
+            queueDrag(left, top, lastTouchX, lastTouchY, points);
+            queuePredictionLead(left, top, [touch.clientX, touch.clientY], getPredictedPointerSample('touch'));
 
             lastTouchX = touch.clientX;
             lastTouchY = touch.clientY;
-
-            fractalApp.draw();
-            updateInfo(true);
         }
 
         return;
@@ -388,47 +374,22 @@ function handleTouchMove(event) {
             return;
         }
 
-        // Pan: detect midpoint movement and apply pan delta
-        const centerDeltaX = centerX - lastPinchCenterX;
-        const centerDeltaY = centerY - lastPinchCenterY;
-
-        if (Math.abs(centerDeltaX) > 0.1 || Math.abs(centerDeltaY) > 0.1) {
-            // Convert screen delta to view delta and apply pan
-            const [vLastX, vLastY] = fractalApp.screenToViewVector(lastPinchCenterX, lastPinchCenterY);
-            const [vNowX, vNowY] = fractalApp.screenToViewVector(centerX, centerY);
-
-            if (Number.isFinite(fractalApp.zoom)) {
-                let deltaX = (vLastX - vNowX) * fractalApp.zoom;
-                let deltaY = (vLastY - vNowY) * fractalApp.zoom;
-
-                // Clamp to prevent pinch-panning out of view
-                [deltaX, deltaY] = clampPanDelta(fractalApp.pan, [deltaX, deltaY]);
-
-                fractalApp.addPan(deltaX, deltaY);
-            }
+        // Pan: midpoint movement (canvas-relative coordinates, hence the zero rect origin)
+        if (Math.abs(centerX - lastPinchCenterX) > 0.1 || Math.abs(centerY - lastPinchCenterY) > 0.1) {
+            queueDrag(0, 0, lastPinchCenterX, lastPinchCenterY, [[centerX, centerY]]);
         }
 
-        // Zoom:
-        // If distance increases -> zoom in (smaller zoom value).
-        // So scale zoom proportionally: zoom *= (startDistance / currentDistance)
-        let targetZoom = fractalApp.zoom;
+        // Zoom: distance increase -> zoom in (smaller zoom value), anchored at the midpoint so the
+        // content stays under the fingers. Clamped to MAX_ZOOM..MIN_ZOOM at commit.
         if (currentDistance > 0) {
-            const zoomFactor = pinchStartDistance / currentDistance;
-            targetZoom = fractalApp.zoom * zoomFactor;
+            queueZoom(pinchStartDistance / currentDistance, centerX, centerY);
         }
 
-        // Clamp (same semantics as your mouse/wheel handlers)
-        if (targetZoom < fractalApp.MAX_ZOOM) targetZoom = fractalApp.MAX_ZOOM;
-        if (targetZoom > fractalApp.MIN_ZOOM) targetZoom = fractalApp.MIN_ZOOM;
-
-        // Apply zoom (without anchor adjustment since we handled pan separately)
-        fractalApp.zoom = targetZoom;
-
         // Rotation (incremental, like mouse right-drag) - disabled in Riemann mode
         if (!isRiemannMode()) {
             const angleDifference = currentAngle - pinchStartAngle;
             if (Math.abs(angleDifference) > ROTATION_THRESHOLD) {
-                fractalApp.rotation = normalizeRotation(fractalApp.rotation + angleDifference * ROTATION_SENSITIVITY);
+                queueRotation(angleDifference * ROTATION_SENSITIVITY);
             }
         }
 
@@ -437,12 +398,6 @@ function handleTouchMove(event) {
         pinchStartAngle = currentAngle;
         lastPinchCenterX = centerX;
         lastPinchCenterY = centerY;
-
-        markOrbitDirtySafe();
-        fractalApp.noteInteraction(160);
-
-        fractalApp.draw();
-        updateInfo();
     }
 }
 
@@ -473,6 +428,7 @@ function handleTouchEnd(event) {
         // End of a pinch gesture: just settle.
         if (isPinching) {
             isPinching = false;
+            flushPointerFrame();
             resetAppState();
 
             // Final settle rebuild request (renderer decides when to rebuild)
@@ -529,13 +485,15 @@ function handleTouchEnd(event) {
 
                         const cx = isJuliaMode() ? fractalApp.c[0] : null;
                         const cy = isJuliaMode() ? fractalApp.c[1] : null;
-                        updateURLParams(currentMode, fractalApp.pan[0], fractalApp.pan[1], fractalApp.zoom, fractalApp.rotation, cx, cy, getCurrentPaletteId());
+                        updateURLParams(currentMode, ...fractalApp.getPanCoordinates(), fractalApp.zoom, fractalApp.rotation, cx, cy, getCurrentPaletteId());
                     });
 
                     touchClickTimeout = null;
                 }, DOUBLE_TAP_THRESHOLD);
             }
         } else {
+            // Land exactly where the finger was lifted (drops the prediction lead)
+            flushPointerFrame();
             resetAppState();
             isTouchDragging = false;
 
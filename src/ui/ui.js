@@ -13,8 +13,11 @@ import {
 } from '../global/utils.js';
 import {initMouseHandlers, registerMouseEventHandlers, unregisterMouseEventHandlers} from "./mouseEventHandlers";
 import {initTouchHandlers, registerTouchEventHandlers, unregisterTouchEventHandlers} from "./touchEventHandlers";
-import {JuliaRenderer} from "../renderers/juliaRenderer";
+import {storeViewFrame} from "./frameCache";
 import {takeScreenshot} from "./screenshotController";
+import {initPosterDialog, showPosterDialog as openPosterDialog} from "./posterExport";
+import {initVideoDialog, showVideoDialog as openVideoDialog} from "./videoExport";
+import {getLoadedMode, getRendererMode, loadMode, prefetchLikelyMode} from "../renderers/modeLoader";
 import {
     APP,
     CONSOLE_GROUP_STYLE,
@@ -37,8 +40,6 @@ import {
     PI
 } from "../global/constants";
 import {destroyHotKeys, initHotKeys} from "./hotkeyController";
-import MandelbrotRenderer from "../renderers/mandelbrotRenderer";
-import RiemannRenderer from "../renderers/riemannRenderer";
 import {
     destroyJuliaSliders,
     disableJuliaSliders,
@@ -48,12 +49,11 @@ import {
     updateJuliaSliders
 } from "./juliaSlidersController";
 import {DebugPanel} from "./debugPanel";
+import {profiler} from "../global/profiler";
+import {getQualityHint, initTelemetry, setTelemetryContext} from "../global/telemetry";
 import {destroyJuliaPreview, initJuliaPreview, recolorJuliaPreview, resetJuliaPreview} from "./juliaPreview";
 import {calculateMandelbrotZoomFromJulia} from "../global/utils.fractal";
-import {RosslerRenderer} from "../renderers/rosslerRenderer";
-import {initTourAudio, startTourMusic, stopTourMusic} from "../global/audioManager";
-import * as zetaPathOverlay from "./zetaPathOverlay";
-import * as axesOverlay from "./axesOverlay";
+import {isCoordinate, parseCoordinate} from "../global/quadDouble";
 
 /**
  * @module UI
@@ -68,6 +68,11 @@ let fractalApp;
 
 let fractalMode = FRACTAL_TYPE.MANDELBROT;
 
+// Riemann-only modules, bound once the Riemann chunk is loaded (see modeLoader.js)
+let axesOverlay = null;
+let zetaPathOverlay = null;
+let tourAudio = null;
+
 // LocalStorage keys for user presets
 const USER_PRESETS_KEY_MANDELBROT = 'u_mandelbrot_presets';
 const USER_PRESETS_KEY_JULIA = 'u_julia_presets';
@@ -153,11 +158,8 @@ let riemannShaderMenu;
 let criticalLineToggle;
 let analyticExtToggle;
 let axesToggle;
-let axesCanvas;
-let axesCtx;
 let axesVisible = false;
 let zetaPathToggle;
-let zetaPathCanvas;
 let freqRSlider;
 let freqGSlider;
 let freqBSlider;
@@ -213,6 +215,26 @@ let pendingInfoTimer = null;
 
 export const getFractalMode = () => getFractalName(fractalMode);
 
+/**
+ * Creates the renderer of a mode whose chunk has been loaded and binds the mode-only modules it brings.
+ * @param {FRACTAL_TYPE} mode
+ * @return {FractalRenderer}
+ */
+function createRenderer(mode) {
+    bindModeModules(mode);
+    return new (getLoadedMode(mode).Renderer)(canvas);
+}
+
+/**
+ * Binds the mode-only modules of a loaded mode.
+ * @param {FRACTAL_TYPE} mode
+ */
+function bindModeModules(mode) {
+    if (mode === FRACTAL_TYPE.RIEMANN) {
+        ({axesOverlay, zetaPathOverlay, tourAudio} = getLoadedMode(mode).extras);
+    }
+}
+
 /**
  * Switches among fractal modes
  * @param {FRACTAL_TYPE} mode
@@ -227,6 +249,15 @@ export async function switchFractalMode(mode, preset = null) {
         if (DEBUG_MODE === DEBUG_LEVEL.NONE) return;
     }
 
+    // Fetch the mode's chunk first, the current mode keeps running meanwhile
+    try {
+        await loadMode(mode);
+    } catch (e) {
+        console.error(`Fractal mode "${mode}" could not be loaded: ${e}`);
+        console.groupEnd();
+        return;
+    }
+
     // Stop all running animations before switching
     fractalApp.stopDemo?.();
     fractalApp.stopZeroTour?.();
@@ -295,7 +326,7 @@ export async function switchFractalMode(mode, preset = null) {
         }
 
         exitAnimationMode();
-        updateURLParams(fractalMode, fractalApp.pan[0], fractalApp.pan[1], fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId());
+        updateURLParams(fractalMode, ...fractalApp.getPanCoordinates(), fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId());
     }
 
     // Show quick info with mode name
@@ -309,6 +340,8 @@ export async function switchFractalMode(mode, preset = null) {
     const palette = fractalApp.PALETTES?.[fractalApp.currentPaletteIndex ?? 0];
     showQuickInfo(`${modeName} mode`, null, palette?.keyColor);
 
+    prefetchLikelyMode(mode);
+
     console.log(`Switched to ${modeName}`);
     console.groupEnd();
 }
@@ -394,7 +427,7 @@ export function enableMandelbrotMode() {
     }
 
     fractalApp.destroy();
-    fractalApp = new MandelbrotRenderer(canvas);
+    fractalApp = createRenderer(FRACTAL_TYPE.MANDELBROT);
     fractalMode = FRACTAL_TYPE.MANDELBROT;
 
     // Initialize Mandelbrot-specific controls
@@ -422,7 +455,7 @@ export function enableJuliaMode() {
     updateFractalDropdownState(FRACTAL_TYPE.JULIA);
 
     fractalApp.destroy();
-    fractalApp = new JuliaRenderer(canvas);
+    fractalApp = createRenderer(FRACTAL_TYPE.JULIA);
     fractalMode = FRACTAL_TYPE.JULIA;
 
     // Remove each button from the DOM and reinitialize
@@ -461,7 +494,7 @@ export function enableRiemannMode() {
     updateFractalDropdownState(FRACTAL_TYPE.RIEMANN);
 
     fractalApp.destroy();
-    fractalApp = new RiemannRenderer(canvas);
+    fractalApp = createRenderer(FRACTAL_TYPE.RIEMANN);
     fractalMode = FRACTAL_TYPE.RIEMANN;
 
     destroyArrayOfButtons(presetButtons);
@@ -483,7 +516,7 @@ export function enableRiemannMode() {
     infoLabel.style.background = '';
 
     // Initialize tour background music
-    initTourAudio('./audio/riemann-tour.mp3');
+    tourAudio.initTourAudio('./audio/riemann-tour.mp3');
 
     // Show Demo button, hide persist switch in Riemann mode
     if (demoButton) demoButton.style.display = 'inline-flex';
@@ -496,7 +529,7 @@ export function enableRosslerMode() {
     updateFractalDropdownState(FRACTAL_TYPE.ROSSLER);
 
     fractalApp.destroy();
-    fractalApp = new RosslerRenderer(canvas);
+    fractalApp = createRenderer(FRACTAL_TYPE.ROSSLER);
     fractalMode = FRACTAL_TYPE.ROSSLER;
 
     destroyArrayOfButtons(presetButtons);
@@ -647,6 +680,7 @@ export function updateInfo(force = false) {
         return;
     }
 
+    profiler.begin('updateInfo');
     let text = (animationActive ? ` <span class="middot">🎬</span> ` : ``);
 
     const panX = ddValue(fractalApp.panDD.x) ?? 0;
@@ -684,6 +718,7 @@ export function updateInfo(force = false) {
     }
 
     if (infoText.innerHTML !== text) infoText.innerHTML = text;
+    profiler.end();
 }
 
 /** @returns {boolean} */
@@ -725,7 +760,7 @@ function exitAnimationMode() {
     // Note: Don't stop color animations here - palette cycling should be independent
 
     // Stop tour music if playing
-    stopTourMusic();
+    tourAudio?.stopTourMusic();
 
     // Hide view info overlay when exiting animation mode
     hideViewInfo();
@@ -891,7 +926,7 @@ async function startRiemannDemo() {
     fractalApp.draw();
 
     // Start atmospheric background music
-    await startTourMusic();
+    await tourAudio.startTourMusic();
 
     const totalPoints = fractalApp.PRESETS.length;
 
@@ -901,7 +936,7 @@ async function startRiemannDemo() {
     }, 9000, hideViewInfo);
 
     // Stop music when tour ends
-    await stopTourMusic();
+    await tourAudio.stopTourMusic();
 
     hideViewInfo();
     console.log("Riemann tour ended");
@@ -1044,9 +1079,18 @@ export async function travelToPreset(presets, index) {
 
     presetButtons[index]?.classList.add('active');
 
+    // Frames drawn in flight belong to neither the old nor the new preset; the destination is tagged on arrival
+    setTelemetryContext(getFractalMode(), null);
+
     const preset = presets[index];
     const isRiemann = fractalMode === FRACTAL_TYPE.RIEMANN;
 
+    // Start at the quality level this preset settled at last time instead of converging from scratch
+    const qualityHint = getQualityHint(getFractalMode(), preset.id || preset.name);
+    if (qualityHint !== null && fractalApp.adaptiveQualityEnabled) {
+        fractalApp.extraIterations = Math.max(fractalApp.adaptiveQualityMin, Math.min(0, qualityHint));
+    }
+
     if (isJuliaMode()) {
         fractalApp.demoTime = 0;
         await fractalApp.animateTravelToPreset(preset, 1500, updateColorTheme);
@@ -1066,12 +1110,14 @@ export async function travelToPreset(presets, index) {
 
     activePresetIndex = index;
     travelingToPresetIndex = -1; // Clear traveling target
+    setTelemetryContext(getFractalMode(), preset.id || preset.name);
 
     // Update palette button state if preset changed the palette
     updatePaletteDropdownState();
 
     exitAnimationMode();
-    updateURLParams(fractalMode, fractalApp.pan[0], fractalApp.pan[1], fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId(), preset.id || preset.name);
+    updateURLParams(fractalMode, ...fractalApp.getPanCoordinates(), fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId(), preset.id || preset.name);
+    storeViewFrame(fractalApp, fractalMode, getCurrentPaletteId());
 
     // Show overlay after travel completes (showViewInfo handles marker display based on view type)
     showViewInfo(preset, index, presets.length, isRiemann);
@@ -1119,6 +1165,7 @@ export function resetPresetAndDiveButtonStates() {
  */
 export function resetActivePresetIndex() {
     activePresetIndex = -1;
+    setTelemetryContext(getFractalMode(), null);
 }
 
 /**
@@ -1201,6 +1248,53 @@ export function captureScreenshot() {
     takeScreenshot(canvas, fractalApp, accentColor);
 }
 
+/**
+ * Opens the poster export dialog. Running animations are stopped first so the view stays frozen while tiles render.
+ * @return {Promise<void>}
+ */
+export async function showPosterDialog() {
+    if (animationActive) await toggleDemo();
+    fractalApp.stopAllNonColorAnimations();
+    if (fractalApp.paletteCyclingActive) {
+        fractalApp.stopCurrentColorAnimations(true);
+        updatePaletteCycleButtonState();
+    }
+    openPosterDialog(fractalApp);
+}
+
+/**
+ * Opens the offline video render dialog. The demo/tour of the current mode (and the dives in Julia mode, or the
+ * exp-map zoom into the current view in Mandelbrot mode) are offered as sources; whatever is running is stopped so
+ * the render starts from a clean state.
+ * @return {Promise<void>}
+ */
+export async function showVideoDialog() {
+    if (animationActive) await toggleDemo();
+    fractalApp.stopAllNonColorAnimations();
+
+    const stop = async () => {
+        if (animationActive) await toggleDemo();
+    };
+    const sources = [{label: isRiemannMode() ? 'Zero tour' : 'Demo', start: () => toggleDemo(), stop}];
+    if (isJuliaMode()) {
+        const dives = fractalApp.DIVES || [];
+        dives.forEach((dive, i) => sources.push({
+            label: `Dive: ${dive.id || i + 1}`,
+            start: () => startJuliaDive(dives, i),
+            stop
+        }));
+    }
+    if (isMandelbrotMode()) {
+        // Zoom from the default view into the current one, resampled from a single log-polar strip
+        sources.push({
+            label: 'Zoom into this view (exp-map)',
+            createFrameSource: (app, options) => new (getLoadedMode(FRACTAL_TYPE.MANDELBROT).extras.ExpMapZoom)(app, options)
+        });
+    }
+
+    openVideoDialog(fractalApp, sources);
+}
+
 /**
  * Shows/hides/toggles header.
  * @param {boolean|null} show Show header? If null, then toggles current state
@@ -1238,7 +1332,7 @@ export async function reset() {
     }
 
     // Always stop tour music on reset (exitAnimationMode might skip this if !animationActive)
-    stopTourMusic();
+    tourAudio?.stopTourMusic();
 
     exitAnimationMode();
 
@@ -1323,7 +1417,7 @@ function saveCurrentViewAsPreset(name) {
     const preset = {
         // id: `u_${Date.now()}`,
         id: name,
-        pan: [ddValue(fractalApp.panDD.x), ddValue(fractalApp.panDD.y)],
+        pan: fractalApp.getPanCoordinates(),
         zoom: fractalApp.zoom,
         rotation: fractalApp.rotation,
         speed: 10
@@ -1506,10 +1600,11 @@ function parseEditCoordsInput() {
             if (!parsed.pan || !Array.isArray(parsed.pan) || parsed.pan.length !== 2) {
                 return {error: 'JSON must include "pan" as array [x, y]'};
             }
-            if (typeof parsed.pan[0] !== 'number' || isNaN(parsed.pan[0])) {
+            // Deep coordinates may be decimal strings (see FractalRenderer.getPanCoordinates)
+            if (!isCoordinate(parsed.pan[0])) {
                 return {error: 'JSON "pan[0]" must be a valid number'};
             }
-            if (typeof parsed.pan[1] !== 'number' || isNaN(parsed.pan[1])) {
+            if (!isCoordinate(parsed.pan[1])) {
                 return {error: 'JSON "pan[1]" must be a valid number'};
             }
             if (typeof parsed.zoom !== 'number' || isNaN(parsed.zoom)) {
@@ -1573,8 +1668,8 @@ function parseEditCoordsInput() {
     // Rotation is only required in non-Riemann modes
     if (!isRiemannMode() && !rotationStr) return {error: 'Rotation is required'};
 
-    const panX = parseFloat(panXStr);
-    const panY = parseFloat(panYStr);
+    const panX = parseCoordinate(panXStr);
+    const panY = parseCoordinate(panYStr);
     const zoom = parseFloat(zoomStr);
     // Default to 0 rotation in Riemann mode (rotation not supported)
     const rotationDeg = isRiemannMode() ? 0 : parseFloat(rotationStr);
@@ -1666,6 +1761,7 @@ async function applyEditedCoords() {
 
     // Animate travel to the new coordinates
     initAnimationMode();
+    setTelemetryContext(getFractalMode(), null);
 
     // Different signatures for different fractal types
     if (isJuliaMode()) {
@@ -1924,6 +2020,7 @@ function initPresetButtonEvents() {
             resetPresetAndDiveButtonStates();
             initAnimationMode();
             btn.classList.add('active');
+            setTelemetryContext(getFractalMode(), null);
 
             if (isJuliaMode()) {
                 await fractalApp.animateTravelToPreset(preset, 1500, updateColorTheme);
@@ -1932,7 +2029,7 @@ function initPresetButtonEvents() {
             }
 
             exitAnimationMode();
-            updateURLParams(fractalMode, fractalApp.pan[0], fractalApp.pan[1], fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId());
+            updateURLParams(fractalMode, ...fractalApp.getPanCoordinates(), fractalApp.zoom, fractalApp.rotation, fractalApp.c ? fractalApp.c[0] : null, fractalApp.c ? fractalApp.c[1] : null, getCurrentPaletteId());
         });
 
         // Right click to delete
@@ -2501,8 +2598,8 @@ function initWindowEvents() {
         resizeTimeout = setTimeout(() => {
             fractalApp.resizeCanvas(); // Adjust canvas dimensions
             // Resize and redraw overlays if visible
-            axesOverlay.resize();
-            zetaPathOverlay.resize();
+            axesOverlay?.resize();
+            zetaPathOverlay?.resize();
         }, 200); // Adjust delay as needed
     });
 
@@ -2585,15 +2682,14 @@ function initInfoText() {
 }
 
 export function copyInfoToClipboard() {
-    const viewPanX = ddValue(fractalApp.panDD.x);
-    const viewPanY = ddValue(fractalApp.panDD.y);
+    const [viewPanX, viewPanY] = fractalApp.getPanCoordinates();
     const randomTitle = Math.random().toString(36).slice(2).substring(2, 2 + 4);
     const paletteId = getCurrentPaletteId() || '';
 
     let text =
         `{"id": "${randomTitle}", ` +
         (isJuliaMode() ? `"c": [${fractalApp.c}], ` : ``) +
-        `"pan": [${esc(viewPanX.toFixed(24))}, ${esc(viewPanY.toFixed(24))}], ` +
+        `"pan": [${esc(JSON.stringify(viewPanX))}, ${esc(JSON.stringify(viewPanY))}], ` +
         `"rotation": ${normalizeRotation(fractalApp.rotation)}, "zoom": ${fractalApp.zoom}, "paletteId": "${paletteId}"}`;
 
     navigator.clipboard.writeText(text).then(function () {
@@ -2720,9 +2816,9 @@ function initRiemannControls() {
         zetaPathToggle.addEventListener('click', handleZetaPathToggle);
     }
 
-    // Initialize overlays with canvas and renderer
-    axesOverlay.init(axesCanvas, fractalApp);
-    zetaPathOverlay.init(zetaPathCanvas, fractalApp);
+    // Initialize overlays (drawn into the renderer's WebGL context)
+    axesOverlay.init(fractalApp);
+    zetaPathOverlay.init(fractalApp);
 
     // Initialize Riemann display dropdown
     if (riemannDisplayToggle && riemannDisplayMenu) {
@@ -2899,7 +2995,7 @@ function destroyRiemannControls() {
     closeRiemannDisplayDropdown();
     closeRiemannShaderDropdown();
     hideAxes();
-    zetaPathOverlay.hide();
+    zetaPathOverlay?.hide();
     if (zetaPathToggle) {
         zetaPathToggle.classList.remove('active');
     }
@@ -2972,7 +3068,7 @@ function showAxes() {
  * Hides the axes overlay
  */
 function hideAxes() {
-    axesOverlay.hide();
+    axesOverlay?.hide();
     axesVisible = false;
     if (axesToggle) {
         axesToggle.classList.remove('active');
@@ -3829,12 +3925,7 @@ function bindHTMLElements() {
     criticalLineToggle = document.getElementById('criticalLineToggle');
     analyticExtToggle = document.getElementById('analyticExtToggle');
     axesToggle = document.getElementById('axesToggle');
-    axesCanvas = document.getElementById('axesCanvas');
-    if (axesCanvas) {
-        axesCtx = axesCanvas.getContext('2d');
-    }
     zetaPathToggle = document.getElementById('zetaPathToggle');
-    zetaPathCanvas = document.getElementById('zetaPathCanvas');
     freqRSlider = document.getElementById('freqRSlider');
     freqGSlider = document.getElementById('freqGSlider');
     freqBSlider = document.getElementById('freqBSlider');
@@ -3894,7 +3985,10 @@ export async function initUI(fractalRenderer) {
     bindHTMLElements();
     applyHotkeyHints();
 
-    if (fractalRenderer instanceof JuliaRenderer) {
+    const mode = getRendererMode(fractalRenderer);
+    bindModeModules(mode);
+
+    if (mode === FRACTAL_TYPE.JULIA) {
         fractalMode = FRACTAL_TYPE.JULIA;
 
         initJuliaSliders(fractalApp);
@@ -3905,7 +3999,7 @@ export async function initUI(fractalRenderer) {
         updateFractalDropdownState(FRACTAL_TYPE.JULIA);
 
         window.location.hash = '#julia'; // Update URL hash
-    } else if (fractalRenderer instanceof RiemannRenderer) {
+    } else if (mode === FRACTAL_TYPE.RIEMANN) {
         fractalMode = FRACTAL_TYPE.RIEMANN;
 
         // Hide dives dropdown in Riemann mode
@@ -3917,10 +4011,10 @@ export async function initUI(fractalRenderer) {
         updateFractalDropdownState(FRACTAL_TYPE.RIEMANN);
 
         // Initialize tour background music
-        initTourAudio('./audio/riemann-tour.mp3');
+        tourAudio.initTourAudio('./audio/riemann-tour.mp3');
 
         window.location.hash = '#zeta'; // Update URL hash
-    } else if (fractalRenderer instanceof RosslerRenderer) {
+    } else if (mode === FRACTAL_TYPE.ROSSLER) {
         fractalMode = FRACTAL_TYPE.ROSSLER;
 
         // Hide dives dropdown
@@ -3949,6 +4043,8 @@ export async function initUI(fractalRenderer) {
     initControlButtonEvents();
     initSaveViewDialog();
     initEditCoordsDialog();
+    initPosterDialog();
+    initVideoDialog();
     initInfoText();
     initFractalSwitchButtons();
     initCommonButtonEvents(); // After all dynamic buttons are set
@@ -3963,6 +4059,9 @@ export async function initUI(fractalRenderer) {
 
     updatePaletteDropdownState();
 
+    initTelemetry();
+    setTelemetryContext(getFractalMode(), null);
+
     if (DEBUG_MODE === DEBUG_LEVEL.FULL && !isMobileDevice()) {
         toggleDebugMode();
     }
@@ -3989,6 +4088,8 @@ export async function initUI(fractalRenderer) {
         });
     }
 
+    prefetchLikelyMode(fractalMode);
+
     uiInitialized = true;
 }
 
@@ -0,0 +1,484 @@
+/**
+ * @module VideoExport
+ * @author Radim Brnka
+ * @description Deterministic offline video render of demos, tours and dives. The animation runs on a virtual clock
+ * that advances exactly one frame interval per output frame, so each frame is rendered to completion (optionally
+ * supersampled) no matter how long it takes, and the result plays back smoothly at the chosen frame rate. Frames are
+ * encoded incrementally either to WebM (WebCodecs VideoEncoder + streaming muxer) or to a numbered PNG sequence.
+ * @copyright Synaptory Fractal Traveler, 2025-2026
+ * @license MIT
+ */
+
+import {log, LOG_LEVEL} from '../global/constants';
+import {PNGStreamEncoder} from '../global/pngStreamEncoder';
+import {WebMMuxer} from '../global/webmMuxer';
+import {
+    advanceVirtualClock,
+    installVirtualClock,
+    uninstallVirtualClock,
+    yieldToEventLoop
+} from '../global/virtualClock';
+import {createFileSink, createHandleSink, jitterOffsets, MAX_SUPERSAMPLE, TileTarget} from './posterExport';
+import {getFilename} from './screenshotController';
+
+/** Largest accepted video edge (VP9 level 5.1 tops out around 4K) */
+export const MAX_VIDEO_SIZE = 4096;
+/** WebCodecs codec strings paired with their Matroska codec IDs, in order of preference */
+const CODECS = [
+    {codec: 'vp09.00.51.08', codecId: 'V_VP9'},
+    {codec: 'vp8', codecId: 'V_VP8'},
+];
+/** Target bitrate in bits per pixel per frame */
+const BITS_PER_PIXEL = 0.12;
+/** Seconds between forced keyframes (one WebM cluster each) */
+const KEYFRAME_INTERVAL = 2;
+/** Frames allowed to wait inside the encoder before rendering pauses */
+const MAX_ENCODE_QUEUE = 4;
+
+/** @returns {boolean} True when WebM encoding (WebCodecs) is available */
+export const isWebMSupported = () => typeof window.VideoEncoder === 'function' && typeof window.VideoFrame === 'function';
+
+/** @returns {boolean} True when a PNG sequence can be written into a user-picked folder */
+export const isPNGSequenceSupported = () => typeof window.showDirectoryPicker === 'function';
+
+/**
+ * Picks the first codec the browser can encode at the given size.
+ * @param {number} width
+ * @param {number} height
+ * @param {number} fps
+ * @returns {Promise<{config: VideoEncoderConfig, codecId: string}>}
+ */
+export async function selectCodec(width, height, fps) {
+    for (const {codec, codecId} of CODECS) {
+        const config = {
+            codec, width, height,
+            bitrate: Math.round(width * height * fps * BITS_PER_PIXEL),
+            framerate: fps,
+            latencyMode: 'quality',
+        };
+        try {
+            const {supported} = await window.VideoEncoder.isConfigSupported(config);
+            if (supported) return {config, codecId};
+        } catch (e) {
+            // Invalid for this browser, try the next one
+        }
+    }
+    throw new Error(`No WebM encoder available for ${width} × ${height}.`);
+}
+
+// region > FRAME WRITERS ----------------------------------------------------------------------------------------------
+
+/**
+ * WebM writer: RGBA frames -> VideoEncoder -> muxer -> sink.
+ * @param {number} width
+ * @param {number} height
+ * @param {number} fps
+ * @param {ByteSink} sink
+ */
+async function createWebMWriter(width, height, fps, sink) {
+    const {config, codecId} = await selectCodec(width, height, fps);
+    const muxer = new WebMMuxer(sink, {width, height, codecId, frameRate: fps});
+
+    let failure = null;
+    // Chunks arrive asynchronously; keep their order through the async sink
+    let writes = muxer.writeHeader();
+    const encoder = new window.VideoEncoder({
+        output: (chunk) => {
+            writes = writes.then(() => muxer.addChunk(chunk));
+            writes.catch(e => failure ||= e);
+        },
+        error: (e) => failure ||= e,
+    });
+    encoder.configure(config);
+    log(`Encoding ${config.codec} at ${(config.bitrate / 1e6).toFixed(1)} Mbit/s.`, 'VideoExport');
+
+    const keyEvery = Math.max(1, Math.round(fps * KEYFRAME_INTERVAL));
+    const frameDuration = Math.round(1e6 / fps);
+
+    return {
+        channels: 4,
+        async write(pixels, index) {
+            if (failure) throw failure;
+            while (encoder.encodeQueueSize > MAX_ENCODE_QUEUE) await yieldToEventLoop();
+
+            const frame = new window.VideoFrame(pixels, {
+                format: 'RGBA',
+                codedWidth: width,
+                codedHeight: height,
+                timestamp: Math.round(index * 1e6 / fps),
+                duration: frameDuration,
+            });
+            encoder.encode(frame, {keyFrame: index % keyEvery === 0});
+            frame.close();
+        },
+        async finish() {
+            await encoder.flush();
+            encoder.close();
+            await writes;
+            if (failure) throw failure;
+            await muxer.finish();
+        },
+        async abort() {
+            if (encoder.state !== 'closed') encoder.close();
+            await writes.catch(() => {});
+            await muxer.abort();
+        },
+    };
+}
+
+/**
+ * PNG sequence writer: one file per frame (prefix_00000.png, ...) in the chosen folder.
+ * @param {number} width
+ * @param {number} height
+ * @param {FileSystemDirectoryHandle} directory
+ * @param {string} prefix
+ */
+function createPNGSequenceWriter(width, height, directory, prefix) {
+    return {
+        channels: 3,
+        async write(pixels, index) {
+            const handle = await directory.getFileHandle(`${prefix}_${String(index).padStart(5, '0')}.png`, {create: true});
+            const encoder = new PNGStreamEncoder(width, height, await createHandleSink(handle));
+            try {
+                await encoder.start();
+                await encoder.writeRows(pixels, height);
+                await encoder.finish();
+            } catch (e) {
+                await encoder.abort();
+                throw e;
+            }
+        },
+        async finish() {
+        },
+        async abort() {
+        },
+    };
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > RENDERING --------------------------------------------------------------------------------------------------
+
+/**
+ * @typedef {Object} VideoSource
+ * @property {string} label Shown in the dialog
+ * @property {function(): Promise<void>} [start] Starts the animation; resolves when it ends on its own
+ * @property {function(): Promise<void>|void} [stop] Stops the animation if it is still running
+ * @property {function(FractalRenderer, {width: number, height: number, frames: number, supersample: number}): FrameSource} [createFrameSource]
+ * Alternative to start/stop: frames are composed by a dedicated renderer instead of a running animation
+ */
+
+/**
+ * @typedef {Object} FrameSource
+ * @property {WebGLRenderingContext} gl
+ * @property {function(): Promise<void>} prepare
+ * @property {function(number, AbortSignal=): Promise<void>} setFrame Moves to the given frame index
+ * @property {function(number, number, number, number, number, number): void} drawTile See FractalRenderer.drawTile()
+ * @property {function(): void} dispose
+ */
+
+/**
+ * Renders an animation offline, frame by frame on the virtual clock (or through the source's own frame renderer).
+ * @param {FractalRenderer} fractalApp
+ * @param {Object} options
+ * @param {VideoSource} options.source
+ * @param {number} options.width
+ * @param {number} options.height
+ * @param {number} options.fps
+ * @param {number} options.duration Maximum length in seconds (stops earlier when the animation ends)
+ * @param {'webm'|'png'} options.format
+ * @param {ByteSink} [options.sink] Output for WebM
+ * @param {FileSystemDirectoryHandle} [options.directory] Output folder for PNG sequences
+ * @param {string} [options.prefix] PNG file name prefix
+ * @param {number} [options.supersample] Samples per pixel edge (1 = off)
+ * @param {function(number, number): void} [options.onProgress] Called with (frames done, total) after each frame
+ * @param {AbortSignal} [options.signal]
+ * @returns {Promise<number>} Number of frames written. Rejects with an AbortError when cancelled.
+ */
+export async function renderVideo(fractalApp, options) {
+    const {source, width, height, fps, duration, format, supersample = 1, onProgress, signal} = options;
+
+    const totalFrames = Math.max(1, Math.round(duration * fps));
+    const frameMs = 1000 / fps;
+    const offsets = jitterOffsets(supersample);
+    const frameSource = source.createFrameSource?.(fractalApp, {width, height, frames: totalFrames, supersample});
+    const target = new TileTarget(frameSource || fractalApp);
+
+    // Frame time no longer matters; keep iterations constant so the quality does not pump between frames
+    const adaptiveQuality = fractalApp.adaptiveQualityEnabled;
+    const extraIterations = fractalApp.extraIterations;
+    fractalApp.adaptiveQualityEnabled = false;
+    fractalApp.extraIterations = Math.max(0, extraIterations);
+
+    let writer = null;
+    let frames = 0;
+    const checkAborted = () => {
+        if (signal?.aborted) throw new DOMException('Video export cancelled.', 'AbortError');
+    };
+
+    try {
+        if (!target.complete) throw new Error('Offscreen framebuffer is not supported.');
+
+        writer = format === 'webm'
+            ? await createWebMWriter(width, height, fps, options.sink)
+            : createPNGSequenceWriter(width, height, options.directory, options.prefix || 'frame');
+        const pixels = new Uint8Array(width * height * writer.channels);
+
+        if (frameSource) {
+            await frameSource.prepare();
+
+            while (frames < totalFrames) {
+                checkAborted();
+                await frameSource.setFrame(frames, signal);
+                target.renderFrame(width, height, offsets, pixels, writer.channels);
+                await writer.write(pixels, frames);
+
+                onProgress?.(++frames, totalFrames);
+            }
+        } else {
+            installVirtualClock();
+            let ended = false;
+            source.start().then(() => ended = true, (e) => {
+                ended = true;
+                log(`Video source failed: ${e?.message || e}`, 'VideoExport', LOG_LEVEL.WARN);
+            });
+            await yieldToEventLoop();
+
+            while (frames < totalFrames && !(ended && frames > 0)) {
+                checkAborted();
+                if (frames > 0) await advanceVirtualClock(frameMs);
+
+                // Settle the view for this frame (reference orbit etc.), then render it at the output size
+                fractalApp.draw();
+                target.renderFrame(width, height, offsets, pixels, writer.channels);
+                await writer.write(pixels, frames);
+
+                onProgress?.(++frames, totalFrames);
+            }
+
+            await source.stop?.();
+            uninstallVirtualClock();
+        }
+
+        await writer.finish();
+        return frames;
+    } catch (e) {
+        await source.stop?.();
+        await writer?.abort();
+        throw e;
+    } finally {
+        uninstallVirtualClock();
+        target.dispose();
+        frameSource?.dispose();
+        fractalApp.adaptiveQualityEnabled = adaptiveQuality;
+        fractalApp.extraIterations = extraIterations;
+        fractalApp.invalidateUniformCache();
+        fractalApp.draw();
+    }
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
+// region > DIALOG -----------------------------------------------------------------------------------------------------
+
+let dialog = null;
+let widthInput = null;
+let heightInput = null;
+let fpsSelect = null;
+let durationInput = null;
+let supersampleSelect = null;
+let formatSelect = null;
+let sourceSelect = null;
+let progressBar = null;
+let statusLine = null;
+let startBtn = null;
+let cancelBtn = null;
+
+/** @type {FractalRenderer|null} */
+let app = null;
+/** @type {Array<VideoSource>} */
+let sources = [];
+/** @type {AbortController|null} Set while an export runs */
+let running = null;
+
+/** @returns {number} Canvas aspect ratio (width / height) */
+const aspect = () => (app?.canvas?.width || 16) / (app?.canvas?.height || 9);
+
+/** Video encoders need even dimensions (4:2:0 chroma) */
+const even = (value) => Math.round(value / 2) * 2;
+
+function parseSize(input) {
+    const value = Math.round(Number(input.value));
+    const valid = Number.isFinite(value) && value >= 16 && value <= MAX_VIDEO_SIZE && value % 2 === 0;
+    input.classList.toggle('invalid', !valid);
+    return valid ? value : null;
+}
+
+function parseDuration() {
+    const value = Number(durationInput.value);
+    const valid = Number.isFinite(value) && value > 0 && value <= 3600;
+    durationInput.classList.toggle('invalid', !valid);
+    return valid ? value : null;
+}
+
+function validate() {
+    const widthOk = parseSize(widthInput) !== null;
+    const heightOk = parseSize(heightInput) !== null;
+    const durationOk = parseDuration() !== null;
+    const formatOk = formatSelect.value === 'webm' ? isWebMSupported() : isPNGSequenceSupported();
+    startBtn.disabled = !widthOk || !heightOk || !durationOk || !formatOk || !sources.length || !!running;
+    return widthOk && heightOk && durationOk && formatOk;
+}
+
+function setRunning(controller) {
+    running = controller;
+    for (const input of [widthInput, heightInput, fpsSelect, durationInput, supersampleSelect, formatSelect, sourceSelect]) {
+        input.disabled = !!controller;
+    }
+    startBtn.disabled = !!controller;
+    progressBar.style.display = controller ? '' : 'none';
+}
+
+function hide() {
+    if (running) return;
+    dialog.classList.remove('show');
+}
+
+/**
+ * Opens the output (save picker or folder picker). Must run inside the click handler's user gesture.
+ * @param {string} format
+ * @returns {Promise<{sink?: ByteSink, directory?: FileSystemDirectoryHandle}|null>} Null when dismissed
+ */
+async function openOutput(format) {
+    try {
+        if (format === 'webm') return {sink: await createFileSink(getFilename('webm'), 'video/webm', 'WebM video')};
+        return {directory: await window.showDirectoryPicker({mode: 'readwrite'})};
+    } catch (e) {
+        return null;
+    }
+}
+
+async function start() {
+    if (running || !validate() || !app) return;
+
+    const width = parseSize(widthInput);
+    const height = parseSize(heightInput);
+    const fps = Number(fpsSelect.value) || 60;
+    const duration = parseDuration();
+    const supersample = Math.min(MAX_SUPERSAMPLE, Math.max(1, Number(supersampleSelect.value) || 1));
+    const format = formatSelect.value;
+    const source = sources[Number(sourceSelect.value)] || sources[0];
+
+    const output = await openOutput(format);
+    if (!output) return;
+
+    const controller = new AbortController();
+    setRunning(controller);
+    progressBar.value = 0;
+    statusLine.textContent = `Rendering ${width} × ${height} @ ${fps} FPS...`;
+    const t0 = performance.now();
+
+    try {
+        const frames = await renderVideo(app, {
+            ...output, source, width, height, fps, duration, format, supersample,
+            prefix: getFilename('').replace(/\.$/, ''),
+            signal: controller.signal,
+            onProgress: (done, total) => {
+                progressBar.value = done / total;
+                const elapsed = performance.now() - t0;
+                const eta = Math.round(elapsed / done * (total - done) / 1000);
+                statusLine.textContent = `Frame ${done} / ${total} (ETA ${Math.floor(eta / 60)}:${String(eta % 60).padStart(2, '0')})`;
+            },
+        });
+        log(`Video ${width}x${height}@${fps} (${frames} frames, ${format}) rendered in ${((performance.now() - t0) / 1000).toFixed(1)} s.`, 'VideoExport');
+        statusLine.textContent = '';
+        setRunning(null);
+        hide();
+    } catch (e) {
+        setRunning(null);
+        if (e?.name === 'AbortError') {
+            statusLine.textContent = 'Export cancelled.';
+        } else {
+            log(`Video export failed: ${e?.message || e}`, 'VideoExport', LOG_LEVEL.ERROR);
+            statusLine.textContent = `Export failed: ${e?.message || e}`;
+        }
+    }
+}
+
+/**
+ * Shows the video export dialog.
+ * @param {FractalRenderer} fractalApp
+ * @param {Array<VideoSource>} videoSources Animations available in the current mode
+ */
+export function showVideoDialog(fractalApp, videoSources) {
+    if (!dialog) return;
+    app = fractalApp;
+
+    if (!running) {
+        sources = videoSources;
+        sourceSelect.replaceChildren(...sources.map((source, i) => new Option(source.label, String(i))));
+
+        const w = even(Number(widthInput.value) || 1920);
+        widthInput.value = String(w);
+        heightInput.value = String(even(w / aspect()));
+        if (!isWebMSupported() && isPNGSequenceSupported()) formatSelect.value = 'png';
+        statusLine.textContent = isWebMSupported() || isPNGSequenceSupported()
+            ? '' : 'This browser supports neither WebCodecs nor folder access.';
+        validate();
+    }
+    dialog.classList.add('show');
+}
+
+/**
+ * Initializes the video export dialog events.
+ */
+export function initVideoDialog() {
+    dialog = document.getElementById('videoDialog');
+    if (!dialog) return;
+
+    widthInput = document.getElementById('videoWidth');
+    heightInput = document.getElementById('videoHeight');
+    fpsSelect = document.getElementById('videoFps');
+    durationInput = document.getElementById('videoDuration');
+    supersampleSelect = document.getElementById('videoSupersample');
+    formatSelect = document.getElementById('videoFormat');
+    sourceSelect = document.getElementById('videoSource');
+    progressBar = document.getElementById('videoProgress');
+    statusLine = document.getElementById('videoStatus');
+    startBtn = document.getElementById('videoStart');
+    cancelBtn = document.getElementById('videoCancel');
+
+    progressBar.style.display = 'none';
+
+    // Width follows the canvas aspect ratio; height can be overridden afterwards
+    widthInput.addEventListener('input', () => {
+        const w = parseSize(widthInput);
+        if (w !== null) heightInput.value = String(even(w / aspect()));
+        validate();
+    });
+    heightInput.addEventListener('input', validate);
+    durationInput.addEventListener('input', validate);
+    formatSelect.addEventListener('change', validate);
+
+    for (const input of [widthInput, heightInput, durationInput]) {
+        input.addEventListener('keydown', (e) => {
+            e.stopPropagation(); // Prevent hotkeys from firing
+            if (e.key === 'Enter') void start();
+            else if (e.key === 'Escape') hide();
+        });
+    }
+
+    startBtn.addEventListener('click', () => void start());
+
+    // Cancel aborts a running export, otherwise closes the dialog
+    cancelBtn.addEventListener('click', () => {
+        if (running) running.abort();
+        else hide();
+    });
+
+    dialog.addEventListener('click', (e) => {
+        if (e.target === dialog) hide();
+    });
+
+    log('Initialized.', 'initVideoDialog');
+}
+
+// endregion -----------------------------------------------------------------------------------------------------------
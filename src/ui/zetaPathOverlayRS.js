@@ -8,12 +8,23 @@
  */
 
 import {log} from '../global/constants';
+import {getOverlayLayer, pushPolyline} from './glOverlayLayer';
+import {profiler} from '../global/profiler';
 
-// Canvas and state
-let canvas = null;
-let ctx = null;
+// Layer and state
 let visible = false;
 let renderer = null;
+/** @type {GLOverlayLayer|null} */
+let layer = null;
+let lineBatch = null;
+let glyphBatch = null;
+let legendBatch = null;
+/** Sampled t-window and parameters of the current geometry, null when a rebuild is needed */
+let built = null;
+
+const PATH_COLOR = [0, 1, 0.78, 0.8];
+const T_LABEL_COLOR = [0, 1, 0.78, 0.7];
+const LEGEND = ['ζ(½ + it) spiral [Riemann-Siegel]', 'Zeros = origin crossings'];
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Riemann-Siegel Formula Implementation
@@ -25,7 +36,7 @@ let renderer = null;
  * @param {number} t - The imaginary part of s = ½ + it
  * @returns {number} theta(t)
  */
-function theta(t) {
+export function theta(t) {
     // Stirling approximation for large t:
     // θ(t) ≈ (t/2)·ln(t/(2π)) - t/2 - π/8 + 1/(48t) + 7/(5760t³) + ...
     if (t < 1) {
@@ -50,7 +61,7 @@ function theta(t) {
  * @param {number} t - The imaginary part
  * @returns {number} Z(t)
  */
-function Z(t) {
+export function Z(t) {
     if (t < 0.5) {
         // For very small t, Z(t) ≈ 2·ζ(½) ≈ -2.93...
         // Use direct computation for stability
@@ -222,7 +233,7 @@ function zetaFromZ(t) {
  * @param {number} terms - Unused, kept for API compatibility
  * @returns {number[]} Complex result [re, im]
  */
-function zeta(s, terms = 100) {
+export function zeta(s, terms = 100) {
     const t = s[1];
 
     // For the critical line, use Riemann-Siegel
@@ -244,92 +255,95 @@ function zeta(s, terms = 100) {
 // ─────────────────────────────────────────────────────────────────────────────
 
 /**
- * Draws the zeta path curve w = ζ(½ + it) in the w-plane
+ * Samples the curve w = ζ(½ + it) over a t-window three times wider than the visible one.
+ * @param {number} tCenter
+ * @param {number} tRange
+ * @param {number} terms
  */
-function draw() {
-    if (!ctx || !canvas || !renderer) return;
-
-    const width = canvas.width;
-    const height = canvas.height;
-    const centerX = width / 2;
-    const centerY = height / 2;
-
-    ctx.clearRect(0, 0, width, height);
-
-    const pan = renderer.pan;
+function build(tCenter, tRange, terms) {
     const zoom = renderer.zoom;
-    const scale = height / zoom;
+    const pan = renderer.pan;
 
-    // Determine t range based on current view
-    const tCenter = Math.max(0, pan[1]);
-    const tRange = Math.max(50, zoom * 2);
-    const tMin = Math.max(0, tCenter - tRange);
-    const tMax = tCenter + tRange;
+    const tMin = Math.max(0, tCenter - 3 * tRange);
+    const tMax = tCenter + 3 * tRange;
 
-    // Adaptive step size based on zoom
-    const numPoints = Math.min(5000, Math.max(500, Math.floor(tRange * 20)));
+    // ~10 samples per unit of t, as before, over the wider span
+    const numPoints = Math.min(15000, Math.max(1500, Math.floor(tRange * 60)));
     const dt = (tMax - tMin) / numPoints;
 
-    const terms = renderer.seriesTerms || 100;
-
-    // Draw the spiral path
-    ctx.strokeStyle = 'rgba(0, 255, 200, 0.8)';
-    ctx.lineWidth = 1.5;
-    ctx.beginPath();
+    const points = [];
+    for (let i = 0; i <= numPoints; i++) {
+        const w = zeta([0.5, tMin + i * dt], terms);
+        points.push(w[0], w[1]);
+    }
 
-    let firstPoint = true;
-    let prevW = null;
+    const lines = [];
+    pushPolyline(lines, points, zoom * 0.5, PATH_COLOR, 1.5);
 
-    for (let t = tMin; t <= tMax; t += dt) {
+    // t-value labels
+    const labels = [];
+    const labelInterval = Math.max(1, Math.ceil(tRange / 20));
+    for (let t = Math.ceil(tMin / labelInterval) * labelInterval; t <= tMax; t += labelInterval) {
+        if (t < 0.1) continue;
         const w = zeta([0.5, t], terms);
+        labels.push({
+            x: w[0], y: w[1], text: `t=${t}`, size: 11, color: T_LABEL_COLOR,
+            dx: 5, dy: -5, baseline: 'alphabetic', cull: 25
+        });
+    }
 
-        const screenX = centerX + (w[0] - pan[0]) * scale;
-        const screenY = centerY - (w[1] - pan[1]) * scale;
+    if (!lineBatch) lineBatch = layer.createLineBatch();
+    if (!glyphBatch) glyphBatch = layer.createGlyphBatch();
+    layer.setLines(lineBatch, lines, pan);
+    layer.setLabels(glyphBatch, labels, pan);
 
-        if (isNaN(screenX) || isNaN(screenY)) continue;
-        if (screenX < -width || screenX > 2 * width || screenY < -height || screenY > 2 * height) {
-            firstPoint = true;
-            continue;
-        }
+    built = {tMin, tMax, zoom, terms, labelInterval};
+}
 
-        // Detect discontinuities
-        if (prevW) {
-            const jump = Math.hypot(w[0] - prevW[0], w[1] - prevW[1]);
-            if (jump > zoom * 0.5) {
-                firstPoint = true;
-            }
-        }
+/**
+ * Builds the screen-space legend (once per layer).
+ */
+function buildLegend() {
+    legendBatch = layer.createGlyphBatch();
+    layer.setLabels(legendBatch, [
+        {x: 10, y: 30, text: LEGEND[0], size: 12, color: [1, 1, 1, 0.8], baseline: 'alphabetic', screen: true},
+        {x: 10, y: 15, text: LEGEND[1], size: 12, color: [1, 1, 1, 0.5], baseline: 'alphabetic', screen: true}
+    ], [0, 0]);
+}
 
-        if (firstPoint) {
-            ctx.moveTo(screenX, screenY);
-            firstPoint = false;
-        } else {
-            ctx.lineTo(screenX, screenY);
-        }
-        prevW = w;
-    }
-    ctx.stroke();
+/**
+ * Draws the zeta path curve w = ζ(½ + it) in the w-plane into the current frame
+ */
+function draw() {
+    if (!layer || !renderer) return;
 
-    // Draw t-value labels
-    ctx.font = '11px monospace';
-    ctx.fillStyle = 'rgba(0, 255, 200, 0.7)';
-    const labelInterval = Math.max(1, Math.ceil(tRange / 20));
-    for (let t = Math.ceil(tMin / labelInterval) * labelInterval; t <= tMax; t += labelInterval) {
-        if (t < 0.1) continue;
-        const w = zeta([0.5, t], terms);
-        const screenX = centerX + (w[0] - pan[0]) * scale;
-        const screenY = centerY - (w[1] - pan[1]) * scale;
-        if (screenX > 30 && screenX < width - 30 && screenY > 20 && screenY < height - 20) {
-            ctx.fillText(`t=${t}`, screenX + 5, screenY - 5);
-        }
+    const pan = renderer.pan;
+    const zoom = renderer.zoom;
+    const terms = renderer.seriesTerms || 100;
+
+    // Determine t range based on current view
+    const tCenter = Math.max(0, pan[1]);
+    const tRange = Math.max(50, zoom * 2);
+    const tMin = Math.max(0, tCenter - tRange);
+    const tMax = tCenter + tRange;
+
+    const zoomRatio = built ? zoom / built.zoom : 0;
+    const valid = built && built.terms === terms &&
+        tMin >= built.tMin && tMax <= built.tMax &&
+        zoomRatio > 0.5 && zoomRatio < 2 &&
+        built.labelInterval === Math.max(1, Math.ceil(tRange / 20));
+
+    if (!valid) {
+        profiler.begin('zeta.build');
+        build(tCenter, tRange, terms);
+        profiler.end();
     }
+    if (!legendBatch) buildLegend();
 
-    // Legend
-    ctx.fillStyle = 'rgba(255, 255, 255, 0.8)';
-    ctx.font = '12px monospace';
-    ctx.fillText('ζ(½ + it) spiral [Riemann-Siegel]', 10, height - 30);
-    ctx.fillStyle = 'rgba(255, 255, 255, 0.5)';
-    ctx.fillText('Zeros = origin crossings', 10, height - 15);
+    profiler.begin('zeta');
+    layer.draw(renderer, lineBatch, glyphBatch);
+    layer.draw(renderer, null, legendBatch);
+    profiler.end();
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -338,42 +352,26 @@ function draw() {
 
 /**
  * Initializes the zeta path overlay
- * @param {HTMLCanvasElement} canvasElement - The canvas element
  * @param {Object} fractalRenderer - The renderer instance (for pan/zoom/terms)
  */
-export function init(canvasElement, fractalRenderer) {
-    canvas = canvasElement;
-    renderer = fractalRenderer;
-    if (canvas) {
-        ctx = canvas.getContext('2d');
-    }
+export function init(fractalRenderer) {
+    setRenderer(fractalRenderer);
 }
 
 /**
  * Shows the overlay
  */
 export function show() {
-    if (!canvas || !ctx || !renderer) return;
-
-    // Match the renderer's canvas size (includes DPI scaling)
-    canvas.width = renderer.canvas.width;
-    canvas.height = renderer.canvas.height;
-    // Set CSS display size to match viewport (like the main canvas)
-    canvas.style.width = '100vw';
-    canvas.style.height = '100vh';
-    canvas.classList.remove('zeta-path-hidden');
-    visible = true;
+    if (!layer || !renderer) return;
 
-    draw();
+    visible = true;
+    renderer.draw();
 }
 
 /**
- * Hides the overlay
+ * Hides the overlay. The curve disappears with the next frame.
  */
 export function hide() {
-    if (canvas) {
-        canvas.classList.add('zeta-path-hidden');
-    }
     visible = false;
 }
 
@@ -384,6 +382,7 @@ export function hide() {
 export function toggle() {
     if (visible) {
         hide();
+        renderer?.draw();
     } else {
         show();
     }
@@ -392,7 +391,7 @@ export function toggle() {
 }
 
 /**
- * Updates the overlay (redraws if visible)
+ * Updates the overlay. Called after each fractal draw; draws into the same frame.
  */
 export function update() {
     if (!visible) return;
@@ -400,19 +399,13 @@ export function update() {
 }
 
 /**
- * Resizes the canvas and redraws
+ * Handles canvas resize. Geometry is resolution independent; nothing to rebuild.
  */
 export function resize() {
-    if (!visible || !canvas || !renderer) return;
-    // Match the renderer's canvas size (includes DPI scaling)
-    canvas.width = renderer.canvas.width;
-    canvas.height = renderer.canvas.height;
-    // CSS display size is already set to 100vw/100vh
-    draw();
 }
 
 /**
- * @returns {boolean} current visibility state
+ * @returns {boolean}  current visibility state
  */
 export function isVisible() {
     return visible;
@@ -423,5 +416,13 @@ export function isVisible() {
  * @param {Object} fractalRenderer
  */
 export function setRenderer(fractalRenderer) {
+    if (layer && renderer !== fractalRenderer) {
+        layer.deleteBatch(lineBatch);
+        layer.deleteBatch(glyphBatch);
+        layer.deleteBatch(legendBatch);
+        lineBatch = glyphBatch = legendBatch = null;
+    }
     renderer = fractalRenderer;
+    layer = getOverlayLayer(renderer);
+    built = null;
 }
@@ -0,0 +1,200 @@
+/*
+ * ftravel-bench
+ * Escape kernel benchmark: renders a few representative views with every kernel variant the CPU supports, on one
+ * thread, and reports Mpixel/s and Mpixel*iter/s (escape iterations per second, the work-normalised figure). Then
+ * times exact progressive refinement on the work-stealing scheduler at 1, 2, 4, ... threads for thread scaling.
+ * Usage: ftravel-bench [--size WxH] [--min-time SECONDS] [--threads MAX] [--json PATH] [--help]
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+#include <thread>
+
+#include "refine.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+namespace {
+
+struct Scene {
+    const char* name;
+    View view;
+};
+
+struct Result {
+    std::string scene;
+    std::string kernel;
+    double seconds;
+    double mpixelPerSecond;
+    double mpixelIterPerSecond;
+    double speedup;
+};
+
+struct Scaling {
+    std::string scene;
+    unsigned threads;
+    double seconds;
+    double speedup;
+    std::size_t steals;
+};
+
+/** Repeats frame() until the total time is long enough to trust; returns the fastest run in seconds */
+template <typename Frame> double bestTime(double minTime, Frame frame) {
+    double best = 1e300, total = 0;
+    do {
+        const auto start = std::chrono::steady_clock::now();
+        frame();
+        const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, s);
+        total += s;
+    } while (total < minTime);
+    return best;
+}
+
+void printUsage() {
+    std::puts(
+        "Usage: ftravel-bench [options]\n"
+        "  --size WxH               Frame size (default 640x480)\n"
+        "  --min-time SECONDS       Time each measurement at least this long (default 0.5)\n"
+        "  --threads MAX            Largest thread count of the scaling table (default: all cores)\n"
+        "  --json PATH              Also write the results as JSON\n"
+        "  -h, --help               Show this help");
+}
+
+std::vector<Scene> scenes(int width, int height) {
+    View full;
+    full.iterations = 1000;
+
+    View seahorse;
+    seahorse.panX = -0.7436438870371587;
+    seahorse.panY = 0.1318259042053988;
+    seahorse.zoom = 5e-5;
+    seahorse.iterations = 3000;
+
+    View julia;
+    julia.fractal = Fractal::Julia;
+    julia.panX = 0;
+    julia.zoom = 3.5;
+    julia.cx = -0.8;
+    julia.cy = 0.156;
+    julia.iterations = 1000;
+
+    std::vector<Scene> list{{"mandelbrot-full", full}, {"mandelbrot-seahorse", seahorse}, {"julia-tentacles", julia}};
+    for (Scene& scene : list) {
+        scene.view.width = width;
+        scene.view.height = height;
+    }
+    return list;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int width = 640, height = 480;
+    double minTime = 0.5;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::string jsonPath;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "ftravel-bench: %s: missing value\n", arg.c_str());
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--size") {
+            if (std::sscanf(value, "%dx%d", &width, &height) != 2) return std::fprintf(stderr, "Bad --size\n"), 1;
+        } else if (arg == "--min-time") {
+            minTime = std::atof(value);
+        } else if (arg == "--threads") {
+            maxThreads = unsigned(std::max(1, std::atoi(value)));
+        } else if (arg == "--json") {
+            jsonPath = value;
+        } else {
+            std::fprintf(stderr, "ftravel-bench: Unknown option: %s\n", arg.c_str());
+            printUsage();
+            return 1;
+        }
+    }
+
+    ThreadPool pool(1);
+    std::vector<Result> results;
+    std::printf("%-22s %-8s %10s %12s %16s %8s\n", "scene", "kernel", "ms/frame", "Mpixel/s", "Mpixel*iter/s", "speedup");
+
+    for (const Scene& scene : scenes(width, height)) {
+        double scalarSeconds = 0;
+        for (const EscapeKernel& kernel : availableKernels()) {
+            double iterations = 0;
+            const double best = bestTime(minTime, [&] {
+                const std::vector<std::int32_t> counts = renderCounts(scene.view, pool, kernel);
+                iterations = std::accumulate(counts.begin(), counts.end(), 0.0);
+            });
+
+            if (scalarSeconds == 0) scalarSeconds = best;
+            const double pixels = double(width) * height;
+            results.push_back({scene.name, kernel.name, best, pixels / best / 1e6, iterations / best / 1e6,
+                               scalarSeconds / best});
+            const Result& r = results.back();
+            std::printf("%-22s %-8s %10.2f %12.2f %16.1f %7.2fx\n", r.scene.c_str(), r.kernel.c_str(), r.seconds * 1e3,
+                        r.mpixelPerSecond, r.mpixelIterPerSecond, r.speedup);
+        }
+    }
+
+    // Thread scaling of exact refinement; per-pixel cost is very uneven in every scene, so this measures the stealing
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    std::vector<Scaling> scaling;
+    std::printf("\n%-22s %-8s %10s %8s %8s\n", "scene", "threads", "ms/frame", "speedup", "steals");
+    RefineOptions exact;
+    exact.guess = false;
+    for (const Scene& scene : scenes(width, height)) {
+        double oneThread = 0;
+        for (unsigned threads : threadCounts) {
+            WorkStealingScheduler scheduler(threads);
+            std::vector<std::int32_t> counts;
+            const double best = bestTime(minTime, [&] { refineCounts(scene.view, scheduler, counts, exact); });
+            if (oneThread == 0) oneThread = best;
+            scaling.push_back({scene.name, threads, best, oneThread / best, scheduler.steals()});
+            const Scaling& r = scaling.back();
+            std::printf("%-22s %-8u %10.2f %7.2fx %8zu\n", r.scene.c_str(), r.threads, r.seconds * 1e3, r.speedup,
+                        r.steals);
+        }
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        json << "{\"width\": " << width << ", \"height\": " << height << ", \"results\": [";
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            json << (i ? ",\n  " : "\n  ") << "{\"scene\": \"" << r.scene << "\", \"kernel\": \"" << r.kernel
+                 << "\", \"ms\": " << r.seconds * 1e3 << ", \"mpixelPerSecond\": " << r.mpixelPerSecond
+                 << ", \"mpixelIterPerSecond\": " << r.mpixelIterPerSecond << ", \"speedup\": " << r.speedup << "}";
+        }
+        json << "\n], \"scaling\": [";
+        for (std::size_t i = 0; i < scaling.size(); i++) {
+            const Scaling& r = scaling[i];
+            json << (i ? ",\n  " : "\n  ") << "{\"scene\": \"" << r.scene << "\", \"threads\": " << r.threads
+                 << ", \"ms\": " << r.seconds * 1e3 << ", \"speedup\": " << r.speedup << ", \"steals\": " << r.steals
+                 << "}";
+        }
+        json << "\n]}\n";
+        if (!json) return std::fprintf(stderr, "Cannot write %s\n", jsonPath.c_str()), 1;
+    }
+    return 0;
+}
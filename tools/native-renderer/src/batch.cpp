@@ -0,0 +1,239 @@
+/*
+ * Batch
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "batch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+
+#include "preset.h"
+
+namespace ftravel {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string lower(std::string text) {
+    for (char& ch : text) {
+        if (ch >= 'A' && ch <= 'Z') ch = char(ch - 'A' + 'a');
+    }
+    return text;
+}
+
+bool matches(const std::string& id, const std::vector<std::string>& filters) {
+    if (filters.empty()) return true;
+    const std::string key = lower(id);
+    return std::any_of(filters.begin(), filters.end(),
+                       [&](const std::string& filter) { return key.find(lower(filter)) != std::string::npos; });
+}
+
+std::string quoted(const std::string& text) {
+    std::string out = "\"";
+    for (const char ch : text) {
+        if (ch == '"' || ch == '\\') {
+            out += '\\';
+            out += ch;
+        } else if (static_cast<unsigned char>(ch) < 0x20) {
+            char escape[8];
+            std::snprintf(escape, sizeof escape, "\\u%04x", ch);
+            out += escape;
+        } else {
+            out += ch;
+        }
+    }
+    return out + '"';
+}
+
+std::string number(double value) {
+    char text[32];
+    std::snprintf(text, sizeof text, "%.6g", value);
+    return text;
+}
+
+} // namespace
+
+std::string slug(const std::string& text) {
+    std::string out;
+    for (const char ch : lower(text)) {
+        if ((ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9')) {
+            out += ch;
+        } else if (!out.empty() && out.back() != '-') {
+            out += '-';
+        }
+    }
+    while (!out.empty() && out.back() == '-') out.pop_back();
+    return out.empty() ? "view" : out;
+}
+
+void planPresets(const JsonValue& data, const std::string& source, const BatchOptions& options, BatchPlan& plan) {
+    const JsonValue* type = data.find("type");
+    const JsonValue* views = data.find("views");
+    if (!type || !type->isString() || !views || !views->isArray()) {
+        plan.skipped.push_back({source, "", "not a preset file"});
+        return;
+    }
+    const std::string& name = type->text;
+    if (name != "MANDELBROT" && name != "JULIA") {
+        plan.skipped.push_back({source, "", "no native renderer for " + name});
+        return;
+    }
+    const Fractal fractal = name == "JULIA" ? Fractal::Julia : Fractal::Mandelbrot;
+
+    for (std::size_t i = 0; i < views->items.size(); i++) {
+        const JsonValue& preset = views->items[i];
+        const JsonValue* id = preset.find("id");
+        const std::string label = id && id->isString() ? id->text : "#" + std::to_string(i);
+        if (!matches(label, options.filters)) continue;
+
+        BatchItem item;
+        item.source = source;
+        item.index = int(i);
+        item.id = label;
+        try {
+            item.view = presetView(preset, fractal);
+            item.palette = viewPalette(data, preset, fractal);
+        } catch (const std::invalid_argument& e) {
+            plan.skipped.push_back({source, label, e.what()});
+            continue;
+        }
+        item.zoom = preset.find("zoom")->text;
+        item.view.view.width = options.width;
+        item.view.view.height = options.height;
+
+        char prefix[16];
+        std::snprintf(prefix, sizeof prefix, "-%02d-", item.index);
+        item.file = lower(name) + prefix + slug(label) + "." + options.format;
+        plan.items.push_back(std::move(item));
+    }
+}
+
+std::vector<BatchResult> renderBatch(const BatchPlan& plan, const BatchOptions& options, ThreadPool& pool,
+                                     const std::function<void(const BatchItem&, const BatchResult&)>& done) {
+    const std::filesystem::path dir(options.outDir);
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    if (error) throw std::runtime_error(options.outDir + ": " + error.message());
+
+    std::vector<BatchResult> results(plan.items.size());
+
+    const long long pixels = (long long)options.width * options.height;
+    const std::size_t groupSize = std::size_t(std::max(1LL, BATCH_PIXEL_BUDGET / pixels));
+
+    for (std::size_t first = 0; first < plan.items.size(); first += groupSize) {
+        const std::size_t count = std::min(groupSize, plan.items.size() - first);
+
+        // Reference orbits: one bignum iteration per view, the views in parallel
+        std::vector<std::unique_ptr<DeepFrame>> frames(count);
+        pool.parallelFor(count, [&](std::size_t i) {
+            const auto start = Clock::now();
+            try {
+                frames[i] = std::make_unique<DeepFrame>(plan.items[first + i].view, options.deep);
+            } catch (const std::exception& e) {
+                results[first + i].error = e.what();
+            }
+            results[first + i].orbitMs = msSince(start);
+        });
+
+        // Tiles of every view of the group, handed out together
+        std::vector<std::vector<std::int32_t>> counts(count);
+        std::vector<std::vector<float>> escapeR2(count);
+        std::vector<std::vector<double>> tileMs(count);
+        std::vector<std::size_t> tileEnd(count);
+        std::size_t tiles = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (frames[i]) {
+                counts[i].assign(std::size_t(pixels), 0);
+                escapeR2[i].assign(std::size_t(pixels), 0.0f);
+                tileMs[i].assign(frames[i]->tileCount(), 0.0);
+                tiles += frames[i]->tileCount();
+            }
+            tileEnd[i] = tiles;
+        }
+        pool.parallelFor(tiles, [&](std::size_t job) {
+            const std::size_t i = std::size_t(std::upper_bound(tileEnd.begin(), tileEnd.end(), job) - tileEnd.begin());
+            const std::size_t tile = job - (i > 0 ? tileEnd[i - 1] : 0);
+            const auto start = Clock::now();
+            frames[i]->renderTile(tile, counts[i], &escapeR2[i]);
+            tileMs[i][tile] = msSince(start);
+        });
+
+        // Colouring and encoding, the views in parallel
+        pool.parallelFor(count, [&](std::size_t i) {
+            if (!frames[i]) return;
+            const BatchItem& item = plan.items[first + i];
+            BatchResult& result = results[first + i];
+            result.stats = frames[i]->stats();
+            for (const double ms : tileMs[i]) result.tileMs += ms;
+            try {
+                writeImage(colorizeWeb(item.view.view, counts[i], escapeR2[i], item.palette), (dir / item.file).string());
+            } catch (const std::exception& e) {
+                result.error = e.what();
+            }
+            std::vector<std::int32_t>().swap(counts[i]);
+            std::vector<float>().swap(escapeR2[i]);
+        });
+
+        if (done) {
+            for (std::size_t i = 0; i < count; i++) done(plan.items[first + i], results[first + i]);
+        }
+    }
+    return results;
+}
+
+std::string batchManifest(const BatchPlan& plan, const std::vector<BatchResult>& results, const BatchOptions& options) {
+    std::string out = "{\n  \"width\": " + std::to_string(options.width) + ",\n  \"height\": " +
+                      std::to_string(options.height) + ",\n  \"renders\": [";
+
+    for (std::size_t i = 0; i < plan.items.size(); i++) {
+        const BatchItem& item = plan.items[i];
+        const BatchResult& result = results[i];
+        const View& view = item.view.view;
+        const bool julia = view.fractal == Fractal::Julia;
+        const DeepStats& stats = result.stats;
+        const double total = double(stats.stepped + stats.skipped);
+
+        out += i ? ",\n    {" : "\n    {";
+        out += "\"file\": " + (result.error.empty() ? quoted(item.file) : "null");
+        out += ", \"source\": " + quoted(item.source) + ", \"index\": " + std::to_string(item.index);
+        out += ", \"id\": " + quoted(item.id) + ", \"paletteId\": " + quoted(item.palette.id);
+        out += ",\n     \"pan\": [" + quoted(item.view.panX) + ", " + quoted(item.view.panY) + "]";
+        out += ", \"zoom\": " + quoted(item.zoom);
+        if (julia) out += ", \"c\": [" + quoted(item.view.cx) + ", " + quoted(item.view.cy) + "]";
+        out += ", \"iterations\": " + std::to_string(presetIterations(view.fractal, item.view.zoom));
+        out += ",\n     \"precisionBits\": " + std::to_string(stats.precisionBits);
+        out += ", \"orbitLength\": " + std::to_string(stats.orbitLength);
+        out += ", \"blaLevels\": " + std::to_string(stats.blaLevels);
+        out += ", \"extended\": " + std::string(stats.extended ? "true" : "false");
+        out += ", \"skippedIterations\": " + number(total > 0 ? stats.skipped / total : 0);
+        out += ",\n     \"orbitMs\": " + number(result.orbitMs) + ", \"tileMs\": " + number(result.tileMs);
+        if (!result.error.empty()) out += ", \"error\": " + quoted(result.error);
+        out += "}";
+    }
+
+    out += plan.items.empty() ? "],\n  \"skipped\": [" : "\n  ],\n  \"skipped\": [";
+    for (std::size_t i = 0; i < plan.skipped.size(); i++) {
+        const BatchSkip& skip = plan.skipped[i];
+        out += i ? ",\n    {" : "\n    {";
+        out += "\"source\": " + quoted(skip.source);
+        if (!skip.id.empty()) out += ", \"id\": " + quoted(skip.id);
+        out += ", \"reason\": " + quoted(skip.reason) + "}";
+    }
+    out += plan.skipped.empty() ? "]\n}\n" : "\n  ]\n}\n";
+    return out;
+}
+
+} // namespace ftravel
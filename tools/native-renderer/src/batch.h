@@ -0,0 +1,94 @@
+/*
+ * Batch
+ * Renders the views of the web app's preset files (src/data/mandelbrot.json, julia.json) in one go, coloured as the
+ * app colours them, into a directory of images with a JSON manifest. Every view goes through the perturbation engine,
+ * which yields |z|² at the escape for the smooth colouring at any depth. Reference orbits are built in parallel across
+ * views, then the tiles of all views in a group share the pool, so a deep view's tiles interleave with cheap ones.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "deep.h"
+#include "json.h"
+#include "webPalette.h"
+
+namespace ftravel {
+
+/** Pixels of the views rendered together; bounds the count and |z|² buffers held at once (8 bytes per pixel) */
+constexpr long long BATCH_PIXEL_BUDGET = 1LL << 24;
+
+struct BatchOptions {
+    int width = 1920;
+    int height = 1080;
+    /** View ids to render, matched as case-insensitive substrings; all views when empty */
+    std::vector<std::string> filters;
+    /** Output directory, created if missing */
+    std::string outDir = "gallery";
+    /** Image format and file extension: png or ppm */
+    std::string format = "png";
+    DeepOptions deep;
+};
+
+/** One view queued for rendering */
+struct BatchItem {
+    /** Preset file name and the view's index and id in it */
+    std::string source;
+    int index = 0;
+    std::string id;
+    /** Zoom as the preset writes it */
+    std::string zoom;
+    DeepView view;
+    WebPalette palette;
+    /** Image file name in the output directory */
+    std::string file;
+};
+
+/** A view or a whole file left out, with the reason */
+struct BatchSkip {
+    std::string source;
+    std::string id;
+    std::string reason;
+};
+
+struct BatchPlan {
+    std::vector<BatchItem> items;
+    std::vector<BatchSkip> skipped;
+};
+
+struct BatchResult {
+    DeepStats stats;
+    /** Reference orbit and BLA table, and the tiles summed over threads */
+    double orbitMs = 0;
+    double tileMs = 0;
+    /** Why the view has no image; empty on success */
+    std::string error;
+};
+
+/**
+ * Adds the views of a parsed preset file to the plan. Files of fractals without a native renderer, and malformed
+ * views, go to plan.skipped.
+ */
+void planPresets(const JsonValue& data, const std::string& source, const BatchOptions& options, BatchPlan& plan);
+
+/** "Seahorse Valley" -> "seahorse-valley" */
+std::string slug(const std::string& text);
+
+/**
+ * Renders every planned view into options.outDir. done is called on the calling thread as views finish.
+ * @throws std::runtime_error when the output directory cannot be created
+ */
+std::vector<BatchResult> renderBatch(const BatchPlan& plan, const BatchOptions& options, ThreadPool& pool,
+                                     const std::function<void(const BatchItem&, const BatchResult&)>& done = {});
+
+/** The manifest: size, one entry per rendered view (with its file, preset fields and timings), the skipped ones */
+std::string batchManifest(const BatchPlan& plan, const std::vector<BatchResult>& results, const BatchOptions& options);
+
+} // namespace ftravel
@@ -0,0 +1,142 @@
+/*
+ * ftravel-batch
+ * Renders the views of the web app's preset files, coloured with their palettes, into a directory of images with a
+ * manifest.json (see batch.h).
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "batch.h"
+
+using namespace ftravel;
+
+namespace {
+
+struct Options {
+    std::vector<std::string> files;
+    BatchOptions batch;
+    /** 0 = every hardware thread */
+    unsigned threads = 0;
+};
+
+void printUsage() {
+    std::puts(
+        "Usage: ftravel-batch [options] FILE...\n"
+        "  FILE                     Preset file of the web app (src/data/mandelbrot.json, julia.json)\n"
+        "  --size WxH               Image size (default 1920x1080)\n"
+        "  --filter TEXT            Render views whose id contains TEXT, any case; repeatable (default all)\n"
+        "  --format png|ppm         Image format (default png)\n"
+        "  --threads N              Threads (default: all cores)\n"
+        "  --no-bla                 Perturbation without bivariate linear approximation\n"
+        "  -o, --out DIR            Output directory for the images and manifest.json (default gallery)\n"
+        "  -h, --help               Show this help");
+}
+
+int parseInt(const std::string& text, const std::string& option) {
+    char* end = nullptr;
+    const long value = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0') throw std::invalid_argument(option + ": not an integer: '" + text + "'");
+    return int(value);
+}
+
+Options parseArgs(int argc, char** argv) {
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const auto value = [&]() -> std::string {
+            if (i + 1 >= argc) throw std::invalid_argument(arg + ": missing value");
+            return argv[++i];
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            std::exit(0);
+        } else if (arg == "--size") {
+            const std::string size = value();
+            const std::size_t at = size.find('x');
+            if (at == std::string::npos) throw std::invalid_argument(arg + ": expected WxH");
+            options.batch.width = parseInt(size.substr(0, at), arg);
+            options.batch.height = parseInt(size.substr(at + 1), arg);
+        } else if (arg == "--filter") {
+            options.batch.filters.push_back(value());
+        } else if (arg == "--format") {
+            options.batch.format = value();
+            if (options.batch.format != "png" && options.batch.format != "ppm") {
+                throw std::invalid_argument(arg + ": expected png or ppm");
+            }
+        } else if (arg == "--threads") {
+            const int threads = parseInt(value(), arg);
+            if (threads < 1) throw std::invalid_argument(arg + ": must be positive");
+            options.threads = unsigned(threads);
+        } else if (arg == "--no-bla") {
+            options.batch.deep.bla = false;
+        } else if (arg == "-o" || arg == "--out") {
+            options.batch.outDir = value();
+        } else if (!arg.empty() && arg[0] == '-') {
+            throw std::invalid_argument("Unknown option: " + arg);
+        } else {
+            options.files.push_back(arg);
+        }
+    }
+
+    if (options.files.empty()) throw std::invalid_argument("No preset files given (see --help)");
+    if (options.batch.width <= 0 || options.batch.height <= 0) throw std::invalid_argument("--size: must be positive");
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        const Options options = parseArgs(argc, argv);
+
+        BatchPlan plan;
+        for (const std::string& file : options.files) {
+            planPresets(readJsonFile(file), std::filesystem::path(file).filename().string(), options.batch, plan);
+        }
+        for (const BatchSkip& skip : plan.skipped) {
+            std::fprintf(stderr, "%s%s%s: skipped, %s\n", skip.source.c_str(), skip.id.empty() ? "" : " ",
+                         skip.id.c_str(), skip.reason.c_str());
+        }
+
+        ThreadPool pool(options.threads);
+        const auto start = std::chrono::steady_clock::now();
+        const std::vector<BatchResult> results =
+            renderBatch(plan, options.batch, pool, [](const BatchItem& item, const BatchResult& result) {
+                if (!result.error.empty()) {
+                    std::fprintf(stderr, "%s %s: %s\n", item.source.c_str(), item.id.c_str(), result.error.c_str());
+                    return;
+                }
+                std::fprintf(stderr, "%s: zoom %s, %d iterations, orbit %.1f ms, tiles %.1f ms%s\n", item.file.c_str(),
+                             item.zoom.c_str(), item.view.view.iterations, result.orbitMs, result.tileMs,
+                             result.stats.extended ? ", extended exponent" : "");
+            });
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const std::string manifest = (std::filesystem::path(options.batch.outDir) / "manifest.json").string();
+        std::ofstream out(manifest, std::ios::binary);
+        out << batchManifest(plan, results, options.batch);
+        if (!out) throw std::runtime_error(manifest + ": write failed");
+
+        int failed = 0;
+        for (const BatchResult& result : results) failed += !result.error.empty();
+        std::fprintf(stderr, "%zu views in %.1f s on %u threads, %d failed, %zu skipped -> %s\n", results.size(),
+                     ms / 1e3, pool.size(), failed, plan.skipped.size(), manifest.c_str());
+        return failed ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "ftravel-batch: %s\n", e.what());
+        return 1;
+    }
+}
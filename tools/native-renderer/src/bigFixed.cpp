@@ -0,0 +1,257 @@
+/*
+ * Fixed-point bignum
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "bigFixed.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+namespace ftravel {
+
+namespace {
+
+/** out[0, na + nb) = a * b; out must not alias the operands */
+void schoolbook(const std::uint32_t* a, std::size_t na, const std::uint32_t* b, std::size_t nb, std::uint32_t* out) {
+    std::fill(out, out + na + nb, 0u);
+    for (std::size_t i = 0; i < na; i++) {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < nb; j++) {
+            const std::uint64_t t = std::uint64_t(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = std::uint32_t(t);
+            carry = t >> 32;
+        }
+        out[i + nb] = std::uint32_t(carry);
+    }
+}
+
+/** out[offset, size) += src[0, n); src limbs past size must be zero (the sum fits) */
+void addAt(std::uint32_t* out, std::size_t size, std::size_t offset, const std::uint32_t* src, std::size_t n) {
+    std::uint64_t carry = 0;
+    std::size_t i = 0;
+    for (; i < n && offset + i < size; i++) {
+        const std::uint64_t t = std::uint64_t(out[offset + i]) + src[i] + carry;
+        out[offset + i] = std::uint32_t(t);
+        carry = t >> 32;
+    }
+    for (i += offset; carry && i < size; i++) {
+        const std::uint64_t t = std::uint64_t(out[i]) + carry;
+        out[i] = std::uint32_t(t);
+        carry = t >> 32;
+    }
+}
+
+/** a[0, na) -= b[0, nb); a >= b */
+void subtractFrom(std::uint32_t* a, std::size_t na, const std::uint32_t* b, std::size_t nb) {
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < na; i++) {
+        const std::int64_t t = std::int64_t(a[i]) - (i < nb ? b[i] : 0) - borrow;
+        a[i] = std::uint32_t(t);
+        borrow = t < 0;
+    }
+}
+
+/** out[0, 2n) = a[0, n) * b[0, n) */
+void karatsuba(const std::uint32_t* a, const std::uint32_t* b, std::size_t n, std::uint32_t* out) {
+    if (n < KARATSUBA_LIMBS) {
+        schoolbook(a, n, b, n, out);
+        return;
+    }
+
+    // a = a1 * B^lo + a0, b likewise; hi >= lo
+    const std::size_t lo = n / 2;
+    const std::size_t hi = n - lo;
+    karatsuba(a, b, lo, out);                    // z0 = a0 * b0 -> out[0, 2lo)
+    karatsuba(a + lo, b + lo, hi, out + 2 * lo); // z2 = a1 * b1 -> out[2lo, 2n)
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+    Limbs sa(hi + 1, 0), sb(hi + 1, 0);
+    std::copy(a + lo, a + n, sa.begin());
+    std::copy(b + lo, b + n, sb.begin());
+    addAt(sa.data(), hi + 1, 0, a, lo);
+    addAt(sb.data(), hi + 1, 0, b, lo);
+    Limbs z1(2 * (hi + 1));
+    karatsuba(sa.data(), sb.data(), hi + 1, z1.data());
+    subtractFrom(z1.data(), z1.size(), out, 2 * lo);
+    subtractFrom(z1.data(), z1.size(), out + 2 * lo, 2 * hi);
+
+    addAt(out, 2 * n, lo, z1.data(), z1.size());
+}
+
+int compareMagnitude(const Limbs& a, const Limbs& b) {
+    for (std::size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/** a /= divisor, returns the remainder */
+std::uint32_t divideSmall(Limbs& a, std::uint32_t divisor) {
+    std::uint64_t remainder = 0;
+    for (std::size_t i = a.size(); i-- > 0;) {
+        const std::uint64_t t = (remainder << 32) | a[i];
+        a[i] = std::uint32_t(t / divisor);
+        remainder = t % divisor;
+    }
+    return std::uint32_t(remainder);
+}
+
+} // namespace
+
+Limbs multiplySchoolbook(const Limbs& a, const Limbs& b) {
+    Limbs out(a.size() + b.size());
+    schoolbook(a.data(), a.size(), b.data(), b.size(), out.data());
+    return out;
+}
+
+Limbs multiplyLimbs(const Limbs& a, const Limbs& b) {
+    if (a.size() != b.size()) throw std::invalid_argument("multiplyLimbs: operands differ in length");
+    Limbs out(2 * a.size());
+    if (!a.empty()) karatsuba(a.data(), b.data(), a.size(), out.data());
+    return out;
+}
+
+BigFixed::BigFixed(int fractionLimbs) : limbs_(std::size_t(std::max(fractionLimbs, 0)) + 1, 0u) {}
+
+BigFixed BigFixed::parse(const std::string& text, int fractionLimbs) {
+    const auto fail = [&]() -> BigFixed { throw std::invalid_argument("Not a decimal number: '" + text + "'"); };
+
+    // [sign] digits [. digits] [e [sign] digits]
+    std::size_t i = 0;
+    bool negative = false;
+    if (i < text.size() && (text[i] == '-' || text[i] == '+')) negative = text[i++] == '-';
+    std::string digits;
+    long point = -1;
+    for (; i < text.size(); i++) {
+        const char ch = text[i];
+        if (std::isdigit(static_cast<unsigned char>(ch))) {
+            digits += ch;
+        } else if (ch == '.' && point < 0) {
+            point = long(digits.size());
+        } else {
+            break;
+        }
+    }
+    if (digits.empty()) return fail();
+    if (point < 0) point = long(digits.size());
+
+    long exponent = 0;
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        std::size_t used = 0;
+        try {
+            exponent = std::stol(text.substr(i + 1), &used);
+        } catch (const std::exception&) {
+            return fail();
+        }
+        if (used == 0) return fail();
+        i += 1 + used;
+    }
+    if (i != text.size()) return fail();
+
+    // Move the decimal point by the exponent: integer digits | fraction digits
+    point += exponent;
+    if (point < 0) {
+        digits.insert(0, std::size_t(-point), '0');
+        point = 0;
+    } else if (point > long(digits.size())) {
+        digits.append(std::size_t(point) - digits.size(), '0');
+    }
+
+    BigFixed result(fractionLimbs);
+    const std::size_t integerEnd = std::size_t(point);
+    const std::size_t firstDigit = digits.find_first_not_of('0');
+    if (firstDigit != std::string::npos && firstDigit < integerEnd && integerEnd - firstDigit > 10) return fail();
+    const std::uint64_t integer = integerEnd ? std::stoull(digits.substr(0, integerEnd)) : 0;
+    if (integer > 0xFFFFFFFFull) return fail();
+
+    // 0.d1 d2 ... dk from the last digit up: v = (d + v) / 10. Digits well past the precision cannot change it.
+    const std::size_t significant = std::size_t(fractionLimbs) * 10 + 20;
+    const std::size_t end = std::min(digits.size(), integerEnd + significant);
+    Limbs& v = result.limbs_;
+    for (std::size_t k = end; k-- > integerEnd;) {
+        v.back() += std::uint32_t(digits[k] - '0');
+        divideSmall(v, 10);
+    }
+    v.back() = std::uint32_t(integer);
+    result.negative_ = negative && !result.isZero();
+    return result;
+}
+
+bool BigFixed::isZero() const {
+    return std::all_of(limbs_.begin(), limbs_.end(), [](std::uint32_t limb) { return limb == 0; });
+}
+
+double BigFixed::toDouble() const {
+    std::size_t top = limbs_.size();
+    while (top > 0 && limbs_[top - 1] == 0) top--;
+    if (top == 0) return 0.0;
+
+    // Three limbs hold more than a double's 53 bits
+    double value = 0;
+    const std::size_t low = top >= 3 ? top - 3 : 0;
+    for (std::size_t i = top; i-- > low;) value = value * 4294967296.0 + limbs_[i];
+    value = std::ldexp(value, 32 * (int(low) - fractionLimbs()));
+    return negative_ ? -value : value;
+}
+
+BigFixed BigFixed::add(const BigFixed& other, bool negate) const {
+    if (other.limbs_.size() != limbs_.size()) throw std::invalid_argument("BigFixed: operands differ in precision");
+    const bool otherNegative = other.negative_ != negate;
+
+    BigFixed result(fractionLimbs());
+    if (negative_ == otherNegative) {
+        result.limbs_ = limbs_;
+        addAt(result.limbs_.data(), limbs_.size(), 0, other.limbs_.data(), other.limbs_.size());
+        result.negative_ = negative_;
+    } else if (compareMagnitude(limbs_, other.limbs_) >= 0) {
+        result.limbs_ = limbs_;
+        subtractFrom(result.limbs_.data(), limbs_.size(), other.limbs_.data(), other.limbs_.size());
+        result.negative_ = negative_;
+    } else {
+        result.limbs_ = other.limbs_;
+        subtractFrom(result.limbs_.data(), limbs_.size(), limbs_.data(), limbs_.size());
+        result.negative_ = otherNegative;
+    }
+    if (result.isZero()) result.negative_ = false;
+    return result;
+}
+
+BigFixed BigFixed::operator+(const BigFixed& other) const { return add(other, false); }
+
+BigFixed BigFixed::operator-(const BigFixed& other) const { return add(other, true); }
+
+BigFixed BigFixed::operator-() const {
+    BigFixed result = *this;
+    result.negative_ = !negative_ && !isZero();
+    return result;
+}
+
+BigFixed BigFixed::operator*(const BigFixed& other) const {
+    if (other.limbs_.size() != limbs_.size()) throw std::invalid_argument("BigFixed: operands differ in precision");
+
+    // The full product has 2 * fraction limbs below the point; drop the lowest fraction limbs (truncation)
+    const Limbs product = multiplyLimbs(limbs_, other.limbs_);
+    BigFixed result(fractionLimbs());
+    std::copy_n(product.begin() + fractionLimbs(), limbs_.size(), result.limbs_.begin());
+    result.negative_ = (negative_ != other.negative_) && !result.isZero();
+    return result;
+}
+
+BigFixed BigFixed::twice() const {
+    BigFixed result = *this;
+    std::uint32_t carry = 0;
+    for (std::uint32_t& limb : result.limbs_) {
+        const std::uint32_t next = limb >> 31;
+        limb = (limb << 1) | carry;
+        carry = next;
+    }
+    return result;
+}
+
+} // namespace ftravel
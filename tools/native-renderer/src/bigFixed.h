@@ -0,0 +1,66 @@
+/*
+ * Fixed-point bignum
+ * Signed fixed-point numbers with one 32-bit integer limb and a chosen number of 32-bit fraction limbs, enough for
+ * reference orbits at any depth (|z| stays below 2 until it escapes). Products are truncated back to the operands'
+ * precision. Multiplication is Karatsuba from KARATSUBA_LIMBS limbs up and schoolbook below. Self-contained: no GMP,
+ * no MPFR.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ftravel {
+
+/** Operand length (limbs) from which a product is split the Karatsuba way */
+constexpr std::size_t KARATSUBA_LIMBS = 24;
+
+/** Little-endian 32-bit limbs of an unsigned magnitude */
+using Limbs = std::vector<std::uint32_t>;
+
+class BigFixed {
+public:
+    /** Zero with the given precision */
+    explicit BigFixed(int fractionLimbs = 2);
+
+    /**
+     * Decimal text as the presets write coordinates: "-1.675119031002389347051462", "0", "1.25e-40". Digits beyond
+     * the precision are truncated. Throws std::invalid_argument on anything else or an integer part over 32 bits.
+     */
+    static BigFixed parse(const std::string& text, int fractionLimbs);
+
+    int fractionLimbs() const { return int(limbs_.size()) - 1; }
+    bool negative() const { return negative_; }
+    bool isZero() const;
+
+    /** Nearest double (to within an ulp) */
+    double toDouble() const;
+
+    BigFixed operator+(const BigFixed& other) const;
+    BigFixed operator-(const BigFixed& other) const;
+    BigFixed operator*(const BigFixed& other) const;
+    BigFixed operator-() const;
+    /** this * 2 */
+    BigFixed twice() const;
+
+private:
+    bool negative_ = false;
+    /** Magnitude; the last limb is the integer part */
+    Limbs limbs_;
+
+    BigFixed add(const BigFixed& other, bool negate) const;
+};
+
+/** Product of two magnitudes of equal length n into 2n limbs, Karatsuba above KARATSUBA_LIMBS */
+Limbs multiplyLimbs(const Limbs& a, const Limbs& b);
+
+/** Product of two magnitudes into a.size() + b.size() limbs, schoolbook */
+Limbs multiplySchoolbook(const Limbs& a, const Limbs& b);
+
+} // namespace ftravel
@@ -0,0 +1,395 @@
+/*
+ * Deep zoom
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "deep.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+#include "bigFixed.h"
+
+namespace ftravel {
+
+namespace {
+
+/** One BLA step: dz -> A dz + B dc, valid while |dz| < r */
+template <typename T> struct BlaStep {
+    T ax, ay, bx, by, r, r2;
+};
+
+/** What every pixel of a frame shares: the reference orbit and the BLA table over it */
+template <typename T> struct Frame {
+    const std::vector<double>* orbit;
+    int orbitLength;
+    /** Highest iteration index checked for escape; a pixel escaping at index n counts n - offset */
+    int lastIndex;
+    int offset;
+    int limit;
+    bool julia;
+    /** Orbit index of the first BLA step (Mandelbrot's Z0 = 0 admits none) */
+    int blaStart;
+    /** Level l holds steps of 2^l iterations starting at blaStart + k * 2^l */
+    std::vector<std::vector<BlaStep<T>>> bla;
+};
+
+/**
+ * Last orbit index the iterators check: z_1 .. z_limit for Mandelbrot (z_0 = 0 is skipped), z_0 .. z_(limit - 1) for
+ * Julia, so that a point escaping at the last check counts limit - 1 either way
+ */
+int lastOrbitIndex(const View& view) {
+    return view.fractal == Fractal::Julia ? view.iterations - 1 : view.iterations;
+}
+
+template <typename T> T zoomAs(const FloatExp& zoom) {
+    if constexpr (std::is_same_v<T, double>) {
+        return toDouble(zoom);
+    } else {
+        return zoom;
+    }
+}
+
+template <typename T> T magnitude(const T& x, const T& y) {
+    using std::sqrt;
+    return sqrt(x * x + y * y);
+}
+
+/** Fraction limbs for a zoom: the pixel spacing plus 64 guard bits */
+int precisionLimbs(const FloatExp& zoom, int height) {
+    const double bits = std::max(0.0, -log2(zoom)) + std::log2(double(std::max(height, 1))) + 64;
+    return int(std::ceil(bits / 32));
+}
+
+/** Z_0 .. up to Z_lastIndex, or to the first escaped point, as x, y pairs */
+std::vector<double> referenceOrbit(const DeepView& deep, int limbs, int lastIndex) {
+    const BigFixed panX = BigFixed::parse(deep.panX, limbs);
+    const BigFixed panY = BigFixed::parse(deep.panY, limbs);
+    const bool julia = deep.view.fractal == Fractal::Julia;
+    BigFixed zx = julia ? panX : BigFixed(limbs);
+    BigFixed zy = julia ? panY : BigFixed(limbs);
+    const BigFixed cx = julia ? BigFixed::parse(deep.cx, limbs) : panX;
+    const BigFixed cy = julia ? BigFixed::parse(deep.cy, limbs) : panY;
+
+    std::vector<double> orbit;
+    orbit.reserve(2 * std::size_t(lastIndex + 1));
+    for (int n = 0; n <= lastIndex; n++) {
+        const double x = zx.toDouble();
+        const double y = zy.toDouble();
+        orbit.push_back(x);
+        orbit.push_back(y);
+        if (x * x + y * y > 4) break;
+
+        const BigFixed xy = zx * zy;
+        zx = zx * zx - zy * zy + cx;
+        zy = xy.twice() + cy;
+    }
+    return orbit;
+}
+
+/** x then y: the composite step and the radius within which both stay valid */
+template <typename T> BlaStep<T> mergeSteps(const BlaStep<T>& x, const BlaStep<T>& y, const T& dcMax) {
+    BlaStep<T> z;
+    z.ax = y.ax * x.ax - y.ay * x.ay;
+    z.ay = y.ax * x.ay + y.ay * x.ax;
+    z.bx = y.ax * x.bx - y.ay * x.by + y.bx;
+    z.by = y.ax * x.by + y.ay * x.bx + y.by;
+
+    // After x, |dz| <= |Ax| |dz| + |Bx| |dc|, which must stay within y's radius
+    const T zero(0.0);
+    const T ax = magnitude(x.ax, x.ay);
+    T r = zero;
+    if (zero < ax) {
+        const T ry = (y.r - magnitude(x.bx, x.by) * dcMax) / ax;
+        r = ry < x.r ? ry : x.r;
+        if (r < zero) r = zero;
+    }
+    z.r = r;
+    z.r2 = r * r;
+    return z;
+}
+
+template <typename T> void buildBla(Frame<T>& frame, const T& dcMax) {
+    const std::vector<double>& orbit = *frame.orbit;
+    // Single steps m -> m + 1 that land inside the orbit
+    const int steps = frame.orbitLength - 1 - frame.blaStart;
+    if (steps <= 0) return;
+
+    std::vector<BlaStep<T>> level(static_cast<std::size_t>(steps));
+    for (int k = 0; k < steps; k++) {
+        const double zx = orbit[2 * std::size_t(frame.blaStart + k)];
+        const double zy = orbit[2 * std::size_t(frame.blaStart + k) + 1];
+        BlaStep<T>& step = level[std::size_t(k)];
+        step.ax = T(2 * zx);
+        step.ay = T(2 * zy);
+        step.bx = T(frame.julia ? 0.0 : 1.0);
+        step.by = T(0.0);
+        // |dz²| < epsilon |2 Z dz| for |dz| < epsilon |Z|
+        step.r = T(BLA_EPSILON * std::sqrt(zx * zx + zy * zy));
+        step.r2 = step.r * step.r;
+    }
+    frame.bla.push_back(std::move(level));
+
+    while (frame.bla.back().size() >= 2) {
+        const std::vector<BlaStep<T>>& previous = frame.bla.back();
+        std::vector<BlaStep<T>> next(previous.size() / 2);
+        for (std::size_t k = 0; k < next.size(); k++) next[k] = mergeSteps(previous[2 * k], previous[2 * k + 1], dcMax);
+        frame.bla.push_back(std::move(next));
+    }
+}
+
+/** Escape count of one pixel from its deltas (Mandelbrot: dc, Julia: dz0); |z|² at the escape goes to escapeR2 */
+template <typename T>
+int iterateDelta(const Frame<T>& frame, const T& dcx, const T& dcy, T dzx, T dzy, double& escapeR2,
+                 std::uint64_t& stepped, std::uint64_t& skipped) {
+    const double* orbit = frame.orbit->data();
+    const int levels = int(frame.bla.size());
+    int m = 0;
+    int n = 0;
+
+    for (;;) {
+        const double zx = orbit[2 * m] + toDouble(dzx);
+        const double zy = orbit[2 * m + 1] + toDouble(dzy);
+        const double r2 = zx * zx + zy * zy;
+        escapeR2 = r2;
+        if (r2 > 4) return n - frame.offset;
+        if (n >= frame.lastIndex) return frame.limit;
+
+        // Rebase onto the orbit start once the delta dominates or the orbit has no next point
+        T norm = dzx * dzx + dzy * dzy;
+        if (m + 1 >= frame.orbitLength || r2 < toDouble(norm)) {
+            dzx = T(zx - orbit[0]);
+            dzy = T(zy - orbit[1]);
+            norm = dzx * dzx + dzy * dzy;
+            m = 0;
+        }
+
+        // Longest valid BLA step aligned at m that stays inside the orbit and the iteration limit
+        const int j = m - frame.blaStart;
+        if (j >= 0 && levels > 0) {
+            int level = levels - 1;
+            if (j > 0) {
+                int aligned = 0;
+                while (((j >> aligned) & 1) == 0) aligned++;
+                level = std::min(level, aligned);
+            }
+            for (; level >= 0; level--) {
+                const std::vector<BlaStep<T>>& steps = frame.bla[std::size_t(level)];
+                const std::size_t k = std::size_t(j) >> level;
+                const int length = 1 << level;
+                if (k >= steps.size() || n + length > frame.lastIndex) continue;
+                const BlaStep<T>& step = steps[k];
+                if (!(norm < step.r2)) continue;
+
+                const T x = step.ax * dzx - step.ay * dzy + step.bx * dcx - step.by * dcy;
+                dzy = step.ax * dzy + step.ay * dzx + step.bx * dcy + step.by * dcx;
+                dzx = x;
+                m += length;
+                n += length;
+                skipped += std::uint64_t(length);
+                break;
+            }
+            if (level >= 0) continue;
+        }
+
+        // One perturbation step: dz' = 2 Z dz + dz² + dc
+        const T zX(orbit[2 * m]);
+        const T zY(orbit[2 * m + 1]);
+        const T x = T(2.0) * (zX * dzx - zY * dzy) + dzx * dzx - dzy * dzy + dcx;
+        dzy = T(2.0) * (zX * dzy + zY * dzx + dzx * dzy) + dcy;
+        dzx = x;
+        m++;
+        n++;
+        stepped++;
+    }
+}
+
+template <typename T>
+void initFrame(Frame<T>& frame, const DeepView& deep, const std::vector<double>& orbit, const PixelMapping& map,
+               const T& zoom, bool bla) {
+    const View& view = deep.view;
+    const bool julia = view.fractal == Fractal::Julia;
+    frame.orbit = &orbit;
+    frame.orbitLength = int(orbit.size() / 2);
+    frame.offset = julia ? 0 : 1;
+    frame.limit = view.iterations;
+    frame.lastIndex = lastOrbitIndex(view);
+    frame.julia = julia;
+    frame.blaStart = julia ? 0 : 1;
+    if (!bla) return;
+
+    double corner = 0;
+    for (int py : {0, view.height - 1}) {
+        for (int px : {0, view.width - 1}) corner = std::max(corner, std::hypot(map.offsetX(px, py), map.offsetY(px, py)));
+    }
+    buildBla(frame, julia ? T(0.0) : zoom * T(corner));
+}
+
+template <typename T>
+void renderPixels(const Frame<T>& frame, const View& view, const PixelMapping& map, const T& zoom, int tile,
+                  std::vector<std::int32_t>& counts, std::vector<float>* escapeR2, std::uint64_t& stepped,
+                  std::uint64_t& skipped) {
+    const int tilesX = (view.width + DEEP_TILE - 1) / DEEP_TILE;
+    const int x0 = tile % tilesX * DEEP_TILE;
+    const int y0 = tile / tilesX * DEEP_TILE;
+    const int x1 = std::min(x0 + DEEP_TILE, view.width);
+    const int y1 = std::min(y0 + DEEP_TILE, view.height);
+    const T zero(0.0);
+
+    for (int py = y0; py < y1; py++) {
+        for (int px = x0; px < x1; px++) {
+            const T dx = zoom * T(map.offsetX(px, py));
+            const T dy = zoom * T(map.offsetY(px, py));
+            double r2 = 0;
+            const std::size_t i = std::size_t(py) * view.width + px;
+            counts[i] = frame.julia ? iterateDelta(frame, zero, zero, dx, dy, r2, stepped, skipped)
+                                    : iterateDelta(frame, dx, dy, zero, zero, r2, stepped, skipped);
+            if (escapeR2) (*escapeR2)[i] = float(r2);
+        }
+    }
+}
+
+} // namespace
+
+DeepView deepView(const View& view) {
+    const auto decimal = [](double value) {
+        char text[32];
+        std::snprintf(text, sizeof text, "%.17g", value);
+        return std::string(text);
+    };
+
+    DeepView deep;
+    deep.view = view;
+    deep.panX = decimal(view.panX);
+    deep.panY = decimal(view.panY);
+    deep.cx = decimal(view.cx);
+    deep.cy = decimal(view.cy);
+    deep.zoom = view.zoom;
+    return deep;
+}
+
+FloatExp parseZoom(const std::string& text) {
+    const auto fail = [&]() -> FloatExp { throw std::invalid_argument("Not a zoom: '" + text + "'"); };
+
+    // Within double's normal range strtod rounds exactly
+    char* end = nullptr;
+    const double value = std::strtod(text.c_str(), &end);
+    if (!text.empty() && *end == '\0' && std::isnormal(value)) return value;
+
+    // Mantissa as a double, the decimal exponent applied separately so it may go past double's range
+    const std::size_t e = text.find_first_of("eE");
+    const std::string mantissa = text.substr(0, e);
+    const double m = std::strtod(mantissa.c_str(), &end);
+    if (mantissa.empty() || *end != '\0' || !std::isfinite(m)) return fail();
+
+    long exponent = 0;
+    if (e != std::string::npos) {
+        const std::string digits = text.substr(e + 1);
+        exponent = std::strtol(digits.c_str(), &end, 10);
+        if (digits.empty() || *end != '\0') return fail();
+    }
+
+    // 10^|exponent| by squaring
+    FloatExp power = 1.0;
+    FloatExp base = 10.0;
+    for (unsigned long k = std::labs(exponent); k; k >>= 1) {
+        if (k & 1) power = power * base;
+        base = base * base;
+    }
+    return exponent < 0 ? FloatExp(m) / power : FloatExp(m) * power;
+}
+
+bool needsDeep(const View& view) {
+    const double centre = std::max({1.0, std::abs(view.panX), std::abs(view.panY)});
+    return view.zoom / view.height < 0x1p-44 * centre;
+}
+
+struct DeepFrame::Impl {
+    DeepView deep;
+    std::vector<double> orbit;
+    /** Pixel offsets in units of the zoom, scaled per pixel so they never underflow before the scaling */
+    PixelMapping map;
+    /** Delta arithmetic: doubles, or FloatExp when extended */
+    Frame<double> narrow;
+    Frame<FloatExp> wide;
+    double narrowZoom = 0;
+    DeepStats stats;
+    mutable std::atomic<std::uint64_t> stepped{0}, skipped{0};
+};
+
+DeepFrame::DeepFrame(const DeepView& deep, const DeepOptions& options) : impl_(std::make_unique<Impl>()) {
+    const View& view = deep.view;
+    if (view.width <= 0 || view.height <= 0 || view.iterations <= 0) {
+        throw std::invalid_argument("Deep view needs a positive size and iteration limit");
+    }
+
+    Impl& f = *impl_;
+    f.deep = deep;
+    const int limbs = precisionLimbs(deep.zoom, view.height);
+    f.stats.precisionBits = 32 * limbs;
+    f.orbit = referenceOrbit(deep, limbs, lastOrbitIndex(view));
+    f.stats.orbitLength = int(f.orbit.size() / 2);
+
+    View unit = view;
+    unit.panX = unit.panY = 0;
+    unit.zoom = 1;
+    f.map = pixelMapping(unit);
+
+    f.stats.extended = options.extended || log2(deep.zoom) < std::log2(DEEP_EXTENDED_ZOOM);
+    if (f.stats.extended) {
+        initFrame(f.wide, f.deep, f.orbit, f.map, deep.zoom, options.bla);
+        f.stats.blaLevels = int(f.wide.bla.size());
+    } else {
+        f.narrowZoom = toDouble(deep.zoom);
+        initFrame(f.narrow, f.deep, f.orbit, f.map, f.narrowZoom, options.bla);
+        f.stats.blaLevels = int(f.narrow.bla.size());
+    }
+}
+
+DeepFrame::~DeepFrame() = default;
+DeepFrame::DeepFrame(DeepFrame&&) noexcept = default;
+DeepFrame& DeepFrame::operator=(DeepFrame&&) noexcept = default;
+
+const View& DeepFrame::view() const { return impl_->deep.view; }
+
+std::size_t DeepFrame::tileCount() const {
+    const View& view = impl_->deep.view;
+    return std::size_t((view.width + DEEP_TILE - 1) / DEEP_TILE) * ((view.height + DEEP_TILE - 1) / DEEP_TILE);
+}
+
+void DeepFrame::renderTile(std::size_t tile, std::vector<std::int32_t>& counts, std::vector<float>* escapeR2) const {
+    const Impl& f = *impl_;
+    std::uint64_t stepped = 0, skipped = 0;
+    if (f.stats.extended) {
+        renderPixels(f.wide, f.deep.view, f.map, f.deep.zoom, int(tile), counts, escapeR2, stepped, skipped);
+    } else {
+        renderPixels(f.narrow, f.deep.view, f.map, f.narrowZoom, int(tile), counts, escapeR2, stepped, skipped);
+    }
+    f.stepped += stepped;
+    f.skipped += skipped;
+}
+
+DeepStats DeepFrame::stats() const {
+    DeepStats stats = impl_->stats;
+    stats.stepped = impl_->stepped;
+    stats.skipped = impl_->skipped;
+    return stats;
+}
+
+DeepStats renderDeepCounts(const DeepView& deep, ThreadPool& pool, std::vector<std::int32_t>& counts,
+                           const DeepOptions& options) {
+    const DeepFrame frame(deep, options);
+    counts.assign(std::size_t(deep.view.width) * deep.view.height, 0);
+    pool.parallelFor(frame.tileCount(), [&](std::size_t tile) { frame.renderTile(tile, counts); });
+    return frame.stats();
+}
+
+} // namespace ftravel
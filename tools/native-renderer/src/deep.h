@@ -0,0 +1,110 @@
+/*
+ * Deep zoom
+ * Perturbation renderer for views past double precision. One reference orbit, at the view centre, is iterated with
+ * the fixed-point bignum at just enough precision for the zoom; every pixel then iterates only its float64 delta
+ * from it, dz' = 2 Z dz + dz² (+ dc for Mandelbrot), rebasing onto the orbit start when the delta outgrows the orbit
+ * (as the web app's CPU kernel does). Bivariate linear approximation (BLA) skips runs of iterations where the dz²
+ * term is negligible, dz' = A dz + B dc, from a table of merged steps with their validity radii. Below
+ * DEEP_EXTENDED_ZOOM the deltas leave double's exponent range and are iterated as FloatExp instead. Pixels are
+ * rendered in tiles, across a thread pool or, through DeepFrame, interleaved with other views' tiles.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "floatExp.h"
+#include "threadPool.h"
+#include "view.h"
+
+namespace ftravel {
+
+/** Tile edge in pixels, one pool job each */
+constexpr int DEEP_TILE = 64;
+/** Zoom below which deltas are iterated with an extended exponent (pixel deltas near double's smallest normals) */
+constexpr double DEEP_EXTENDED_ZOOM = 1e-290;
+/** Relative size of the dz² term BLA may neglect */
+constexpr double BLA_EPSILON = 0x1p-24;
+
+/** A view as the presets describe it: centre and Julia constant as decimal text of any length, zoom of any depth */
+struct DeepView {
+    /** Fractal, rotation, iterations and size; pan, zoom and c hold the nearest doubles of the fields below */
+    View view;
+    std::string panX = "-0.5", panY = "0";
+    std::string cx = "0", cy = "0";
+    FloatExp zoom = 3.0;
+};
+
+struct DeepOptions {
+    /** Skip iterations with bivariate linear approximation */
+    bool bla = true;
+    /** Iterate deltas with an extended exponent even where doubles suffice (always on below DEEP_EXTENDED_ZOOM) */
+    bool extended = false;
+};
+
+struct DeepStats {
+    /** Fraction bits of the reference orbit */
+    int precisionBits = 0;
+    /** Reference orbit points, including the escaped one if it escaped */
+    int orbitLength = 0;
+    int blaLevels = 0;
+    bool extended = false;
+    /** Pixel iterations done one by one and skipped by BLA, over the whole image */
+    std::uint64_t stepped = 0;
+    std::uint64_t skipped = 0;
+};
+
+/** DeepView of a plain view, centre and c as their shortest round-trip decimals */
+DeepView deepView(const View& view);
+
+/** Decimal text ("4.4e-14", "1e-500") to FloatExp; throws std::invalid_argument */
+FloatExp parseZoom(const std::string& text);
+
+/** True when doubles cannot resolve the view's pixels (spacing below 2^-44 of the centre's magnitude) */
+bool needsDeep(const View& view);
+
+/**
+ * Reference orbit and BLA table of one view. Built once, serially (the bignum part), then shared read-only by any
+ * number of threads rendering its tiles.
+ */
+class DeepFrame {
+public:
+    explicit DeepFrame(const DeepView& view, const DeepOptions& options = {});
+    ~DeepFrame();
+    DeepFrame(DeepFrame&&) noexcept;
+    DeepFrame& operator=(DeepFrame&&) noexcept;
+
+    const View& view() const;
+
+    /** DEEP_TILE x DEEP_TILE tiles, row-major */
+    std::size_t tileCount() const;
+
+    /**
+     * Renders one tile into counts (width * height, top-down rows) and, if given, |z|² at the escape into escapeR2
+     * (same layout, for smooth colouring). Tiles may be rendered concurrently.
+     */
+    void renderTile(std::size_t tile, std::vector<std::int32_t>& counts, std::vector<float>* escapeR2 = nullptr) const;
+
+    /** Orbit and table figures, with the iterations of the tiles rendered so far */
+    DeepStats stats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * Escape counts of every pixel, top-down rows, with the semantics of mandelIterator / juliaIterator (counts equal
+ * renderCounts() wherever both can resolve the view, up to rounding near the set's boundary).
+ */
+DeepStats renderDeepCounts(const DeepView& view, ThreadPool& pool, std::vector<std::int32_t>& counts,
+                           const DeepOptions& options = {});
+
+} // namespace ftravel
@@ -0,0 +1,44 @@
+/*
+ * Escape kernel interface
+ * A row kernel computes the escape counts of a run of pixels along one image row, with the semantics of
+ * mandelIterator / juliaIterator. Kept free of standard library templates: the SIMD translation units include it
+ * with ISA flags, and nothing inline from them may leak into the rest of the program.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "view.h"
+
+namespace ftravel {
+
+/** Pixels n = first + i * stride, i = 0 ... count - 1, at pan + (start + n * step) */
+struct RowSpan {
+    double panX, panY;
+    double startX, startY;
+    double stepX, stepY;
+    int count;
+    int first = 0;
+    int stride = 1;
+};
+
+struct EscapeParams {
+    Fractal fractal;
+    /** Julia constant */
+    double cx, cy;
+    int limit;
+};
+
+using RowKernelFn = void (*)(const RowSpan& row, const EscapeParams& params, std::int32_t* out);
+
+void escapeRowScalar(const RowSpan& row, const EscapeParams& params, std::int32_t* out);
+void escapeRowSse2(const RowSpan& row, const EscapeParams& params, std::int32_t* out);
+void escapeRowAvx2(const RowSpan& row, const EscapeParams& params, std::int32_t* out);
+void escapeRowAvx512(const RowSpan& row, const EscapeParams& params, std::int32_t* out);
+
+} // namespace ftravel
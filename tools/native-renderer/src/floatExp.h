@@ -0,0 +1,99 @@
+/*
+ * Extended-exponent float
+ * A double mantissa with a separate 64-bit binary exponent, for pixel deltas of views deeper than double's range
+ * (about 1e-308). Mantissas are kept normalised to 0.5 <= |m| < 1 (or 0); normalisation works on the bit pattern,
+ * so the arithmetic stays a few instructions longer than the double it replaces.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace ftravel {
+
+struct FloatExp {
+    double m = 0.0;
+    std::int64_t e = 0;
+
+    FloatExp() = default;
+    FloatExp(double value) { *this = make(value, 0); }
+
+    /** m * 2^e, normalised */
+    static FloatExp make(double m, std::int64_t e) {
+        FloatExp r;
+        std::uint64_t bits;
+        std::memcpy(&bits, &m, sizeof bits);
+        const int biased = int((bits >> 52) & 0x7ff);
+        if (biased == 0) {
+            // Zero or subnormal: the slow path keeps subnormals exact
+            if (m == 0.0) return r;
+            int shift;
+            r.m = std::frexp(m, &shift);
+            r.e = e + shift;
+            return r;
+        }
+        if (biased == 0x7ff) {
+            r.m = m;
+            return r;
+        }
+        bits = (bits & ~(std::uint64_t(0x7ff) << 52)) | (std::uint64_t(1022) << 52);
+        std::memcpy(&r.m, &bits, sizeof bits);
+        r.e = e + (biased - 1022);
+        return r;
+    }
+
+    /** 2^n for -1022 <= n <= 1023 */
+    static double pow2(int n) {
+        const std::uint64_t bits = std::uint64_t(n + 1023) << 52;
+        double r;
+        std::memcpy(&r, &bits, sizeof r);
+        return r;
+    }
+};
+
+inline FloatExp operator*(const FloatExp& a, const FloatExp& b) { return FloatExp::make(a.m * b.m, a.e + b.e); }
+inline FloatExp operator/(const FloatExp& a, const FloatExp& b) { return FloatExp::make(a.m / b.m, a.e - b.e); }
+inline FloatExp operator-(const FloatExp& a) { return FloatExp::make(-a.m, a.e); }
+
+inline FloatExp operator+(const FloatExp& a, const FloatExp& b) {
+    if (b.m == 0.0) return a;
+    if (a.m == 0.0) return b;
+    const std::int64_t d = a.e - b.e;
+    // Beyond 64 binary places the smaller term cannot change the sum
+    if (d > 64) return a;
+    if (d < -64) return b;
+    if (d >= 0) return FloatExp::make(a.m + b.m * FloatExp::pow2(int(-d)), a.e);
+    return FloatExp::make(a.m * FloatExp::pow2(int(d)) + b.m, b.e);
+}
+
+inline FloatExp operator-(const FloatExp& a, const FloatExp& b) { return a + (-b); }
+
+inline bool operator<(const FloatExp& a, const FloatExp& b) { return (a - b).m < 0.0; }
+
+/** Nearest double, 0 or infinity outside its range */
+inline double toDouble(const FloatExp& a) {
+    if (a.e < -1100) return 0.0 * a.m;
+    if (a.e > 1100) return a.m * HUGE_VAL;
+    return std::ldexp(a.m, int(a.e));
+}
+
+inline FloatExp sqrt(const FloatExp& a) {
+    if (a.m <= 0.0) return FloatExp();
+    // Even exponent so it halves exactly
+    const bool odd = (a.e & 1) != 0;
+    return FloatExp::make(std::sqrt(odd ? 2.0 * a.m : a.m), (odd ? a.e - 1 : a.e) / 2);
+}
+
+/** log2 |a|, -infinity for 0 */
+inline double log2(const FloatExp& a) { return std::log2(std::abs(a.m)) + double(a.e); }
+
+// The same free functions for plain doubles, so delta arithmetic can be written once for both
+inline double toDouble(double a) { return a; }
+
+} // namespace ftravel
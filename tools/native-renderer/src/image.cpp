@@ -0,0 +1,147 @@
+/*
+ * Image
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "image.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+
+namespace ftravel {
+
+namespace {
+
+/** Largest stored deflate block */
+constexpr std::size_t STORED_BLOCK_MAX = 0xFFFF;
+
+const std::array<std::uint32_t, 256>& crcTable() {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t n = 0; n < 256; n++) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[n] = c;
+        }
+        return t;
+    }();
+    return table;
+}
+
+void putU32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    out.push_back(std::uint8_t(v >> 24));
+    out.push_back(std::uint8_t(v >> 16));
+    out.push_back(std::uint8_t(v >> 8));
+    out.push_back(std::uint8_t(v));
+}
+
+void putChunk(std::vector<std::uint8_t>& out, const char* type, const std::vector<std::uint8_t>& data) {
+    putU32(out, std::uint32_t(data.size()));
+    const std::size_t typeAt = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putU32(out, crc32(&out[typeAt], data.size() + 4));
+}
+
+/** zlib stream of stored blocks */
+std::vector<std::uint8_t> zlibStored(const std::vector<std::uint8_t>& raw) {
+    std::vector<std::uint8_t> out;
+    out.reserve(raw.size() + raw.size() / STORED_BLOCK_MAX * 5 + 16);
+    out.push_back(0x78); // deflate, 32K window
+    out.push_back(0x01); // no preset dictionary, check bits
+
+    std::size_t at = 0;
+    do {
+        const std::size_t len = std::min(STORED_BLOCK_MAX, raw.size() - at);
+        const bool last = at + len == raw.size();
+        out.push_back(last ? 1 : 0);
+        out.push_back(std::uint8_t(len));
+        out.push_back(std::uint8_t(len >> 8));
+        out.push_back(std::uint8_t(~len));
+        out.push_back(std::uint8_t(~len >> 8));
+        out.insert(out.end(), raw.begin() + at, raw.begin() + at + len);
+        at += len;
+    } while (at < raw.size());
+
+    // Adler-32, summed in runs short enough not to overflow
+    std::uint32_t a = 1, b = 0;
+    for (std::size_t i = 0; i < raw.size();) {
+        const std::size_t end = std::min(raw.size(), i + 5552);
+        for (; i < end; i++) {
+            a += raw[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    putU32(out, (b << 16) | a);
+    return out;
+}
+
+std::string extensionOf(const std::string& path) {
+    const std::size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) return {};
+    std::string ext = path.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+    return ext;
+}
+
+} // namespace
+
+std::uint32_t crc32(const std::uint8_t* data, std::size_t length, std::uint32_t crc) {
+    const auto& table = crcTable();
+    crc = ~crc;
+    for (std::size_t i = 0; i < length; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::vector<std::uint8_t> encodePpm(const Image& image) {
+    const std::string header = "P6\n" + std::to_string(image.width) + " " + std::to_string(image.height) + "\n255\n";
+    std::vector<std::uint8_t> out(header.begin(), header.end());
+    out.insert(out.end(), image.pixels.begin(), image.pixels.end());
+    return out;
+}
+
+std::vector<std::uint8_t> encodePng(const Image& image) {
+    static const std::uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::vector<std::uint8_t> out(signature, signature + sizeof signature);
+
+    std::vector<std::uint8_t> header;
+    putU32(header, std::uint32_t(image.width));
+    putU32(header, std::uint32_t(image.height));
+    header.insert(header.end(), {8, 2, 0, 0, 0}); // 8-bit RGB, deflate, no filter method, no interlace
+    putChunk(out, "IHDR", header);
+
+    // Filter type 0 (none) before every row
+    const std::size_t rowBytes = std::size_t(image.width) * 3;
+    std::vector<std::uint8_t> raw;
+    raw.reserve((rowBytes + 1) * image.height);
+    for (int y = 0; y < image.height; y++) {
+        raw.push_back(0);
+        const auto row = image.pixels.begin() + std::ptrdiff_t(y * rowBytes);
+        raw.insert(raw.end(), row, row + std::ptrdiff_t(rowBytes));
+    }
+    putChunk(out, "IDAT", zlibStored(raw));
+    putChunk(out, "IEND", {});
+    return out;
+}
+
+void writeImage(const Image& image, const std::string& path) {
+    const std::string ext = extensionOf(path);
+    std::vector<std::uint8_t> data;
+    if (ext == "png") data = encodePng(image);
+    else if (ext == "ppm") data = encodePpm(image);
+    else throw std::runtime_error("Unsupported image format: '" + path + "' (use .png or .ppm)");
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), std::streamsize(data.size()));
+    if (!file) throw std::runtime_error("Cannot write " + path);
+}
+
+} // namespace ftravel
@@ -0,0 +1,52 @@
+/*
+ * Image
+ * RGB8 frame buffer with PPM (P6) and PNG writers. The PNG writer is self-contained: image data goes into stored
+ * (uncompressed) deflate blocks, so no zlib is needed.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "palette.h"
+
+namespace ftravel {
+
+struct Image {
+    int width = 0;
+    int height = 0;
+    /** Top-down rows of RGB triplets */
+    std::vector<std::uint8_t> pixels;
+
+    Image() = default;
+    Image(int width, int height) : width(width), height(height), pixels(std::size_t(width) * height * 3) {}
+
+    void set(int x, int y, Rgb c) {
+        std::uint8_t* p = &pixels[(std::size_t(y) * width + x) * 3];
+        p[0] = c.r;
+        p[1] = c.g;
+        p[2] = c.b;
+    }
+};
+
+/** Encoded image file contents */
+std::vector<std::uint8_t> encodePpm(const Image& image);
+std::vector<std::uint8_t> encodePng(const Image& image);
+
+/** CRC-32 (ISO-HDLC) as used by PNG chunks */
+std::uint32_t crc32(const std::uint8_t* data, std::size_t length, std::uint32_t crc = 0);
+
+/**
+ * Writes the image as PNG or PPM by the path's extension (.png, .ppm).
+ * @throws std::runtime_error on an unknown extension or a write failure
+ */
+void writeImage(const Image& image, const std::string& path);
+
+} // namespace ftravel
@@ -0,0 +1,38 @@
+/*
+ * Iterators
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#include "iterators.h"
+
+namespace ftravel {
+
+// Re_Z2 / Im_Z2 of FTRAVEL.C
+int mandelIterator(double x, double y, int limit) {
+    double X = x, Y = y;
+    int i = 0;
+
+    while (X * X + Y * Y <= 4 && ++i < limit) {
+        const double oX = X;
+        X = X * X - Y * Y + x;
+        Y = 2 * oX * Y + y;
+    }
+    return i;
+}
+
+int juliaIterator(double x, double y, double cx, double cy, int limit) {
+    double X = x, Y = y;
+    int i = 0;
+
+    while (X * X + Y * Y <= 4 && ++i < limit) {
+        const double oX = X;
+        X = X * X - Y * Y + cx;
+        Y = 2 * oX * Y + cy;
+    }
+    return i;
+}
+
+} // namespace ftravel
@@ -0,0 +1,24 @@
+/*
+ * Iterators
+ * Escape-time iterators of FTRAVEL.C (mandel_iterator, julia_iterator) with the iteration limit (ipp) as a parameter.
+ * Both start from z = the point, test |z|^2 <= 4 before every step and stop when the pre-incremented counter reaches
+ * the limit, so interior points return limit. Julia counts match the web app; Mandelbrot counts are one lower,
+ * because the web app starts from z = 0.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#pragma once
+
+namespace ftravel {
+
+/** Default iteration limit of FTRAVEL.C (ipp) */
+constexpr int FTRAVEL_ITERATIONS = 0xFF;
+
+int mandelIterator(double x, double y, int limit);
+
+int juliaIterator(double x, double y, double cx, double cy, int limit);
+
+} // namespace ftravel
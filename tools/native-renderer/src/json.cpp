@@ -0,0 +1,218 @@
+/*
+ * JSON
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "json.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace ftravel {
+
+namespace {
+
+class Parser {
+public:
+    explicit Parser(const std::string& text) : text_(text) {}
+
+    JsonValue document() {
+        JsonValue value = parseValue();
+        skipSpace();
+        if (at_ != text_.size()) fail("trailing characters");
+        return value;
+    }
+
+private:
+    const std::string& text_;
+    std::size_t at_ = 0;
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error("JSON: " + what + " at offset " + std::to_string(at_));
+    }
+
+    void skipSpace() {
+        while (at_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[at_]))) at_++;
+    }
+
+    bool consume(char ch) {
+        skipSpace();
+        if (at_ < text_.size() && text_[at_] == ch) {
+            at_++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char ch) {
+        if (!consume(ch)) fail(std::string("expected '") + ch + "'");
+    }
+
+    bool consumeWord(const char* word) {
+        const std::string w(word);
+        if (text_.compare(at_, w.size(), w) != 0) return false;
+        at_ += w.size();
+        return true;
+    }
+
+    JsonValue parseValue() {
+        skipSpace();
+        if (at_ >= text_.size()) fail("unexpected end");
+
+        JsonValue value;
+        const char ch = text_[at_];
+        if (ch == '{') {
+            value.type = JsonValue::Type::Object;
+            at_++;
+            if (consume('}')) return value;
+            do {
+                skipSpace();
+                if (at_ >= text_.size() || text_[at_] != '"') fail("expected a member name");
+                std::string key = parseString();
+                expect(':');
+                value.members.emplace_back(std::move(key), parseValue());
+            } while (consume(','));
+            expect('}');
+        } else if (ch == '[') {
+            value.type = JsonValue::Type::Array;
+            at_++;
+            if (consume(']')) return value;
+            do {
+                value.items.push_back(parseValue());
+            } while (consume(','));
+            expect(']');
+        } else if (ch == '"') {
+            value.type = JsonValue::Type::String;
+            value.text = parseString();
+        } else if (ch == '-' || std::isdigit(static_cast<unsigned char>(ch))) {
+            value.type = JsonValue::Type::Number;
+            value.text = parseNumber();
+        } else if (consumeWord("true")) {
+            value.type = JsonValue::Type::Boolean;
+            value.boolean = true;
+        } else if (consumeWord("false")) {
+            value.type = JsonValue::Type::Boolean;
+        } else if (consumeWord("null")) {
+            value.type = JsonValue::Type::Null;
+        } else {
+            fail("unexpected character");
+        }
+        return value;
+    }
+
+    std::string parseNumber() {
+        const std::size_t start = at_;
+        const auto digits = [&] {
+            const std::size_t from = at_;
+            while (at_ < text_.size() && std::isdigit(static_cast<unsigned char>(text_[at_]))) at_++;
+            if (at_ == from) fail("malformed number");
+        };
+        if (text_[at_] == '-') at_++;
+        digits();
+        if (at_ < text_.size() && text_[at_] == '.') {
+            at_++;
+            digits();
+        }
+        if (at_ < text_.size() && (text_[at_] == 'e' || text_[at_] == 'E')) {
+            at_++;
+            if (at_ < text_.size() && (text_[at_] == '+' || text_[at_] == '-')) at_++;
+            digits();
+        }
+        return text_.substr(start, at_ - start);
+    }
+
+    std::string parseString() {
+        at_++; // opening quote
+        std::string out;
+        while (at_ < text_.size() && text_[at_] != '"') {
+            char ch = text_[at_++];
+            if (ch != '\\') {
+                out += ch;
+                continue;
+            }
+            if (at_ >= text_.size()) break;
+            ch = text_[at_++];
+            switch (ch) {
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': appendUtf8(out, parseCodePoint()); break;
+            default: out += ch; break;
+            }
+        }
+        if (at_ >= text_.size()) fail("unterminated string");
+        at_++; // closing quote
+        return out;
+    }
+
+    unsigned parseHex4() {
+        if (at_ + 4 > text_.size()) fail("malformed \\u escape");
+        const std::string hex = text_.substr(at_, 4);
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(hex.c_str(), &end, 16);
+        if (*end != '\0') fail("malformed \\u escape");
+        at_ += 4;
+        return unsigned(value);
+    }
+
+    unsigned parseCodePoint() {
+        const unsigned high = parseHex4();
+        if (high < 0xD800 || high > 0xDBFF || text_.compare(at_, 2, "\\u") != 0) return high;
+        at_ += 2;
+        const unsigned low = parseHex4();
+        return 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    static void appendUtf8(std::string& out, unsigned cp) {
+        if (cp < 0x80) {
+            out += char(cp);
+        } else if (cp < 0x800) {
+            out += char(0xC0 | (cp >> 6));
+            out += char(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += char(0xE0 | (cp >> 12));
+            out += char(0x80 | ((cp >> 6) & 0x3F));
+            out += char(0x80 | (cp & 0x3F));
+        } else {
+            out += char(0xF0 | (cp >> 18));
+            out += char(0x80 | ((cp >> 12) & 0x3F));
+            out += char(0x80 | ((cp >> 6) & 0x3F));
+            out += char(0x80 | (cp & 0x3F));
+        }
+    }
+};
+
+} // namespace
+
+const JsonValue* JsonValue::find(const std::string& key) const {
+    for (const auto& [name, value] : members) {
+        if (name == key) return &value;
+    }
+    return nullptr;
+}
+
+double JsonValue::number() const { return std::strtod(text.c_str(), nullptr); }
+
+JsonValue parseJson(const std::string& text) { return Parser(text).document(); }
+
+JsonValue readJsonFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Cannot read " + path);
+    std::ostringstream text;
+    text << file.rdbuf();
+    try {
+        return parseJson(text.str());
+    } catch (const std::runtime_error& error) {
+        throw std::runtime_error(path + ": " + error.what());
+    }
+}
+
+} // namespace ftravel
@@ -0,0 +1,48 @@
+/*
+ * JSON
+ * Minimal reader for the web app's data files (the presets in src/data). Numbers keep their literal text, so preset
+ * coordinates with more digits than a double holds reach the deep zoom engine intact.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ftravel {
+
+struct JsonValue {
+    enum class Type { Null, Boolean, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    /** String contents, or the literal text of a number */
+    std::string text;
+    std::vector<JsonValue> items;
+    /** Object members in file order */
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    bool isNumber() const { return type == Type::Number; }
+    bool isString() const { return type == Type::String; }
+    bool isArray() const { return type == Type::Array; }
+    bool isObject() const { return type == Type::Object; }
+
+    /** Member by key, nullptr when absent or not an object */
+    const JsonValue* find(const std::string& key) const;
+
+    /** Nearest double of a number */
+    double number() const;
+};
+
+/** Parses a JSON document; throws std::runtime_error with the byte offset of the first error */
+JsonValue parseJson(const std::string& text);
+
+/** Reads and parses a JSON file; throws std::runtime_error */
+JsonValue readJsonFile(const std::string& path);
+
+} // namespace ftravel
@@ -0,0 +1,96 @@
+/*
+ * Kernels
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "kernels.h"
+
+#include "iterators.h"
+
+#if defined(FTRAVEL_X86_KERNELS) && defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace ftravel {
+
+namespace {
+
+#ifdef FTRAVEL_X86_KERNELS
+
+struct CpuFeatures {
+    bool avx2 = false;
+    bool avx512f = false;
+};
+
+CpuFeatures detectCpu() {
+    CpuFeatures cpu;
+#if defined(__GNUC__) || defined(__clang__)
+    // Also checks that the OS saves the wider registers (XGETBV)
+    __builtin_cpu_init();
+    cpu.avx2 = __builtin_cpu_supports("avx2");
+    cpu.avx512f = __builtin_cpu_supports("avx512f");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = info[2] & (1 << 27);
+    const bool avx = info[2] & (1 << 28);
+    if (!osxsave || !avx) return cpu;
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    cpu.avx2 = (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5));
+    cpu.avx512f = (xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16));
+#endif
+    return cpu;
+}
+
+#endif
+
+std::vector<EscapeKernel> buildKernels() {
+    std::vector<EscapeKernel> kernels{{"scalar", 1, escapeRowScalar}};
+#ifdef FTRAVEL_X86_KERNELS
+    // SSE2 is part of x86-64
+    kernels.push_back({"sse2", 2, escapeRowSse2});
+    const CpuFeatures cpu = detectCpu();
+    if (cpu.avx2) kernels.push_back({"avx2", 4, escapeRowAvx2});
+    if (cpu.avx512f) kernels.push_back({"avx512", 8, escapeRowAvx512});
+#endif
+    return kernels;
+}
+
+} // namespace
+
+void escapeRowScalar(const RowSpan& row, const EscapeParams& params, std::int32_t* out) {
+    const bool julia = params.fractal == Fractal::Julia;
+    for (int i = 0; i < row.count; i++) {
+        const double n = row.first + i * row.stride;
+        const double x = row.panX + (row.startX + n * row.stepX);
+        const double y = row.panY + (row.startY + n * row.stepY);
+        out[i] = julia ? juliaIterator(x, y, params.cx, params.cy, params.limit) : mandelIterator(x, y, params.limit);
+    }
+}
+
+const std::vector<EscapeKernel>& availableKernels() {
+    static const std::vector<EscapeKernel> kernels = buildKernels();
+    return kernels;
+}
+
+const EscapeKernel& bestKernel() {
+    return availableKernels().back();
+}
+
+const EscapeKernel* findKernel(const std::string& name) {
+    for (const EscapeKernel& kernel : availableKernels()) {
+        if (name == kernel.name) return &kernel;
+    }
+    return nullptr;
+}
+
+RowSpan rowSpan(const PixelMapping& map, int py, int width) {
+    return {map.panX, map.panY, map.originX + py * map.rowX, map.originY + py * map.rowY, map.colX, map.colY, width, 0, 1};
+}
+
+} // namespace ftravel
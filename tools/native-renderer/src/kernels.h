@@ -0,0 +1,40 @@
+/*
+ * Kernels
+ * Registry of the escape-time row kernels: scalar, SSE2 (2 doubles), AVX2 (4 doubles) and AVX-512F (8 doubles).
+ * SIMD kernels are compiled on x86-64 only, each in its own translation unit with its ISA flags, and offered only
+ * when the running CPU (and OS) supports them. All kernels produce the scalar kernel's counts bit for bit.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "escape.h"
+
+namespace ftravel {
+
+struct EscapeKernel {
+    const char* name;
+    /** Pixels per instruction */
+    int lanes;
+    RowKernelFn run;
+};
+
+/** Kernels usable on this machine, scalar first and widest last */
+const std::vector<EscapeKernel>& availableKernels();
+
+/** Widest available kernel */
+const EscapeKernel& bestKernel();
+
+/** Available kernel by name, nullptr if unknown or unsupported here */
+const EscapeKernel* findKernel(const std::string& name);
+
+/** Row py of a mapping as a kernel span */
+RowSpan rowSpan(const PixelMapping& map, int py, int width);
+
+} // namespace ftravel
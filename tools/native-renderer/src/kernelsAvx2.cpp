@@ -0,0 +1,58 @@
+/*
+ * AVX2 escape kernel: 4 pixels per instruction
+ * Same scheme as the SSE2 kernel (kernelsSse2.cpp) on 256-bit registers.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <immintrin.h>
+
+#include "escape.h"
+
+namespace ftravel {
+
+void escapeRowAvx2(const RowSpan& row, const EscapeParams& params, std::int32_t* out) {
+    const bool julia = params.fractal == Fractal::Julia;
+    const __m256d four = _mm256_set1_pd(4.0);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d one = _mm256_set1_pd(1.0);
+    // Counts are kept as doubles, exact far beyond any iteration limit
+    const __m256d limit = _mm256_set1_pd(params.limit);
+    const __m256d lane = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    const __m256d panX = _mm256_set1_pd(row.panX), panY = _mm256_set1_pd(row.panY);
+    const __m256d startX = _mm256_set1_pd(row.startX), startY = _mm256_set1_pd(row.startY);
+    const __m256d stepX = _mm256_set1_pd(row.stepX), stepY = _mm256_set1_pd(row.stepY);
+    const __m256d first = _mm256_set1_pd(row.first), stride = _mm256_set1_pd(row.stride);
+
+    for (int i = 0; i < row.count; i += 4) {
+        const __m256d index = _mm256_add_pd(first, _mm256_mul_pd(_mm256_add_pd(_mm256_set1_pd(i), lane), stride));
+        const __m256d x = _mm256_add_pd(panX, _mm256_add_pd(startX, _mm256_mul_pd(index, stepX)));
+        const __m256d y = _mm256_add_pd(panY, _mm256_add_pd(startY, _mm256_mul_pd(index, stepY)));
+        const __m256d cx = julia ? _mm256_set1_pd(params.cx) : x;
+        const __m256d cy = julia ? _mm256_set1_pd(params.cy) : y;
+
+        __m256d X = x, Y = y;
+        __m256d count = _mm256_setzero_pd();
+        __m256d active = _mm256_cmp_pd(count, count, _CMP_EQ_OQ);
+
+        for (;;) {
+            const __m256d r2 = _mm256_add_pd(_mm256_mul_pd(X, X), _mm256_mul_pd(Y, Y));
+            const __m256d inside = _mm256_and_pd(active, _mm256_cmp_pd(r2, four, _CMP_LE_OQ));
+            count = _mm256_add_pd(count, _mm256_and_pd(inside, one));
+            active = _mm256_and_pd(inside, _mm256_cmp_pd(count, limit, _CMP_LT_OQ));
+            if (_mm256_movemask_pd(active) == 0) break;
+
+            const __m256d nextX = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(X, X), _mm256_mul_pd(Y, Y)), cx);
+            Y = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(two, X), Y), cy);
+            X = nextX;
+        }
+
+        alignas(16) std::int32_t counts[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts), _mm256_cvtpd_epi32(count));
+        for (int k = 0; k < 4 && i + k < row.count; k++) out[i + k] = counts[k];
+    }
+}
+
+} // namespace ftravel
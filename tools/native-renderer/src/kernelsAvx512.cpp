@@ -0,0 +1,57 @@
+/*
+ * AVX-512F escape kernel: 8 pixels per instruction
+ * The active lanes live in a mask register, so the compares and the count update take them directly.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <immintrin.h>
+
+#include "escape.h"
+
+namespace ftravel {
+
+void escapeRowAvx512(const RowSpan& row, const EscapeParams& params, std::int32_t* out) {
+    const bool julia = params.fractal == Fractal::Julia;
+    const __m512d four = _mm512_set1_pd(4.0);
+    const __m512d two = _mm512_set1_pd(2.0);
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d limit = _mm512_set1_pd(params.limit);
+    const __m512d lane = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    const __m512d panX = _mm512_set1_pd(row.panX), panY = _mm512_set1_pd(row.panY);
+    const __m512d startX = _mm512_set1_pd(row.startX), startY = _mm512_set1_pd(row.startY);
+    const __m512d stepX = _mm512_set1_pd(row.stepX), stepY = _mm512_set1_pd(row.stepY);
+    const __m512d first = _mm512_set1_pd(row.first), stride = _mm512_set1_pd(row.stride);
+
+    for (int i = 0; i < row.count; i += 8) {
+        const __m512d index = _mm512_add_pd(first, _mm512_mul_pd(_mm512_add_pd(_mm512_set1_pd(i), lane), stride));
+        const __m512d x = _mm512_add_pd(panX, _mm512_add_pd(startX, _mm512_mul_pd(index, stepX)));
+        const __m512d y = _mm512_add_pd(panY, _mm512_add_pd(startY, _mm512_mul_pd(index, stepY)));
+        const __m512d cx = julia ? _mm512_set1_pd(params.cx) : x;
+        const __m512d cy = julia ? _mm512_set1_pd(params.cy) : y;
+
+        __m512d X = x, Y = y;
+        __m512d count = _mm512_setzero_pd();
+        __mmask8 active = 0xFF;
+
+        for (;;) {
+            const __m512d r2 = _mm512_add_pd(_mm512_mul_pd(X, X), _mm512_mul_pd(Y, Y));
+            const __mmask8 inside = _mm512_mask_cmp_pd_mask(active, r2, four, _CMP_LE_OQ);
+            count = _mm512_mask_add_pd(count, inside, count, one);
+            active = _mm512_mask_cmp_pd_mask(inside, count, limit, _CMP_LT_OQ);
+            if (active == 0) break;
+
+            const __m512d nextX = _mm512_add_pd(_mm512_sub_pd(_mm512_mul_pd(X, X), _mm512_mul_pd(Y, Y)), cx);
+            Y = _mm512_add_pd(_mm512_mul_pd(_mm512_mul_pd(two, X), Y), cy);
+            X = nextX;
+        }
+
+        alignas(64) double counts[8];
+        _mm512_store_pd(counts, count);
+        for (int k = 0; k < 8 && i + k < row.count; k++) out[i + k] = std::int32_t(counts[k]);
+    }
+}
+
+} // namespace ftravel
@@ -0,0 +1,59 @@
+/*
+ * SSE2 escape kernel: 2 pixels per instruction
+ * Lanes that escape or hit the limit are masked out of the count; the block ends when no lane is active.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <emmintrin.h>
+
+#include "escape.h"
+
+namespace ftravel {
+
+void escapeRowSse2(const RowSpan& row, const EscapeParams& params, std::int32_t* out) {
+    const bool julia = params.fractal == Fractal::Julia;
+    const __m128d four = _mm_set1_pd(4.0);
+    const __m128d two = _mm_set1_pd(2.0);
+    const __m128d one = _mm_set1_pd(1.0);
+    // Counts are kept as doubles, exact far beyond any iteration limit
+    const __m128d limit = _mm_set1_pd(params.limit);
+    const __m128d lane = _mm_set_pd(1.0, 0.0);
+    const __m128d panX = _mm_set1_pd(row.panX), panY = _mm_set1_pd(row.panY);
+    const __m128d startX = _mm_set1_pd(row.startX), startY = _mm_set1_pd(row.startY);
+    const __m128d stepX = _mm_set1_pd(row.stepX), stepY = _mm_set1_pd(row.stepY);
+    const __m128d first = _mm_set1_pd(row.first), stride = _mm_set1_pd(row.stride);
+
+    for (int i = 0; i < row.count; i += 2) {
+        // Pixel indices are small integers, exact in doubles: the same coordinates as the scalar kernel
+        const __m128d index = _mm_add_pd(first, _mm_mul_pd(_mm_add_pd(_mm_set1_pd(i), lane), stride));
+        const __m128d x = _mm_add_pd(panX, _mm_add_pd(startX, _mm_mul_pd(index, stepX)));
+        const __m128d y = _mm_add_pd(panY, _mm_add_pd(startY, _mm_mul_pd(index, stepY)));
+        const __m128d cx = julia ? _mm_set1_pd(params.cx) : x;
+        const __m128d cy = julia ? _mm_set1_pd(params.cy) : y;
+
+        __m128d X = x, Y = y;
+        __m128d count = _mm_setzero_pd();
+        __m128d active = _mm_cmpeq_pd(count, count);
+
+        for (;;) {
+            const __m128d r2 = _mm_add_pd(_mm_mul_pd(X, X), _mm_mul_pd(Y, Y));
+            const __m128d inside = _mm_and_pd(active, _mm_cmple_pd(r2, four));
+            count = _mm_add_pd(count, _mm_and_pd(inside, one));
+            active = _mm_and_pd(inside, _mm_cmplt_pd(count, limit));
+            if (_mm_movemask_pd(active) == 0) break;
+
+            const __m128d nextX = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(X, X), _mm_mul_pd(Y, Y)), cx);
+            Y = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(two, X), Y), cy);
+            X = nextX;
+        }
+
+        alignas(16) std::int32_t counts[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts), _mm_cvtpd_epi32(count));
+        for (int k = 0; k < 2 && i + k < row.count; k++) out[i + k] = counts[k];
+    }
+}
+
+} // namespace ftravel
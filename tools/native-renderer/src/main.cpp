@@ -0,0 +1,285 @@
+/*
+ * ftravel
+ * Headless command-line renderer grown from FTRAVEL.C. Renders one Mandelbrot or Julia view, given the way the web
+ * app describes it, with progressive refinement across all cores and writes it as PNG or PPM. Views past double
+ * precision go to the perturbation engine (see deep.h).
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "deep.h"
+#include "preset.h"
+#include "refine.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+namespace {
+
+struct Options {
+    Fractal fractal = Fractal::Mandelbrot;
+    /** Preset object, as in src/data/mandelbrot.json or julia.json */
+    std::optional<std::string> preset;
+    /** Decimal text, kept whole for the deep engine */
+    std::optional<std::string> panX, panY, zoom, cx, cy;
+    std::optional<double> rotation;
+    std::optional<int> iterations;
+    int width = 1024;
+    int height = 768;
+    /** 0 = every hardware thread */
+    unsigned threads = 0;
+    const EscapeKernel* kernel = &bestKernel();
+    bool exact = false;
+    /** Stop refining after this long and keep the passes done (0 = no limit) */
+    int timeLimitMs = 0;
+    bool deep = false;
+    bool bla = true;
+    std::string output = "ftravel.png";
+};
+
+void printUsage() {
+    std::puts(
+        "Usage: ftravel [options]\n"
+        "  --mandelbrot | --julia   Fractal (default Mandelbrot)\n"
+        "  --view JSON              Preset object as in src/data/<fractal>.json; options below override it\n"
+        "  --pan X,Y                View centre, any number of digits (default -0.5,0; Julia 0,0)\n"
+        "  --zoom Z                 View height in the complex plane, any exponent (default 3; Julia 3.5)\n"
+        "  --rotation R             Rotation in radians (default 0)\n"
+        "  --c X,Y                  Julia constant (default -0.8,0.156)\n"
+        "  --iterations N           Iteration limit (default 255; with --view the app's budget for the zoom)\n"
+        "  --size WxH               Image size (default 1024x768)\n"
+        "  --threads N              Threads (default: all cores)\n"
+        "  --kernel NAME            scalar, sse2, avx2 or avx512 (default: widest the CPU supports)\n"
+        "  --exact                  Iterate every pixel, no guessing of uniform blocks\n"
+        "  --time-limit MS          Stop refining after MS milliseconds and write the passes done\n"
+        "  --deep                   Use the perturbation engine even where doubles resolve the view\n"
+        "  --no-bla                 Perturbation without bivariate linear approximation\n"
+        "  -o, --output PATH        Output .png or .ppm (default ftravel.png)\n"
+        "  -h, --help               Show this help");
+}
+
+double parseNumber(const std::string& text, const std::string& option) {
+    char* end = nullptr;
+    const double value = std::strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0') throw std::invalid_argument(option + ": not a number: '" + text + "'");
+    return value;
+}
+
+int parseInt(const std::string& text, const std::string& option) {
+    const double value = parseNumber(text, option);
+    if (value != int(value)) throw std::invalid_argument(option + ": not an integer: '" + text + "'");
+    return int(value);
+}
+
+/** Validated decimal text */
+std::string decimal(const std::string& text, const std::string& option) {
+    parseNumber(text, option);
+    return text;
+}
+
+/** "a<sep>b" */
+std::pair<std::string, std::string> splitPair(const std::string& text, char separator, const std::string& option) {
+    const std::size_t at = text.find(separator);
+    if (at == std::string::npos) {
+        throw std::invalid_argument(option + ": expected two values separated by '" + separator + "'");
+    }
+    return {text.substr(0, at), text.substr(at + 1)};
+}
+
+Options parseArgs(int argc, char** argv) {
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const auto value = [&]() -> std::string {
+            if (i + 1 >= argc) throw std::invalid_argument(arg + ": missing value");
+            return argv[++i];
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            std::exit(0);
+        } else if (arg == "--mandelbrot") {
+            options.fractal = Fractal::Mandelbrot;
+        } else if (arg == "--julia") {
+            options.fractal = Fractal::Julia;
+        } else if (arg == "--view") {
+            options.preset = value();
+        } else if (arg == "--pan") {
+            const auto [x, y] = splitPair(value(), ',', arg);
+            options.panX = decimal(x, arg);
+            options.panY = decimal(y, arg);
+        } else if (arg == "--zoom") {
+            options.zoom = value();
+        } else if (arg == "--rotation") {
+            options.rotation = parseNumber(value(), arg);
+        } else if (arg == "--c") {
+            const auto [x, y] = splitPair(value(), ',', arg);
+            options.cx = decimal(x, arg);
+            options.cy = decimal(y, arg);
+        } else if (arg == "--iterations") {
+            options.iterations = parseInt(value(), arg);
+        } else if (arg == "--size") {
+            const auto [w, h] = splitPair(value(), 'x', arg);
+            options.width = parseInt(w, arg);
+            options.height = parseInt(h, arg);
+        } else if (arg == "--threads") {
+            const int threads = parseInt(value(), arg);
+            if (threads < 1) throw std::invalid_argument(arg + ": must be positive");
+            options.threads = unsigned(threads);
+        } else if (arg == "--kernel") {
+            const std::string name = value();
+            options.kernel = findKernel(name);
+            if (!options.kernel) throw std::invalid_argument(arg + ": '" + name + "' is not available on this machine");
+        } else if (arg == "--exact") {
+            options.exact = true;
+        } else if (arg == "--time-limit") {
+            options.timeLimitMs = parseInt(value(), arg);
+        } else if (arg == "--deep") {
+            options.deep = true;
+        } else if (arg == "--no-bla") {
+            options.bla = false;
+        } else if (arg == "-o" || arg == "--output") {
+            options.output = value();
+        } else {
+            throw std::invalid_argument("Unknown option: " + arg);
+        }
+    }
+
+    if (options.width <= 0 || options.height <= 0) throw std::invalid_argument("--size: must be positive");
+    if (options.iterations && *options.iterations <= 0) throw std::invalid_argument("--iterations: must be positive");
+    return options;
+}
+
+/** The view the options describe: the preset if any, then the explicit options, then the defaults */
+DeepView resolveView(const Options& options) {
+    const bool julia = options.fractal == Fractal::Julia;
+    DeepView deep;
+    if (options.preset) {
+        deep = presetView(parseJson(*options.preset), options.fractal);
+    } else {
+        deep.view.fractal = options.fractal;
+        deep.panX = julia ? "0" : "-0.5";
+        deep.zoom = julia ? 3.5 : 3.0;
+        deep.cx = "-0.8";
+        deep.cy = "0.156";
+    }
+
+    View& view = deep.view;
+    deep.panX = options.panX.value_or(deep.panX);
+    deep.panY = options.panY.value_or(deep.panY);
+    deep.cx = options.cx.value_or(deep.cx);
+    deep.cy = options.cy.value_or(deep.cy);
+    if (options.zoom) deep.zoom = parseZoom(*options.zoom);
+    view.rotation = options.rotation.value_or(view.rotation);
+    view.iterations = options.iterations.value_or(view.iterations);
+    view.width = options.width;
+    view.height = options.height;
+
+    view.panX = std::strtod(deep.panX.c_str(), nullptr);
+    view.panY = std::strtod(deep.panY.c_str(), nullptr);
+    view.cx = std::strtod(deep.cx.c_str(), nullptr);
+    view.cy = std::strtod(deep.cy.c_str(), nullptr);
+    view.zoom = toDouble(deep.zoom);
+    if (!(0.0 < deep.zoom)) throw std::invalid_argument("--zoom: must be positive");
+    return deep;
+}
+
+/** Progressive refinement on the work-stealing scheduler */
+void renderRefined(const Options& options, const View& view, std::vector<std::int32_t>& counts) {
+    WorkStealingScheduler scheduler(options.threads);
+
+    std::atomic<bool> cancel{false};
+    RefineOptions refine;
+    refine.guess = !options.exact;
+    refine.cancel = &cancel;
+
+    // The time limit plays the part of FTRAVEL.C's timer tick: refinement stops where it is
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    std::thread watchdog;
+    if (options.timeLimitMs > 0) {
+        watchdog = std::thread([&] {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!finished.wait_for(lock, std::chrono::milliseconds(options.timeLimitMs), [&] { return done; })) {
+                cancel = true;
+            }
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const RefineStats stats = refineCounts(view, scheduler, counts, refine, *options.kernel);
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (watchdog.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+        }
+        finished.notify_one();
+        watchdog.join();
+    }
+
+    std::fprintf(stderr, "%s: %dx%d, %d iterations, %u threads, %s kernel, %.1f ms (%.2f Mpixel/s)\n",
+                 options.output.c_str(), view.width, view.height, view.iterations, scheduler.size(),
+                 options.kernel->name, ms, view.width * double(view.height) / (ms * 1e3));
+    std::fprintf(stderr, "  %d of 5 passes%s, %.1f%% of pixels iterated, %zu steals\n", stats.passes,
+                 stats.cancelled ? " (time limit)" : "", 100.0 * stats.iterated / counts.size(), scheduler.steals());
+}
+
+/** Perturbation with BLA, in tiles across a thread pool */
+void renderDeep(const Options& options, const DeepView& deep, std::vector<std::int32_t>& counts) {
+    const View& view = deep.view;
+    ThreadPool pool(options.threads);
+    DeepOptions deepOptions;
+    deepOptions.bla = options.bla;
+
+    const auto start = std::chrono::steady_clock::now();
+    const DeepStats stats = renderDeepCounts(deep, pool, counts, deepOptions);
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::fprintf(stderr, "%s: %dx%d, %d iterations, %u threads, perturbation, %.1f ms (%.2f Mpixel/s)\n",
+                 options.output.c_str(), view.width, view.height, view.iterations, pool.size(), ms,
+                 view.width * double(view.height) / (ms * 1e3));
+    const double total = double(stats.stepped + stats.skipped);
+    std::fprintf(stderr, "  zoom 2^%.1f, reference %d points at %d bits, %d BLA levels, %.1f%% of iterations skipped%s\n",
+                 log2(deep.zoom), stats.orbitLength, stats.precisionBits, stats.blaLevels,
+                 total > 0 ? 100.0 * stats.skipped / total : 0.0, stats.extended ? ", extended exponent" : "");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        const Options options = parseArgs(argc, argv);
+        const DeepView deep = resolveView(options);
+        const View& view = deep.view;
+
+        std::vector<std::int32_t> counts;
+        if (options.deep || needsDeep(view)) {
+            renderDeep(options, deep, counts);
+        } else {
+            renderRefined(options, view, counts);
+        }
+        writeImage(colorize(view, counts, classicPalette()), options.output);
+        return 0;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "ftravel: %s\n", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * Palette
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#include "palette.h"
+
+namespace ftravel {
+
+namespace {
+
+std::uint8_t vga(int value) {
+    // 6-bit DAC to 8 bits, 0x3F -> 0xFF
+    const int v = value & 0x3F;
+    return static_cast<std::uint8_t>((v << 2) | (v >> 4));
+}
+
+Palette buildClassicPalette() {
+    Palette pal{};
+    for (int i = 0; i < 0x40; i++) pal[i] = {vga(i), 0, 0};
+    for (int i = 0x40; i < 0x80; i++) pal[i] = {vga(0x3F), vga(i - 0x40), 0};
+    // FTRAVEL.C writes i - 0xC0 here; the DAC keeps the low 6 bits, which is the same ramp as i - 0x80
+    for (int i = 0x80; i < 0xC0; i++) pal[i] = {vga(0x3F), vga(0x3F), vga(i - 0xC0)};
+    for (int i = 0xC0; i < 0x100; i++) pal[i] = {vga(0x3F), vga(0x3F), vga(0x3F)};
+    return pal;
+}
+
+} // namespace
+
+const Palette& classicPalette() {
+    static const Palette palette = buildClassicPalette();
+    return palette;
+}
+
+} // namespace ftravel
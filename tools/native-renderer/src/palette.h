@@ -0,0 +1,35 @@
+/*
+ * Palette
+ * The 256-entry VGA palette of FTRAVEL.C (set_default_pal): black to red, red to yellow, yellow to white, then white.
+ * Escape counts index it directly, as FTRAVEL.C's rectfill() did with the iterator result.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace ftravel {
+
+struct Rgb {
+    std::uint8_t r, g, b;
+};
+
+using Palette = std::array<Rgb, 256>;
+
+/** set_default_pal() scaled from 6-bit VGA DAC values to 8 bits */
+const Palette& classicPalette();
+
+/**
+ * Colour of an escape count. Interior points (count == limit) take the last entry, as with ipp = 0xFF; higher
+ * counts wrap around the palette like 8-bit colour indices.
+ */
+inline Rgb shade(const Palette& palette, int count, int limit) {
+    return palette[count >= limit ? 0xFF : count & 0xFF];
+}
+
+} // namespace ftravel
@@ -0,0 +1,89 @@
+/*
+ * Presets
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "preset.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <tuple>
+
+namespace ftravel {
+
+namespace {
+
+/** Default zoom of the Mandelbrot mode, the depth origin of its budget */
+constexpr double MANDELBROT_DEFAULT_ZOOM = 3.0;
+constexpr int MANDELBROT_MAX_ITER = 5000;
+constexpr int JULIA_MAX_ITER = 2000;
+
+/** Decimal text of a COORDINATE (number or decimal string) */
+std::string coordinate(const JsonValue* value, const std::string& what) {
+    if (value && value->isNumber()) return value->text;
+    if (value && value->isString()) {
+        char* end = nullptr;
+        std::strtod(value->text.c_str(), &end);
+        if (!value->text.empty() && *end == '\0') return value->text;
+    }
+    throw std::invalid_argument(what + ": expected a number or a decimal string");
+}
+
+std::pair<std::string, std::string> complexPair(const JsonValue* value, const std::string& what) {
+    if (!value || !value->isArray() || value->items.size() != 2) {
+        throw std::invalid_argument(what + ": expected [x, y]");
+    }
+    return {coordinate(&value->items[0], what), coordinate(&value->items[1], what)};
+}
+
+} // namespace
+
+int presetIterations(Fractal fractal, const FloatExp& zoom) {
+    if (fractal == Fractal::Julia) {
+        // min(2000, floor(3000 / zoom)), in logs so zooms past double's range cannot overflow
+        const double log2Budget = std::log2(3000.0) - log2(zoom);
+        return log2Budget >= std::log2(double(JULIA_MAX_ITER)) ? JULIA_MAX_ITER : int(std::exp2(log2Budget));
+    }
+    const double log2Depth = std::log2(MANDELBROT_DEFAULT_ZOOM) - log2(zoom);
+    const double budget = std::floor(200 + 50 * log2Depth);
+    return int(std::max(50.0, std::min(double(MANDELBROT_MAX_ITER), budget)));
+}
+
+DeepView presetView(const JsonValue& preset, Fractal fractal) {
+    if (!preset.isObject()) throw std::invalid_argument("Preset: expected an object");
+    const JsonValue* id = preset.find("id");
+    const std::string name = "Preset" + (id && id->isString() ? " '" + id->text + "'" : std::string());
+
+    DeepView deep;
+    View& view = deep.view;
+    view.fractal = fractal;
+
+    std::tie(deep.panX, deep.panY) = complexPair(preset.find("pan"), name + " pan");
+    view.panX = std::strtod(deep.panX.c_str(), nullptr);
+    view.panY = std::strtod(deep.panY.c_str(), nullptr);
+
+    deep.zoom = parseZoom(coordinate(preset.find("zoom"), name + " zoom"));
+    view.zoom = toDouble(deep.zoom);
+    if (!(0.0 < deep.zoom)) throw std::invalid_argument(name + " zoom: must be positive");
+
+    if (const JsonValue* rotation = preset.find("rotation")) {
+        if (!rotation->isNumber()) throw std::invalid_argument(name + " rotation: expected a number");
+        view.rotation = fractal == Fractal::Julia ? rotation->number() * std::acos(-1.0) / 180 : rotation->number();
+    }
+
+    if (fractal == Fractal::Julia) {
+        std::tie(deep.cx, deep.cy) = complexPair(preset.find("c"), name + " c");
+        view.cx = std::strtod(deep.cx.c_str(), nullptr);
+        view.cy = std::strtod(deep.cy.c_str(), nullptr);
+    }
+
+    view.iterations = presetIterations(fractal, deep.zoom);
+    return deep;
+}
+
+} // namespace ftravel
@@ -0,0 +1,25 @@
+/*
+ * Presets
+ * Views of the web app's preset files (src/data/mandelbrot.json, julia.json) as deep views: pan and Julia c as
+ * numbers or decimal strings of any length, zoom as the view height, rotation in radians for Mandelbrot presets and
+ * degrees for Julia ones (as JuliaRenderer reads them). The iteration limit follows the app's budget for the zoom.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include "deep.h"
+#include "json.h"
+
+namespace ftravel {
+
+/** Iteration budget of the web app at a zoom (MandelbrotRenderer.iterationsForZoom, JuliaRenderer.draw) */
+int presetIterations(Fractal fractal, const FloatExp& zoom);
+
+/** A preset object ({"pan": [x, y], "zoom": z, ...}); throws std::invalid_argument on a malformed one */
+DeepView presetView(const JsonValue& preset, Fractal fractal);
+
+} // namespace ftravel
@@ -0,0 +1,144 @@
+/*
+ * Progressive refinement
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#include "refine.h"
+
+#include <algorithm>
+#include <array>
+
+namespace ftravel {
+
+namespace {
+
+/** Shared state of one pass */
+struct Pass {
+    const View& view;
+    const PixelMapping& map;
+    const EscapeParams& params;
+    const EscapeKernel& kernel;
+    const RefineOptions& options;
+    WorkStealingScheduler& scheduler;
+    std::int32_t* counts;
+    /** Block size: pixels on this grid that are not on the coarser one get iterated */
+    int size;
+    std::atomic<std::size_t> iterated{0};
+};
+
+bool isCancelled(const RefineOptions& options) {
+    return options.cancel && options.cancel->load(std::memory_order_relaxed);
+}
+
+/**
+ * Renders a pass over one leaf [x0, x1) x [y0, y1), aligned to REFINE_STEP. Writes only pixels off the coarse grid
+ * and reads coarse grid samples only, so leaves never race, even on the corners they share.
+ */
+void renderLeaf(Pass& pass, int x0, int y0, int x1, int y1) {
+    const int w = pass.view.width, h = pass.view.height;
+    const int s = pass.size;
+    const int coarse = 2 * s;
+    const bool firstPass = s == REFINE_STEP;
+    std::int32_t* counts = pass.counts;
+
+    // Coarse blocks whose four corners agree keep the value the coarse pass filled them with
+    std::array<bool, (REFINE_LEAF / 2) * (REFINE_LEAF / 2)> uniform{};
+    const int blocksX = (x1 - x0 + coarse - 1) / coarse;
+    if (pass.options.guess && !firstPass) {
+        for (int by = 0; y0 + by * coarse < y1; by++) {
+            for (int bx = 0; bx < blocksX; bx++) {
+                const int cx = x0 + bx * coarse, cy = y0 + by * coarse;
+                if (cx + coarse >= w || cy + coarse >= h) continue;
+                const std::int32_t v = counts[std::size_t(cy) * w + cx];
+                uniform[by * blocksX + bx] = counts[std::size_t(cy) * w + cx + coarse] == v &&
+                                             counts[std::size_t(cy + coarse) * w + cx] == v &&
+                                             counts[std::size_t(cy + coarse) * w + cx + coarse] == v;
+            }
+        }
+    }
+
+    std::array<std::int32_t, REFINE_LEAF> values{};
+    std::size_t iterated = 0;
+
+    for (int py = y0; py < y1; py += s) {
+        if (isCancelled(pass.options)) break;
+
+        // Coarse rows hold the odd multiples of s, the other rows every multiple of s
+        const bool coarseRow = !firstPass && py % coarse == 0;
+        const int stride = coarseRow ? coarse : s;
+        RowSpan run = rowSpan(pass.map, py, 0);
+        run.stride = stride;
+
+        const auto flush = [&] {
+            if (run.count == 0) return;
+            pass.kernel.run(run, pass.params, values.data());
+            for (int k = 0; k < run.count; k++) {
+                const int px = run.first + k * stride;
+                const int bw = std::min(s, w - px), bh = std::min(s, h - py);
+                for (int row = 0; row < bh; row++) std::fill_n(&counts[std::size_t(py + row) * w + px], bw, values[k]);
+            }
+            iterated += std::size_t(run.count);
+            run.count = 0;
+        };
+
+        const int by = (py - y0) / coarse;
+        for (int px = coarseRow ? x0 + s : x0; px < x1; px += stride) {
+            if (uniform[by * blocksX + (px - x0) / coarse]) {
+                flush();
+                continue;
+            }
+            if (run.count == 0) run.first = px;
+            run.count++;
+        }
+        flush();
+    }
+    pass.iterated.fetch_add(iterated, std::memory_order_relaxed);
+}
+
+/** recursor(): splits a quadrant in four until leaves; three quarters are left for thieves */
+void renderQuadrant(Pass& pass, int x, int y, int size) {
+    if (x >= pass.view.width || y >= pass.view.height || isCancelled(pass.options)) return;
+    if (size <= REFINE_LEAF) {
+        renderLeaf(pass, x, y, std::min(x + size, pass.view.width), std::min(y + size, pass.view.height));
+        return;
+    }
+
+    const int half = size / 2;
+    pass.scheduler.spawn([&pass, x, y, half] { renderQuadrant(pass, x + half, y, half); });
+    pass.scheduler.spawn([&pass, x, y, half] { renderQuadrant(pass, x + half, y + half, half); });
+    pass.scheduler.spawn([&pass, x, y, half] { renderQuadrant(pass, x, y + half, half); });
+    renderQuadrant(pass, x, y, half);
+}
+
+} // namespace
+
+RefineStats refineCounts(const View& view, WorkStealingScheduler& scheduler, std::vector<std::int32_t>& counts,
+                         const RefineOptions& options, const EscapeKernel& kernel) {
+    counts.assign(std::size_t(view.width) * view.height, 0);
+    const PixelMapping map = pixelMapping(view);
+    const EscapeParams params{view.fractal, view.cx, view.cy, view.iterations};
+
+    int root = REFINE_LEAF;
+    while (root < std::max(view.width, view.height)) root *= 2;
+
+    RefineStats stats;
+    for (int size = REFINE_STEP; size >= 1; size /= 2) {
+        Pass pass{view, map, params, kernel, options, scheduler, counts.data(), size};
+        scheduler.run([&pass, root] { renderQuadrant(pass, 0, 0, root); });
+        stats.iterated += pass.iterated.load();
+
+        if (isCancelled(options)) {
+            stats.cancelled = true;
+            break;
+        }
+        stats.passes++;
+        if (options.onPass) options.onPass(size);
+    }
+    if (!stats.cancelled) stats.guessed = counts.size() - stats.iterated;
+    return stats;
+}
+
+} // namespace ftravel
@@ -0,0 +1,60 @@
+/*
+ * Progressive refinement
+ * FTRAVEL.C's view() / recursor() on the work-stealing scheduler. Pass one iterates every 16th pixel of every 16th
+ * row and fills 16 x 16 blocks with it; every following pass halves the block size and iterates only the pixels
+ * the coarser passes have not, until single pixels. Within a pass the image is split recursively into quadrants, as
+ * recursor() did, and each split is a task idle threads can steal. A coarse block whose four corner samples share
+ * an escape count is left filled instead of being iterated further (guessing), which skips most of the set interior
+ * and the flat bands around it. Cancellation is cooperative, like recursor()'s check of the timer tick (tact).
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   GPL-2.0-or-later (port of FTRAVEL.C, Copyright (C) 2000 Jindrich Novy)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "kernels.h"
+#include "scheduler.h"
+#include "view.h"
+
+namespace ftravel {
+
+/** Block size of the first pass (step of FTRAVEL.C's view()) */
+constexpr int REFINE_STEP = 16;
+/** Quadrants at most this large are rendered by one task instead of being split further */
+constexpr int REFINE_LEAF = 64;
+
+struct RefineOptions {
+    /** Leave blocks with equal corner samples filled instead of iterating them; off renders every pixel exactly */
+    bool guess = true;
+    /** Set from any thread to stop the render; passes finished so far stay in the counts */
+    const std::atomic<bool>* cancel = nullptr;
+    /** Called on the calling thread after each complete pass, with its block size (16, 8, 4, 2, 1) */
+    std::function<void(int blockSize)> onPass;
+};
+
+struct RefineStats {
+    /** Passes completed */
+    int passes = 0;
+    /** Pixels iterated by the kernel */
+    std::size_t iterated = 0;
+    /** Pixels left at a guessed (coarse block) value */
+    std::size_t guessed = 0;
+    bool cancelled = false;
+};
+
+/**
+ * Renders escape counts progressively into counts (resized to width * height, top-down rows). Without guessing the
+ * result equals renderCounts() bit for bit.
+ */
+RefineStats refineCounts(const View& view, WorkStealingScheduler& scheduler, std::vector<std::int32_t>& counts,
+                         const RefineOptions& options = {}, const EscapeKernel& kernel = bestKernel());
+
+} // namespace ftravel
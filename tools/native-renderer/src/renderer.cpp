@@ -0,0 +1,45 @@
+/*
+ * Renderer
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "renderer.h"
+
+#include <algorithm>
+
+namespace ftravel {
+
+std::vector<std::int32_t> renderCounts(const View& view, ThreadPool& pool, const EscapeKernel& kernel) {
+    std::vector<std::int32_t> counts(std::size_t(view.width) * view.height);
+    const PixelMapping map = pixelMapping(view);
+    const EscapeParams params{view.fractal, view.cx, view.cy, view.iterations};
+    const std::size_t bands = std::size_t(view.height + BAND_ROWS - 1) / BAND_ROWS;
+
+    pool.parallelFor(bands, [&](std::size_t band) {
+        const int y0 = int(band) * BAND_ROWS;
+        const int y1 = std::min(view.height, y0 + BAND_ROWS);
+        for (int py = y0; py < y1; py++) {
+            kernel.run(rowSpan(map, py, view.width), params, &counts[std::size_t(py) * view.width]);
+        }
+    });
+    return counts;
+}
+
+Image colorize(const View& view, const std::vector<std::int32_t>& counts, const Palette& palette) {
+    Image image(view.width, view.height);
+    for (int py = 0; py < view.height; py++) {
+        for (int px = 0; px < view.width; px++) {
+            image.set(px, py, shade(palette, counts[std::size_t(py) * view.width + px], view.iterations));
+        }
+    }
+    return image;
+}
+
+Image render(const View& view, const Palette& palette, ThreadPool& pool, const EscapeKernel& kernel) {
+    return colorize(view, renderCounts(view, pool, kernel), palette);
+}
+
+} // namespace ftravel
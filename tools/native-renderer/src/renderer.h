@@ -0,0 +1,36 @@
+/*
+ * Renderer
+ * Renders a view with the FTRAVEL.C iterators across a thread pool, in bands of rows. Rows go through an escape
+ * kernel (see kernels.h), the widest SIMD one the CPU supports unless another is given.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "image.h"
+#include "kernels.h"
+#include "palette.h"
+#include "threadPool.h"
+#include "view.h"
+
+namespace ftravel {
+
+/** Rows per job; small enough to balance interior-heavy bands, large enough to keep the hand-out cheap */
+constexpr int BAND_ROWS = 8;
+
+/** Escape counts of every pixel, top-down rows (see mandelIterator / juliaIterator) */
+std::vector<std::int32_t> renderCounts(const View& view, ThreadPool& pool, const EscapeKernel& kernel = bestKernel());
+
+/** Colours escape counts with a palette */
+Image colorize(const View& view, const std::vector<std::int32_t>& counts, const Palette& palette);
+
+/** renderCounts() + colorize() */
+Image render(const View& view, const Palette& palette, ThreadPool& pool, const EscapeKernel& kernel = bestKernel());
+
+} // namespace ftravel
@@ -0,0 +1,111 @@
+/*
+ * Work-stealing scheduler
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "scheduler.h"
+
+#include <algorithm>
+
+namespace ftravel {
+
+namespace {
+
+/** Deque index of the current thread, or the caller's (0) outside workers */
+thread_local unsigned currentWorker = 0;
+
+} // namespace
+
+WorkStealingScheduler::WorkStealingScheduler(unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; i++) queues_.push_back(std::make_unique<Queue>());
+    for (unsigned i = 1; i < threads; i++) threads_.emplace_back([this, i] { workerLoop(i); });
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+void WorkStealingScheduler::run(Task root) {
+    currentWorker = 0;
+    pending_.store(1);
+    {
+        std::lock_guard<std::mutex> lock(queues_[0]->mutex);
+        queues_[0]->tasks.push_back(std::move(root));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        epoch_++;
+    }
+    wake_.notify_all();
+
+    workUntilDone(0);
+}
+
+void WorkStealingScheduler::spawn(Task task) {
+    pending_.fetch_add(1);
+    Queue& queue = *queues_[currentWorker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+}
+
+void WorkStealingScheduler::workerLoop(unsigned self) {
+    currentWorker = self;
+    std::size_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || epoch_ != seen; });
+            if (stopping_) return;
+            seen = epoch_;
+        }
+        workUntilDone(self);
+    }
+}
+
+void WorkStealingScheduler::workUntilDone(unsigned self) {
+    Task task;
+    // Spawned tasks count as pending before they are queued, so pending_ only reaches 0 when the tree is done
+    while (pending_.load() > 0) {
+        if (popLocal(self, task) || steal(self, task)) {
+            task();
+            task = nullptr;
+            pending_.fetch_sub(1);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool WorkStealingScheduler::popLocal(unsigned self, Task& task) {
+    Queue& queue = *queues_[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingScheduler::steal(unsigned self, Task& task) {
+    const unsigned n = size();
+    for (unsigned k = 1; k < n; k++) {
+        Queue& victim = *queues_[(self + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        steals_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+} // namespace ftravel
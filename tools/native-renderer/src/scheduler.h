@@ -0,0 +1,73 @@
+/*
+ * Work-stealing scheduler
+ * Runs a task tree across a fixed set of threads. Every thread owns a deque: tasks it spawns go to the back and it
+ * takes its own work from the back (newest, smallest), while idle threads steal from the front of a busy thread's
+ * deque (oldest, largest subdivisions). The calling thread works as thread 0.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ftravel {
+
+class WorkStealingScheduler {
+public:
+    using Task = std::function<void()>;
+
+    /** @param threads Total threads including the caller; 0 uses every hardware thread */
+    explicit WorkStealingScheduler(unsigned threads = 0);
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    unsigned size() const { return unsigned(queues_.size()); }
+
+    /** Runs root and every task it spawns, transitively; returns when all are done. Not reentrant. */
+    void run(Task root);
+
+    /** Queues a task on the current thread's deque. Call from inside a running task. */
+    void spawn(Task task);
+
+    /** Tasks taken from another thread's deque since construction */
+    std::size_t steals() const { return steals_.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(unsigned self);
+    void workUntilDone(unsigned self);
+    bool popLocal(unsigned self, Task& task);
+    bool steal(unsigned self, Task& task);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    /** Tasks queued or running in the current run() */
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::size_t> steals_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    /** Bumped per run() so workers join each run once */
+    std::size_t epoch_ = 0;
+    bool stopping_ = false;
+};
+
+} // namespace ftravel
@@ -0,0 +1,75 @@
+/*
+ * Thread pool
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "threadPool.h"
+
+#include <algorithm>
+
+namespace ftravel {
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    workers_.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; i++) workers_.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& job) {
+    if (count == 0) return;
+    if (workers_.empty() || count == 1) {
+        for (std::size_t i = 0; i < count; i++) job(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        count_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        busy_ = unsigned(workers_.size());
+        batch_++;
+    }
+    wake_.notify_all();
+
+    drain();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return busy_ == 0; });
+    job_ = nullptr;
+}
+
+void ThreadPool::drain() {
+    for (std::size_t i = next_.fetch_add(1); i < count_; i = next_.fetch_add(1)) (*job_)(i);
+}
+
+void ThreadPool::workerLoop() {
+    std::size_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || batch_ != seen; });
+            if (stopping_) return;
+            seen = batch_;
+        }
+
+        drain();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--busy_ == 0) finished_.notify_one();
+    }
+}
+
+} // namespace ftravel
@@ -0,0 +1,57 @@
+/*
+ * Thread pool
+ * Fixed set of worker threads running indexed jobs in parallel. The calling thread works along, and jobs are handed
+ * out one index at a time, so uneven jobs (rows through the set interior vs. rows that escape at once) balance out.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ftravel {
+
+class ThreadPool {
+public:
+    /** @param threads Total threads including the caller; 0 uses every hardware thread */
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** Threads working on a parallelFor(), including the caller */
+    unsigned size() const { return unsigned(workers_.size()) + 1; }
+
+    /** Runs job(0) ... job(count - 1) across the pool and returns when all are done. Not reentrant. */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
+private:
+    void workerLoop();
+    void drain();
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+
+    const std::function<void(std::size_t)>* job_ = nullptr;
+    std::size_t count_ = 0;
+    std::atomic<std::size_t> next_{0};
+    /** Bumped per parallelFor() so workers join each batch once */
+    std::size_t batch_ = 0;
+    /** Workers still inside the current batch */
+    unsigned busy_ = 0;
+    bool stopping_ = false;
+};
+
+} // namespace ftravel
@@ -0,0 +1,35 @@
+/*
+ * View
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "view.h"
+
+#include <cmath>
+
+namespace ftravel {
+
+PixelMapping pixelMapping(const View& view) {
+    // Shader space: st = (fragCoord - resolution / 2) / height, y up; pixel row 0 is the top
+    const double scale = view.zoom / view.height;
+    const double cosR = std::cos(view.rotation);
+    const double sinR = std::sin(view.rotation);
+    const double sx = (0.5 - view.width / 2.0) / view.height;
+    const double sy = (view.height / 2.0 - 0.5) / view.height;
+
+    PixelMapping m{};
+    m.panX = view.panX;
+    m.panY = view.panY;
+    m.originX = view.zoom * (sx * cosR - sy * sinR);
+    m.originY = view.zoom * (sx * sinR + sy * cosR);
+    m.colX = scale * cosR;
+    m.colY = scale * sinR;
+    m.rowX = scale * sinR;
+    m.rowY = -scale * cosR;
+    return m;
+}
+
+} // namespace ftravel
@@ -0,0 +1,55 @@
+/*
+ * View
+ * The view parameters of the web app (pan, zoom, rotation, Julia c, iterations) and the pixel to complex plane
+ * mapping of its shaders: the view is zoom units tall, centred on pan, y up, rotated about the centre.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+namespace ftravel {
+
+enum class Fractal { Mandelbrot, Julia };
+
+struct View {
+    Fractal fractal = Fractal::Mandelbrot;
+    double panX = -0.5;
+    double panY = 0.0;
+    /** Height of the view in the complex plane */
+    double zoom = 3.0;
+    /** Radians, counter-clockwise */
+    double rotation = 0.0;
+    /** Julia constant */
+    double cx = 0.0;
+    double cy = 0.0;
+    /** Iteration limit, FTRAVEL.C's ipp by default */
+    int iterations = 255;
+    int width = 1024;
+    int height = 768;
+};
+
+/**
+ * Affine pixel to complex plane mapping. Offsets are kept relative to pan so deep views do not lose the pixel
+ * spacing to the magnitude of the centre.
+ */
+struct PixelMapping {
+    double panX, panY;
+    /** Offset of pixel (0, 0) from pan */
+    double originX, originY;
+    /** Offset per column and per row */
+    double colX, colY, rowX, rowY;
+
+    /** Row start first, then the column: the order the row kernels step in (see kernels.h) */
+    double offsetX(double px, double py) const { return (originX + py * rowX) + px * colX; }
+    double offsetY(double px, double py) const { return (originY + py * rowY) + px * colY; }
+    double x(double px, double py) const { return panX + offsetX(px, py); }
+    double y(double px, double py) const { return panY + offsetY(px, py); }
+};
+
+/** Mapping of pixel centres, top-down rows, as the shaders sample them */
+PixelMapping pixelMapping(const View& view);
+
+} // namespace ftravel
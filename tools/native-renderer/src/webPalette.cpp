@@ -0,0 +1,146 @@
+/*
+ * Web palettes
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#include "webPalette.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace ftravel {
+
+namespace {
+
+/** Smooth counts are scaled by this before the Mandelbrot sines (mandelbrot.frag) */
+constexpr double MANDELBROT_COLOR_SCALE = 100;
+
+/** Unit float to an 8-bit channel, as the GL framebuffer stores it */
+std::uint8_t toByte(double value) {
+    return static_cast<std::uint8_t>(std::lround(std::clamp(value, 0.0, 1.0) * 255));
+}
+
+std::vector<double> numbers(const JsonValue* value, std::size_t size, const std::string& what) {
+    if (!value || !value->isArray() || value->items.size() != size) {
+        throw std::invalid_argument(what + ": expected " + std::to_string(size) + " numbers");
+    }
+    std::vector<double> result;
+    for (const JsonValue& item : value->items) {
+        if (!item.isNumber()) throw std::invalid_argument(what + ": expected " + std::to_string(size) + " numbers");
+        result.push_back(item.number());
+    }
+    return result;
+}
+
+std::array<double, 3> triple(const JsonValue* value, const std::array<double, 3>& fallback, const std::string& what) {
+    if (!value) return fallback;
+    const std::vector<double> v = numbers(value, 3, what);
+    return {v[0], v[1], v[2]};
+}
+
+const std::string* paletteId(const JsonValue& view) {
+    const JsonValue* id = view.find("paletteId");
+    return id && id->isString() ? &id->text : nullptr;
+}
+
+} // namespace
+
+WebPalette defaultPalette(Fractal fractal) {
+    WebPalette palette;
+    if (fractal == Fractal::Julia) {
+        palette.id = "Event Horizon";
+        palette.theme = {0.859, 0.565, 0.306, 0.18, 0.129, 0.216, 0.067, 0.067, 0.082, 0.467, 0, 0, 0.78, 0.29, 0};
+    } else {
+        palette.id = "Default";
+        palette.theme = {1, 1, 1};
+    }
+    return palette;
+}
+
+std::vector<WebPalette> readPalettes(const JsonValue& data, Fractal fractal) {
+    std::vector<WebPalette> palettes;
+    const JsonValue* entries = data.find("palettes");
+    if (!entries) return palettes;
+    if (!entries->isArray()) throw std::invalid_argument("palettes: expected an array");
+
+    const std::size_t themeSize = fractal == Fractal::Julia ? 3 * JULIA_STOPS : 3;
+    for (const JsonValue& entry : entries->items) {
+        const JsonValue* id = entry.find("id");
+        if (!id || !id->isString()) throw std::invalid_argument("Palette: expected a string id");
+        const std::string name = "Palette '" + id->text + "'";
+
+        WebPalette palette;
+        palette.id = id->text;
+        palette.theme = numbers(entry.find("theme"), themeSize, name + " theme");
+        palette.frequency = triple(entry.find("frequency"), palette.frequency, name + " frequency");
+        palette.phase = triple(entry.find("phase"), palette.phase, name + " phase");
+        palettes.push_back(std::move(palette));
+    }
+    return palettes;
+}
+
+WebPalette viewPalette(const JsonValue& data, const JsonValue& view, Fractal fractal) {
+    const std::vector<WebPalette> palettes = readPalettes(data, fractal);
+    const auto byId = [&](const std::string* id) -> const WebPalette* {
+        if (!id) return nullptr;
+        const auto found = std::find_if(palettes.begin(), palettes.end(), [&](const auto& p) { return p.id == *id; });
+        return found == palettes.end() ? nullptr : &*found;
+    };
+
+    if (const WebPalette* palette = byId(paletteId(view))) return *palette;
+    if (fractal == Fractal::Julia) {
+        const JsonValue* views = data.find("views");
+        const bool hasFirst = views && views->isArray() && !views->items.empty();
+        if (const WebPalette* palette = byId(hasFirst ? paletteId(views->items[0]) : nullptr)) return *palette;
+        if (!palettes.empty()) return palettes[0];
+    }
+    return defaultPalette(fractal);
+}
+
+Image colorizeWeb(const View& view, const std::vector<std::int32_t>& counts, const std::vector<float>& escapeR2,
+                  const WebPalette& palette) {
+    const bool julia = view.fractal == Fractal::Julia;
+    if (palette.theme.size() != (julia ? 3u * JULIA_STOPS : 3u)) {
+        throw std::invalid_argument("Palette '" + palette.id + "' does not fit the fractal");
+    }
+    // The app iterates z_0 .. z_(N-1) where mandelIterator checks z_1 .. z_N: its Mandelbrot count is one higher
+    const int offset = julia ? 0 : 1;
+    const double iterations = view.iterations;
+    const double* theme = palette.theme.data();
+
+    Image image(view.width, view.height);
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        std::uint8_t* out = &image.pixels[i * 3];
+        const int it = counts[i] + offset;
+        if (it >= view.iterations) {
+            out[0] = out[1] = out[2] = 0;
+            continue;
+        }
+
+        const double smooth = it - std::log2(std::log2(std::max(double(escapeR2[i]), 1e-30)));
+        if (julia) {
+            // julia.frag: stop map over a sine of the normalized count, extrapolated past the outer stops
+            double t = std::clamp(smooth / iterations, 0.0, 1.0);
+            t = 0.5 + 0.6 * std::sin(t * 4 * 3.14159265);
+            const int segment = std::clamp(int(std::ceil(t * 4)) - 1, 0, JULIA_STOPS - 2);
+            const double k = (t - segment * 0.25) * 4;
+            for (int ch = 0; ch < 3; ch++) {
+                const double from = theme[segment * 3 + ch];
+                out[ch] = toByte(from + (theme[(segment + 1) * 3 + ch] - from) * k);
+            }
+        } else {
+            // mandelbrot.frag: per-channel sine of the smooth count
+            const double t = smooth / MANDELBROT_COLOR_SCALE;
+            for (int ch = 0; ch < 3; ch++) {
+                out[ch] = toByte(std::sin(t * palette.frequency[ch] + palette.phase[ch]) * theme[ch]);
+            }
+        }
+    }
+    return image;
+}
+
+} // namespace ftravel
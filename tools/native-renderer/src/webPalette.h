@@ -0,0 +1,58 @@
+/*
+ * Web palettes
+ * The web app's colouring of escape counts, as mandelbrot.frag and julia.frag (and the CPU kernel's shadePixel)
+ * compute it from the smooth count it - log2(log2 |z|²): Mandelbrot palettes weight a per-channel sine with their
+ * frequency and phase, Julia palettes map a sine of the normalized count over five RGB stops.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "image.h"
+#include "json.h"
+#include "view.h"
+
+namespace ftravel {
+
+/** Stops of a Julia palette theme */
+constexpr int JULIA_STOPS = 5;
+
+/** A "palettes" entry of a preset file */
+struct WebPalette {
+    std::string id;
+    /** Mandelbrot: RGB weights of the sines; Julia: JULIA_STOPS RGB stops */
+    std::vector<double> theme;
+    /** Mandelbrot only */
+    std::array<double, 3> frequency{3.1415, 6.283, 1.72};
+    std::array<double, 3> phase{0, 0, 0};
+};
+
+/** The app's palette when a file has none (FractalRenderer.DEFAULT_PALETTE, DEFAULT_JULIA_PALETTE) */
+WebPalette defaultPalette(Fractal fractal);
+
+/** The palettes of a preset file; throws std::invalid_argument on a malformed one */
+std::vector<WebPalette> readPalettes(const JsonValue& data, Fractal fractal);
+
+/**
+ * Palette a view opens with: its paletteId, else the mode's default (Julia: the first view's palette, as
+ * JuliaRenderer picks it; Mandelbrot: defaultPalette()).
+ */
+WebPalette viewPalette(const JsonValue& data, const JsonValue& view, Fractal fractal);
+
+/**
+ * Colours escape counts (see mandelIterator / juliaIterator) with |z|² at the escape, top-down rows, taking the
+ * view's limit as the app's iteration budget. Native Mandelbrot counts are one below the app's iteration number; the
+ * colouring adds it back, and like the app leaves points that escape only at the budget black.
+ */
+Image colorizeWeb(const View& view, const std::vector<std::int32_t>& counts, const std::vector<float>& escapeR2,
+                  const WebPalette& palette);
+
+} // namespace ftravel
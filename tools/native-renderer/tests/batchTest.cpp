@@ -0,0 +1,59 @@
+// tests/batchTest.cpp
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "batch.h"
+#include "check.h"
+
+using namespace ftravel;
+
+int main() {
+    CHECK(slug("Seahorse Valley") == "seahorse-valley" && slug(" Black  Holes! ") == "black-holes");
+    CHECK(slug("???") == "view");
+
+    BatchOptions options;
+    options.width = 70;
+    options.height = 40;
+    options.format = "ppm";
+    options.outDir = (std::filesystem::temp_directory_path() / "ftravel-batch-test").string();
+
+    // Views matching a filter, malformed ones recorded, fractals without a native renderer skipped whole
+    const JsonValue mandelbrot = parseJson(R"({"type": "MANDELBROT", "palettes": [{"id": "Default", "theme": [1, 1, 1]}],
+        "views": [{"id": "Default", "pan": [-0.5, 0], "zoom": 3},
+                  {"id": "Deep Tip", "pan": ["-1.99999999913827011875827476290869498", "0"], "zoom": "1e-25"},
+                  {"id": "Broken tip", "pan": [0], "zoom": 1}]})");
+    const JsonValue julia = parseJson(R"({"type": "JULIA",
+        "views": [{"id": "Tip of Julia", "c": [-0.8, 0.156], "pan": [0, 0], "zoom": 3.5, "rotation": 90}]})");
+    options.filters = {"TIP"};
+    BatchPlan plan;
+    planPresets(mandelbrot, "mandelbrot.json", options, plan);
+    planPresets(julia, "julia.json", options, plan);
+    planPresets(parseJson(R"({"type": "ROSSLER", "views": []})"), "rossler.json", options, plan);
+    planPresets(parseJson(R"({"type": "object"})"), "fractal.schema.json", options, plan);
+    CHECK(plan.items.size() == 2 && plan.skipped.size() == 3);
+    CHECK(plan.items[0].file == "mandelbrot-01-deep-tip.ppm" && plan.items[1].file == "julia-00-tip-of-julia.ppm");
+    CHECK(plan.items[0].view.view.width == 70 && plan.items[1].palette.theme.size() == 15);
+    CHECK(plan.skipped[0].id == "Broken tip" && plan.skipped[1].reason == "no native renderer for ROSSLER");
+    CHECK(plan.skipped[2].reason == "not a preset file");
+
+    // Both views rendered, the deep one past double precision, and listed in the manifest
+    ThreadPool pool(3);
+    int finished = 0;
+    const std::vector<BatchResult> results =
+        renderBatch(plan, options, pool, [&](const BatchItem&, const BatchResult& result) { finished += result.error.empty(); });
+    CHECK(finished == 2 && results[0].stats.precisionBits > 64);
+    for (const BatchItem& item : plan.items) {
+        const auto size = std::filesystem::file_size(std::filesystem::path(options.outDir) / item.file);
+        CHECK(size == std::string("P6\n70 40\n255\n").size() + 70 * 40 * 3);
+    }
+
+    const JsonValue manifest = parseJson(batchManifest(plan, results, options));
+    const JsonValue* renders = manifest.find("renders");
+    CHECK(manifest.find("width")->number() == 70 && renders && renders->items.size() == 2);
+    CHECK(renders->items[0].find("zoom")->text == "1e-25" && renders->items[1].find("c") != nullptr);
+    CHECK(renders->items[1].find("iterations")->number() == 857 && manifest.find("skipped")->items.size() == 3);
+
+    std::filesystem::remove_all(options.outDir);
+    return TEST_RESULT();
+}
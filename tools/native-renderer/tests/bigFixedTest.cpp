@@ -0,0 +1,64 @@
+// tests/bigFixedTest.cpp
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "bigFixed.h"
+#include "check.h"
+#include "floatExp.h"
+
+using namespace ftravel;
+
+static bool rejects(const std::string& text) {
+    try {
+        BigFixed::parse(text, 4);
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    // Karatsuba agrees with schoolbook on both sides of the threshold and at odd lengths
+    std::mt19937 random(7);
+    for (std::size_t n : {1u, 5u, 23u, 24u, 25u, 48u, 97u, 200u}) {
+        Limbs a(n), b(n);
+        for (std::size_t i = 0; i < n; i++) {
+            a[i] = random();
+            b[i] = i % 3 ? random() : 0xFFFFFFFFu;
+        }
+        CHECK(multiplyLimbs(a, b) == multiplySchoolbook(a, b));
+    }
+
+    // Decimal text as the presets write it
+    CHECK(BigFixed::parse("0.1", 4).toDouble() == 0.1);
+    CHECK(BigFixed::parse("-1.675119031002389347051462", 4).toDouble() == -1.675119031002389347051462);
+    CHECK(BigFixed::parse("1.25e-40", 6).toDouble() == 1.25e-40);
+    CHECK(BigFixed::parse("2.5E+1", 2).toDouble() == 25);
+    CHECK(BigFixed::parse("-0", 2).isZero() && !BigFixed::parse("-0", 2).negative());
+    CHECK(rejects("") && rejects("abc") && rejects("1.2.3") && rejects("1e") && rejects("99999999999"));
+
+    // Arithmetic keeps the sign and the precision: 3 * 0.333... misses 1 only in the last limb
+    const BigFixed third = BigFixed::parse("0." + std::string(120, '3'), 12);
+    const BigFixed three = BigFixed::parse("3", 12);
+    const BigFixed residue = BigFixed::parse("1", 12) - third * three;
+    CHECK(!residue.negative() && residue.toDouble() < 0x1p-380);
+    const BigFixed a = BigFixed::parse("-2.75", 3);
+    const BigFixed b = BigFixed::parse("1.5", 3);
+    CHECK((a * b).toDouble() == -4.125 && (a + b).toDouble() == -1.25 && (b - a).toDouble() == 4.25);
+    CHECK((a.twice()).toDouble() == -5.5 && (-a).toDouble() == 2.75 && ((a - a).isZero()));
+
+    // A difference far below double precision survives
+    const BigFixed x = BigFixed::parse("0.5000000000000000000000000000000000000001", 6);
+    CHECK(std::abs((x - BigFixed::parse("0.5", 6)).toDouble() / 1e-40 - 1) < 1e-12);
+
+    // Extended-exponent floats past double's range
+    const FloatExp tiny = FloatExp(0x1p-1000) * FloatExp(0x1p-1000);
+    CHECK(tiny.e == -1999 && tiny.m == 0.5);
+    CHECK(toDouble(tiny) == 0 && toDouble(tiny / FloatExp(0x1p-1000)) == 0x1p-1000);
+    CHECK(toDouble(FloatExp(3.0) + FloatExp(-1.25)) == 1.75 && FloatExp(-1.0) < FloatExp(0x1p-60));
+    CHECK(toDouble(sqrt(FloatExp(0x1p-1001) * FloatExp(0x1p-1001))) == 0x1p-1001);
+    CHECK(std::abs(log2(tiny) + 2000) < 1e-12);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,25 @@
+/*
+ * Minimal test harness: CHECK() records failures, and each test executable returns their count to CTest.
+ * @author    Radim Brnka
+ * @project   Synaptory Fractal Traveler
+ * @copyright 2025-2026
+ * @license   MIT
+ */
+
+#pragma once
+
+#include <cstdio>
+
+namespace ftravel::test {
+inline int failures = 0;
+}
+
+#define CHECK(condition)                                                                     \
+    do {                                                                                     \
+        if (!(condition)) {                                                                  \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++ftravel::test::failures;                                                       \
+        }                                                                                    \
+    } while (0)
+
+#define TEST_RESULT() (ftravel::test::failures == 0 ? 0 : 1)
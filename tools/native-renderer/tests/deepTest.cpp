@@ -0,0 +1,123 @@
+// tests/deepTest.cpp
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "bigFixed.h"
+#include "check.h"
+#include "deep.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+/** Escape count of one pixel iterated entirely in bignums, with mandelIterator's semantics */
+static int bruteForce(const DeepView& deep, const std::string& zoom, int px, int py, int limbs) {
+    View unit = deep.view;
+    unit.panX = unit.panY = 0;
+    unit.zoom = 1;
+    const PixelMapping map = pixelMapping(unit);
+    const auto decimal = [](double value) {
+        char text[40];
+        std::snprintf(text, sizeof text, "%.17e", value);
+        return std::string(text);
+    };
+    const BigFixed scale = BigFixed::parse(zoom, limbs);
+    const BigFixed x = BigFixed::parse(deep.panX, limbs) + BigFixed::parse(decimal(map.offsetX(px, py)), limbs) * scale;
+    const BigFixed y = BigFixed::parse(deep.panY, limbs) + BigFixed::parse(decimal(map.offsetY(px, py)), limbs) * scale;
+
+    BigFixed zx = x, zy = y;
+    int i = 0;
+    for (;;) {
+        const double dx = zx.toDouble(), dy = zy.toDouble();
+        if (!(dx * dx + dy * dy <= 4 && ++i < deep.view.iterations)) return i;
+        const BigFixed xy = zx * zy;
+        zx = zx * zx - zy * zy + x;
+        zy = xy.twice() + y;
+    }
+}
+
+int main() {
+    ThreadPool pool(3);
+
+    // Where doubles resolve the view, perturbation counts exactly like the direct iterators, up to the last check
+    View view;
+    view.width = 160;
+    view.height = 120;
+    CHECK(!needsDeep(view));
+    std::vector<std::int32_t> counts, plain;
+    DeepStats stats;
+    for (const int limit : {50, 100, 500}) {
+        view.iterations = limit;
+        stats = renderDeepCounts(deepView(view), pool, counts);
+        CHECK(counts == renderCounts(view, pool));
+        CHECK(stats.orbitLength == limit + 1 && stats.blaLevels > 0 && !stats.extended);
+    }
+    DeepOptions noBla;
+    noBla.bla = false;
+    stats = renderDeepCounts(deepView(view), pool, plain, noBla);
+    CHECK(stats.skipped == 0 && plain == counts);
+
+    view.fractal = Fractal::Julia;
+    view.panX = 0;
+    view.cx = -0.8;
+    view.cy = 0.156;
+    view.rotation = 0.4;
+    // (At higher limits a few boundary pixels of this Julia set amplify rounding differences past any tolerance)
+    for (const int limit : {50, 100}) {
+        view.iterations = limit;
+        renderDeepCounts(deepView(view), pool, counts);
+        CHECK(counts == renderCounts(view, pool));
+    }
+
+    // Deep Mandelbrot: every pixel against a bignum-only render. Next to the Misiurewicz point c = i the spiral has
+    // detail at any depth; the reference, 1e-29 off it, escapes early, so pixels rebase while BLA skips most steps.
+    DeepView spiral = deepView(View());
+    spiral.panX = "1e-29";
+    spiral.panY = "1";
+    spiral.zoom = parseZoom("1e-30");
+    spiral.view.zoom = 1e-30;
+    spiral.view.width = 8;
+    spiral.view.height = 6;
+    spiral.view.iterations = 3000;
+    CHECK(needsDeep(spiral.view));
+    stats = renderDeepCounts(spiral, pool, counts);
+    CHECK(stats.precisionBits >= 160 && stats.orbitLength < 3001 && stats.skipped > stats.stepped);
+    int same = 0;
+    for (int py = 0; py < 6; py++) {
+        for (int px = 0; px < 8; px++) same += counts[std::size_t(py) * 8 + px] == bruteForce(spiral, "1e-30", px, py, 8);
+    }
+    CHECK(same == 48);
+    CHECK(*std::min_element(counts.begin(), counts.end()) < *std::max_element(counts.begin(), counts.end()));
+
+    // Extended exponents agree with doubles where both work
+    spiral.view.width = 96;
+    spiral.view.height = 64;
+    renderDeepCounts(spiral, pool, plain);
+    DeepOptions extended;
+    extended.extended = true;
+    stats = renderDeepCounts(spiral, pool, counts, extended);
+    CHECK(stats.extended && counts == plain);
+
+    // Past double's range: the Misiurewicz point c = i at 1e-400
+    DeepView misiurewicz = deepView(View());
+    misiurewicz.panX = "0";
+    misiurewicz.panY = "1";
+    misiurewicz.zoom = parseZoom("1e-400");
+    misiurewicz.view.zoom = 0;
+    misiurewicz.view.width = 4;
+    misiurewicz.view.height = 3;
+    misiurewicz.view.iterations = 4000;
+    stats = renderDeepCounts(misiurewicz, pool, counts);
+    CHECK(stats.extended && stats.precisionBits >= 1329 && stats.orbitLength == 4001);
+    same = 0;
+    for (int py = 0; py < 3; py++) {
+        for (int px = 0; px < 4; px++) {
+            const int expected = bruteForce(misiurewicz, "1e-400", px, py, 48);
+            CHECK(expected > 1000 && expected < 4000);
+            same += counts[std::size_t(py) * 4 + px] == expected;
+        }
+    }
+    CHECK(same == 12);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,80 @@
+// tests/imageTest.cpp
+#include <cstring>
+#include <string>
+
+#include "check.h"
+#include "image.h"
+
+using namespace ftravel;
+
+static std::uint32_t readU32(const std::vector<std::uint8_t>& d, std::size_t at) {
+    return (std::uint32_t(d[at]) << 24) | (std::uint32_t(d[at + 1]) << 16) | (std::uint32_t(d[at + 2]) << 8) | d[at + 3];
+}
+
+/** Walks the PNG chunks, checks their CRCs and returns the unpacked stored-block payload of IDAT */
+static std::vector<std::uint8_t> unpackPng(const std::vector<std::uint8_t>& png, int& width, int& height) {
+    std::vector<std::uint8_t> raw;
+    std::size_t at = 8;
+    while (at + 12 <= png.size()) {
+        const std::uint32_t length = readU32(png, at);
+        const std::string type(png.begin() + at + 4, png.begin() + at + 8);
+        CHECK(crc32(&png[at + 4], length + 4) == readU32(png, at + 8 + length));
+
+        const std::size_t data = at + 8;
+        if (type == "IHDR") {
+            width = int(readU32(png, data));
+            height = int(readU32(png, data + 4));
+            CHECK(png[data + 8] == 8 && png[data + 9] == 2);
+        } else if (type == "IDAT") {
+            CHECK(png[data] == 0x78 && (png[data] * 256 + png[data + 1]) % 31 == 0);
+            std::size_t p = data + 2;
+            for (bool last = false; !last;) {
+                last = png[p] & 1;
+                const std::size_t len = png[p + 1] | (png[p + 2] << 8);
+                CHECK(std::uint16_t(len ^ (png[p + 3] | (png[p + 4] << 8))) == 0xFFFF);
+                raw.insert(raw.end(), png.begin() + p + 5, png.begin() + p + 5 + len);
+                p += 5 + len;
+            }
+            std::uint32_t a = 1, b = 0;
+            for (std::uint8_t v : raw) {
+                a = (a + v) % 65521;
+                b = (b + a) % 65521;
+            }
+            CHECK(readU32(png, p) == ((b << 16) | a));
+        }
+        at += 12 + length;
+    }
+    CHECK(at == png.size());
+    return raw;
+}
+
+int main() {
+    // Known CRC-32 check value
+    const char* digits = "123456789";
+    CHECK(crc32(reinterpret_cast<const std::uint8_t*>(digits), 9) == 0xCBF43926u);
+
+    Image image(300, 250);
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) image.set(x, y, {std::uint8_t(x), std::uint8_t(y), std::uint8_t(x ^ y)});
+    }
+
+    const std::vector<std::uint8_t> png = encodePng(image);
+    CHECK(std::memcmp(png.data(), "\x89PNG\r\n\x1a\n", 8) == 0);
+    int width = 0, height = 0;
+    const std::vector<std::uint8_t> raw = unpackPng(png, width, height);
+    CHECK(width == 300 && height == 250);
+    // 225 KB of rows spans several stored blocks
+    CHECK(raw.size() == std::size_t(250) * (1 + 300 * 3));
+    bool rowsMatch = raw.size() == std::size_t(250) * 901;
+    for (int y = 0; rowsMatch && y < 250; y++) {
+        rowsMatch = raw[y * 901] == 0 && std::memcmp(&raw[y * 901 + 1], &image.pixels[y * 900], 900) == 0;
+    }
+    CHECK(rowsMatch);
+
+    const std::vector<std::uint8_t> ppm = encodePpm(image);
+    const std::string header = "P6\n300 250\n255\n";
+    CHECK(std::memcmp(ppm.data(), header.data(), header.size()) == 0);
+    CHECK(ppm.size() == header.size() + image.pixels.size());
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,53 @@
+// tests/iteratorsTest.cpp
+#include "check.h"
+#include "iterators.h"
+#include "palette.h"
+
+using namespace ftravel;
+
+/** Escape count as the web app's shaders compute it: z0 = 0 (Mandelbrot) or the point (Julia), escape at |z|^2 > 4 */
+static int webAppCount(double zx, double zy, double cx, double cy, int limit) {
+    for (int n = 0; n < limit; n++) {
+        if (zx * zx + zy * zy > 4) return n;
+        const double t = zx * zx - zy * zy + cx;
+        zy = 2 * zx * zy + cy;
+        zx = t;
+    }
+    return limit;
+}
+
+int main() {
+    // Interior points run to the limit
+    CHECK(mandelIterator(0, 0, FTRAVEL_ITERATIONS) == FTRAVEL_ITERATIONS);
+    CHECK(mandelIterator(-1, 0, 1000) == 1000);
+    CHECK(juliaIterator(0, 0, -1, 0, 300) == 300);
+
+    // Points outside escape before the first step
+    CHECK(mandelIterator(2, 2, FTRAVEL_ITERATIONS) == 0);
+    CHECK(juliaIterator(3, 0, -0.8, 0.156, FTRAVEL_ITERATIONS) == 0);
+
+    // c = 1: 1, 2 (|z|^2 = 4 still inside), 5
+    CHECK(mandelIterator(1, 0, FTRAVEL_ITERATIONS) == 2);
+
+    // Julia matches the web app, Mandelbrot starts one step later (z1 = c)
+    for (int i = -20; i <= 20; i++) {
+        for (int j = -20; j <= 20; j++) {
+            const double x = i * 0.1, y = j * 0.07;
+            CHECK(juliaIterator(x, y, -0.8, 0.156, 500) == webAppCount(x, y, -0.8, 0.156, 500));
+
+            const int web = webAppCount(0, 0, x, y, 500);
+            CHECK(mandelIterator(x, y, 500) == (web == 500 ? 500 : web - 1));
+        }
+    }
+
+    // Classic palette: black, red, yellow and white ramps; interior is white
+    const Palette& pal = classicPalette();
+    CHECK(pal[0].r == 0 && pal[0].g == 0 && pal[0].b == 0);
+    CHECK(pal[0x3F].r == 0xFF && pal[0x3F].g == 0);
+    CHECK(pal[0x7F].r == 0xFF && pal[0x7F].g == 0xFF && pal[0x7F].b == 0);
+    CHECK(pal[0x80].b == 0 && pal[0xBF].b == 0xFF);
+    CHECK(shade(pal, 1000, 1000).g == 0xFF);
+    CHECK(shade(pal, 0x140, 1000).r == pal[0x40].r);
+
+    return TEST_RESULT();
+}
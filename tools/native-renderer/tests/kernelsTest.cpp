@@ -0,0 +1,72 @@
+// tests/kernelsTest.cpp
+#include <cmath>
+
+#include "check.h"
+#include "iterators.h"
+#include "kernels.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+/** Counts of a span straight from the iterators */
+static std::vector<std::int32_t> reference(const RowSpan& row, const EscapeParams& params) {
+    std::vector<std::int32_t> counts;
+    for (int i = 0; i < row.count; i++) {
+        const double n = row.first + i * row.stride;
+        const double x = row.panX + (row.startX + n * row.stepX);
+        const double y = row.panY + (row.startY + n * row.stepY);
+        counts.push_back(params.fractal == Fractal::Julia ? juliaIterator(x, y, params.cx, params.cy, params.limit)
+                                                          : mandelIterator(x, y, params.limit));
+    }
+    return counts;
+}
+
+int main() {
+    const std::vector<EscapeKernel>& kernels = availableKernels();
+    CHECK(!kernels.empty() && std::string(kernels.front().name) == "scalar");
+    CHECK(&bestKernel() == &kernels.back());
+    CHECK(findKernel("scalar") == &kernels.front());
+    CHECK(findKernel("mmx") == nullptr);
+    for (const EscapeKernel& kernel : kernels) std::fprintf(stderr, "kernel %s (%d lanes)\n", kernel.name, kernel.lanes);
+
+    // Spans through the boundary at both limits, every tail length, slanted as in rotated views
+    const EscapeParams params[] = {
+        {Fractal::Mandelbrot, 0, 0, 255},
+        {Fractal::Mandelbrot, 0, 0, 3000},
+        {Fractal::Julia, -0.8, 0.156, 1000},
+        {Fractal::Julia, 0.285, 0.01, 7},
+    };
+    for (const EscapeParams& p : params) {
+        for (int count = 1; count <= 19; count++) {
+            for (int k = 0; k < 12; k++) {
+                const double angle = k * 0.55;
+                // Strided spans (refinement passes) from k = 6 on
+                const RowSpan row{-0.75, 0.1, -1.2 + 0.05 * k, 0.02 * k, 0.13 * std::cos(angle), 0.13 * std::sin(angle),
+                                  count, k < 6 ? 0 : k, k < 6 ? 1 : k - 4};
+                const std::vector<std::int32_t> expected = reference(row, p);
+                for (const EscapeKernel& kernel : kernels) {
+                    std::vector<std::int32_t> out(count + 1, -1);
+                    kernel.run(row, p, out.data());
+                    CHECK(std::vector<std::int32_t>(out.begin(), out.end() - 1) == expected);
+                    // Nothing written past the span
+                    CHECK(out.back() == -1);
+                }
+            }
+        }
+    }
+
+    // Whole frames agree too, deep in seahorse valley where neighbouring counts differ the most
+    View view;
+    view.width = 157;
+    view.height = 93;
+    view.panX = -0.7436438870371587;
+    view.panY = 0.1318259042053988;
+    view.zoom = 2e-9;
+    view.rotation = 0.4;
+    view.iterations = 5000;
+    ThreadPool pool(2);
+    const std::vector<std::int32_t> scalar = renderCounts(view, pool, kernels.front());
+    for (const EscapeKernel& kernel : kernels) CHECK(renderCounts(view, pool, kernel) == scalar);
+
+    return TEST_RESULT();
+}
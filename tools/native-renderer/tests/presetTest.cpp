@@ -0,0 +1,69 @@
+// tests/presetTest.cpp
+#include <cmath>
+#include <stdexcept>
+
+#include "check.h"
+#include "preset.h"
+
+using namespace ftravel;
+
+static bool rejects(const std::string& preset, Fractal fractal) {
+    try {
+        presetView(parseJson(preset), fractal);
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    // The reader keeps number literals and handles the usual syntax
+    const JsonValue doc = parseJson(R"( {"a": [1, -2.5e-3, "x\"é😀"], "b": {"c": true, "d": null}, "e": false} )");
+    CHECK(doc.isObject() && doc.members.size() == 3);
+    CHECK(doc.find("a")->items[1].text == "-2.5e-3" && doc.find("a")->items[1].number() == -2.5e-3);
+    CHECK(doc.find("a")->items[2].text == "x\"\xC3\xA9\xF0\x9F\x98\x80");
+    CHECK(doc.find("b")->find("c")->boolean && doc.find("b")->find("d")->type == JsonValue::Type::Null);
+    CHECK(!doc.find("e")->boolean && doc.find("missing") == nullptr);
+    for (const char* bad : {"", "[1,]", "{\"a\" 1}", "[1] 2", "\"open", "01x", "-"}) {
+        bool threw = false;
+        try {
+            parseJson(bad);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+
+    // Mandelbrot presets: every digit of the centre kept, rotation in radians, the app's iteration budget
+    const DeepView tip = presetView(
+        parseJson(R"({"id": "Tip", "pan": [-1.6751190310023891218391902, 0.0002814850761612082], "rotation": 0.5,
+                      "zoom": 1.669974067516279e-35, "paletteId": "Default"})"),
+        Fractal::Mandelbrot);
+    CHECK(tip.panX == "-1.6751190310023891218391902" && tip.panY == "0.0002814850761612082");
+    CHECK(tip.view.panX == -1.6751190310023891 && tip.view.zoom == 1.669974067516279e-35);
+    CHECK(tip.view.rotation == 0.5 && tip.view.iterations == 5000);
+    CHECK(presetIterations(Fractal::Mandelbrot, 3.0) == 200 && presetIterations(Fractal::Mandelbrot, 1.5) == 250);
+
+    // Decimal strings and zooms past double's range, as the app's COORDINATE type allows
+    const DeepView deep = presetView(parseJson(R"({"pan": ["0", "1.000000000000000000000000000001"], "zoom": "1e-500"})"),
+                                     Fractal::Mandelbrot);
+    CHECK(deep.panY == "1.000000000000000000000000000001" && deep.view.zoom == 0);
+    CHECK(std::abs(log2(deep.zoom) + 500 * std::log2(10.0)) < 1e-9);
+    CHECK(needsDeep(deep.view));
+
+    // Julia presets: rotation in degrees, c from the preset, the app's budget
+    const DeepView julia = presetView(
+        parseJson(R"({"id": "Kissing Dragons", "c": [-0.835, -0.232], "zoom": 3.5, "rotation": 150, "pan": [0, 0]})"),
+        Fractal::Julia);
+    CHECK(std::abs(julia.view.rotation - 150 * std::acos(-1.0) / 180) < 1e-15);
+    CHECK(julia.cx == "-0.835" && julia.view.cy == -0.232 && julia.view.iterations == 857);
+    CHECK(presetIterations(Fractal::Julia, 1e-3) == 2000);
+
+    CHECK(rejects(R"({"zoom": 1})", Fractal::Mandelbrot));
+    CHECK(rejects(R"({"pan": [0], "zoom": 1})", Fractal::Mandelbrot));
+    CHECK(rejects(R"({"pan": ["abc", 0], "zoom": 1})", Fractal::Mandelbrot));
+    CHECK(rejects(R"({"pan": [0, 0], "zoom": -1})", Fractal::Mandelbrot));
+    CHECK(rejects(R"({"pan": [0, 0], "zoom": 1})", Fractal::Julia));
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,94 @@
+// tests/refineTest.cpp
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "check.h"
+#include "refine.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+/** Sums 1..n by splitting the range into spawned halves */
+static void sumRange(WorkStealingScheduler& scheduler, std::atomic<long>& sum, long from, long to) {
+    while (to - from > 8) {
+        const long mid = (from + to) / 2;
+        scheduler.spawn([&scheduler, &sum, mid, to] { sumRange(scheduler, sum, mid, to); });
+        to = mid;
+    }
+    for (long n = from; n < to; n++) sum += n;
+}
+
+int main() {
+    // The scheduler runs a nested task tree to completion and can be reused
+    for (unsigned threads : {1u, 4u}) {
+        WorkStealingScheduler scheduler(threads);
+        CHECK(scheduler.size() == threads);
+        for (int round = 0; round < 3; round++) {
+            std::atomic<long> sum{0};
+            scheduler.run([&] { sumRange(scheduler, sum, 1, 10001); });
+            CHECK(sum == 10000L * 10001 / 2);
+        }
+    }
+
+    // Without guessing the refined counts equal the band renderer's, whatever the size, rotation or thread count
+    View view;
+    view.iterations = 300;
+    ThreadPool pool(2);
+    for (unsigned threads : {1u, 4u}) {
+        WorkStealingScheduler scheduler(threads);
+        for (int size : {16, 53, 130}) {
+            for (double rotation : {0.0, 0.7}) {
+                view.width = size + 17;
+                view.height = size;
+                view.rotation = rotation;
+                RefineOptions exact;
+                exact.guess = false;
+                std::vector<std::int32_t> counts;
+                const RefineStats stats = refineCounts(view, scheduler, counts, exact);
+                CHECK(counts == renderCounts(view, pool));
+                CHECK(stats.passes == 5 && !stats.cancelled);
+                CHECK(stats.iterated == counts.size() && stats.guessed == 0);
+            }
+        }
+    }
+
+    view.fractal = Fractal::Julia;
+    view.cx = -0.8;
+    view.cy = 0.156;
+    view.panX = 0;
+    view.rotation = 0;
+    view.width = 97;
+    view.height = 61;
+    WorkStealingScheduler scheduler(3);
+    RefineOptions exact;
+    exact.guess = false;
+    std::vector<std::int32_t> counts;
+    refineCounts(view, scheduler, counts, exact);
+    CHECK(counts == renderCounts(view, pool));
+
+    // Guessing on the default view skips work but leaves the image nearly unchanged; passes report in order
+    view = View();
+    view.width = 320;
+    view.height = 240;
+    std::vector<int> blocks;
+    RefineOptions guess;
+    guess.onPass = [&](int blockSize) { blocks.push_back(blockSize); };
+    const RefineStats stats = refineCounts(view, scheduler, counts, guess);
+    CHECK((blocks == std::vector<int>{16, 8, 4, 2, 1}));
+    CHECK(stats.guessed > 0 && stats.iterated + stats.guessed == counts.size());
+    const std::vector<std::int32_t> expected = renderCounts(view, pool);
+    std::size_t same = 0;
+    for (std::size_t i = 0; i < counts.size(); i++) same += counts[i] == expected[i];
+    CHECK(same > counts.size() * 99 / 100);
+
+    // A render cancelled before it starts completes no pass
+    std::atomic<bool> cancel{true};
+    RefineOptions cancelled;
+    cancelled.cancel = &cancel;
+    const RefineStats stopped = refineCounts(view, scheduler, counts, cancelled);
+    CHECK(stopped.cancelled && stopped.passes == 0);
+    CHECK(counts.size() == std::size_t(view.width) * view.height);
+
+    return TEST_RESULT();
+}
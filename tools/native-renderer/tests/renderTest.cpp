@@ -0,0 +1,59 @@
+// tests/renderTest.cpp
+#include <cmath>
+
+#include "check.h"
+#include "iterators.h"
+#include "renderer.h"
+
+using namespace ftravel;
+
+static bool near(double a, double b) { return std::abs(a - b) < 1e-12; }
+
+int main() {
+    View view;
+    view.width = 200;
+    view.height = 100;
+    view.panX = -0.5;
+    view.panY = 0.25;
+    view.zoom = 2;
+
+    // Pixel centres around the view centre land half a pixel off pan; rows go down, y goes up
+    PixelMapping map = pixelMapping(view);
+    CHECK(near(map.x(99.5, 49.5), -0.5) && near(map.y(99.5, 49.5), 0.25));
+    CHECK(near(map.x(0, 49.5), -0.5 - 1.99) && near(map.y(99.5, 0), 0.25 + 0.99));
+
+    // A quarter turn counter-clockwise puts the right edge at the top
+    view.rotation = std::acos(-1.0) / 2;
+    map = pixelMapping(view);
+    CHECK(near(map.x(199.5, 49.5), -0.5) && near(map.y(199.5, 49.5), 0.25 + 2.0));
+    view.rotation = 0;
+
+    // Band-parallel rendering matches a plain per-pixel loop, on any number of threads
+    view.iterations = 400;
+    map = pixelMapping(view);
+    std::vector<std::int32_t> expected;
+    for (int py = 0; py < view.height; py++) {
+        for (int px = 0; px < view.width; px++) expected.push_back(mandelIterator(map.x(px, py), map.y(px, py), 400));
+    }
+    for (unsigned threads : {1u, 3u, 8u}) {
+        ThreadPool pool(threads);
+        CHECK(pool.size() == threads);
+        CHECK(renderCounts(view, pool) == expected);
+        // The pool is reusable
+        CHECK(renderCounts(view, pool) == expected);
+    }
+
+    view.fractal = Fractal::Julia;
+    view.cx = -0.8;
+    view.cy = 0.156;
+    ThreadPool pool(4);
+    const std::vector<std::int32_t> julia = renderCounts(view, pool);
+    CHECK(julia[50 * 200 + 100] == juliaIterator(map.x(100, 50), map.y(100, 50), -0.8, 0.156, 400));
+
+    const Image image = colorize(view, julia, classicPalette());
+    const Rgb c = shade(classicPalette(), julia[7 * 200 + 11], 400);
+    const std::uint8_t* p = &image.pixels[(7 * 200 + 11) * 3];
+    CHECK(p[0] == c.r && p[1] == c.g && p[2] == c.b);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,66 @@
+// tests/webPaletteTest.cpp
+#include <cmath>
+#include <stdexcept>
+
+#include "check.h"
+#include "webPalette.h"
+
+using namespace ftravel;
+
+static Rgb pixel(const View& view, int count, float r2, const WebPalette& palette) {
+    const Image image = colorizeWeb(view, {count}, {r2}, palette);
+    return {image.pixels[0], image.pixels[1], image.pixels[2]};
+}
+
+static bool same(Rgb a, Rgb b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+int main() {
+    const JsonValue mandelbrot = parseJson(R"({"type": "MANDELBROT", "views": [{"id": "A"}, {"id": "B", "paletteId": "Neon"}],
+        "palettes": [{"id": "Default", "theme": [1, 1, 1]},
+                     {"id": "Neon", "theme": [0.5, 1, 2], "frequency": [1, 2, 3], "phase": [0, 0.5, 1]}]})");
+    const std::vector<WebPalette> palettes = readPalettes(mandelbrot, Fractal::Mandelbrot);
+    CHECK(palettes.size() == 2 && palettes[1].theme[2] == 2 && palettes[1].phase[1] == 0.5);
+    CHECK(palettes[0].frequency[0] == 3.1415 && palettes[0].phase[2] == 0);
+
+    // A view's own palette, else the mode's default (Julia: the first view's)
+    CHECK(viewPalette(mandelbrot, mandelbrot.find("views")->items[1], Fractal::Mandelbrot).id == "Neon");
+    CHECK(viewPalette(mandelbrot, mandelbrot.find("views")->items[0], Fractal::Mandelbrot).id == "Default");
+    const JsonValue julia = parseJson(R"({"type": "JULIA", "views": [{"id": "A", "paletteId": "Second"}, {"id": "B"}],
+        "palettes": [{"id": "First", "theme": [0, 0, 0, 0.1, 0.1, 0.1, 0.2, 0.4, 0.6, 1, 1, 1, 1, 1, 1]},
+                     {"id": "Second", "theme": [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1]}]})");
+    CHECK(viewPalette(julia, julia.find("views")->items[1], Fractal::Julia).id == "Second");
+    CHECK(viewPalette(parseJson(R"({"views": []})"), julia.find("views")->items[1], Fractal::Julia).theme.size() == 15);
+
+    bool threw = false;
+    try {
+        readPalettes(parseJson(R"({"palettes": [{"id": "Short", "theme": [1, 1, 1]}]})"), Fractal::Julia);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    CHECK(threw);
+
+    // mandelbrot.frag, as the CPU kernel's test checks it: app count 42 with |z|² = 16 is native count 41
+    View view;
+    view.width = view.height = 1;
+    view.iterations = 100;
+    const WebPalette plain = palettes[0];
+    const double t = (42 - std::log2(std::log2(16.0))) / 100;
+    Rgb expected;
+    std::uint8_t* channel[] = {&expected.r, &expected.g, &expected.b};
+    for (int ch = 0; ch < 3; ch++) {
+        *channel[ch] = std::uint8_t(std::lround(std::fmin(std::fmax(std::sin(t * plain.frequency[ch]), 0), 1) * 255));
+    }
+    CHECK(same(pixel(view, 41, 16, plain), expected));
+    CHECK(same(pixel(view, 100, 0, plain), Rgb{0, 0, 0}));
+    CHECK(same(pixel(view, 99, 16, plain), Rgb{0, 0, 0}));
+
+    // julia.frag: t = 0.5 lands exactly on the third stop
+    view.fractal = Fractal::Julia;
+    const WebPalette stops = readPalettes(julia, Fractal::Julia)[0];
+    CHECK(same(pixel(view, 0, 2, stops), Rgb{51, 102, 153}));
+    CHECK(same(pixel(view, 100, 0, stops), Rgb{0, 0, 0}));
+
+    return TEST_RESULT();
+}
@@ -4,6 +4,8 @@ const HtmlWebpackPlugin = require('html-webpack-plugin');
 const MiniCssExtractPlugin = require('mini-css-extract-plugin');
 const CopyWebpackPlugin = require('copy-webpack-plugin');
 const TerserPlugin = require('terser-webpack-plugin');
+const ServiceWorkerPlugin = require('./src/config/serviceWorkerPlugin');
+const PrecompressPlugin = require('./src/config/precompressPlugin');
 
 const CssMinimizerPlugin = require('css-minimizer-webpack-plugin');
 
@@ -15,6 +17,8 @@ module.exports = (env, argv) => {
         entry: './src/main.js',
         output: {
             filename: isProduction ? 'js/bundle.[contenthash].js' : 'js/bundle.js',
+            // Per-mode chunks loaded on demand (see src/renderers/modeLoader.js)
+            chunkFilename: isProduction ? 'js/[name].[contenthash].js' : 'js/[name].js',
             path: path.resolve(__dirname, 'dist'),
             publicPath: '',
             clean: true, // Clean the dist folder before each build
@@ -95,9 +99,18 @@ module.exports = (env, argv) => {
                     {
                         from: path.resolve(__dirname, 'manifest.json'),
                         to: 'manifest.json'
+                    },
+                    {
+                        // Serves the precompressed assets below, so it ships with them
+                        from: path.resolve(__dirname, '.htaccess'),
+                        to: '.htaccess'
                     }
                 ]
-            })
+            }),
+            // Offline support and disk-speed repeat starts; the dev server keeps serving live builds instead
+            ...(isProduction ? [new ServiceWorkerPlugin({template: './src/sw.js'})] : []),
+            // Brotli/gzip siblings of the text assets, picked by .htaccess according to Accept-Encoding
+            ...(isProduction ? [new PrecompressPlugin()] : [])
         ],
         optimization: {
             minimize: isProduction,